@@ -0,0 +1,159 @@
+//==================================================================================================
+//  File:       huge_page_benchmark.cpp
+//
+//  Summary:    Compares strided and blocked traversals of a large matrix allocated with the
+//              default allocator against the huge page allocator. Reports the run time and, where
+//              hardware counters are available, the number of data TLB read misses.
+//==================================================================================================
+//
+#include <experimental/linear_algebra.hpp>
+#include <chrono>
+#include <cstdio>
+
+#if defined( __linux__ )
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  // Counts data TLB read misses of the calling thread, if the platform permits
+  class tlb_miss_counter
+  {
+    public:
+      tlb_miss_counter()
+      {
+        #if defined( __linux__ )
+        perf_event_attr attr {};
+        attr.type           = PERF_TYPE_HW_CACHE;
+        attr.size           = sizeof( attr );
+        attr.config         = PERF_COUNT_HW_CACHE_DTLB | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        fd_ = static_cast<int>( ::syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+        #endif
+      }
+      ~tlb_miss_counter()
+      {
+        #if defined( __linux__ )
+        if ( fd_ >= 0 ) ::close( fd_ );
+        #endif
+      }
+      tlb_miss_counter( const tlb_miss_counter& ) = delete;
+      tlb_miss_counter& operator = ( const tlb_miss_counter& ) = delete;
+
+      bool available() const noexcept { return fd_ >= 0; }
+      void start() noexcept
+      {
+        #if defined( __linux__ )
+        if ( fd_ >= 0 )
+        {
+          ::ioctl( fd_, PERF_EVENT_IOC_RESET, 0 );
+          ::ioctl( fd_, PERF_EVENT_IOC_ENABLE, 0 );
+        }
+        #endif
+      }
+      long long stop() noexcept
+      {
+        long long count = -1;
+        #if defined( __linux__ )
+        if ( fd_ >= 0 )
+        {
+          ::ioctl( fd_, PERF_EVENT_IOC_DISABLE, 0 );
+          if ( ::read( fd_, &count, sizeof( count ) ) != sizeof( count ) ) count = -1;
+        }
+        #endif
+        return count;
+      }
+
+    private:
+      int fd_ = -1;
+  };
+
+  constexpr std::size_t size       = 4096;
+  constexpr std::size_t block_size = 64;
+  constexpr int         repeats    = 3;
+
+  // Sums a row major matrix column by column; consecutive accesses are a row apart
+  template < class Matrix >
+  double strided_sum( const Matrix& m )
+  {
+    double sum = 0.0;
+    for ( std::size_t j = 0; j < size; ++j )
+    {
+      for ( std::size_t i = 0; i < size; ++i )
+      {
+        sum += m( i, j );
+      }
+    }
+    return sum;
+  }
+
+  // Sums a row major matrix block by block, reading each block column by column
+  template < class Matrix >
+  double blocked_sum( const Matrix& m )
+  {
+    double sum = 0.0;
+    for ( std::size_t bi = 0; bi < size; bi += block_size )
+    {
+      for ( std::size_t bj = 0; bj < size; bj += block_size )
+      {
+        for ( std::size_t j = bj; j < bj + block_size; ++j )
+        {
+          for ( std::size_t i = bi; i < bi + block_size; ++i )
+          {
+            sum += m( i, j );
+          }
+        }
+      }
+    }
+    return sum;
+  }
+
+  template < class Allocator, class Kernel >
+  void run( const char* allocator_name, const char* kernel_name, Kernel kernel )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,Allocator>;
+    const matrix_type m{ std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( size, size ),
+                         []( auto i, auto j ) { return double( ( i + j ) % 7 ); } };
+    tlb_miss_counter counter;
+    double           best   = 0.0;
+    long long        misses = -1;
+    double           result = 0.0;
+    for ( int r = 0; r < repeats; ++r )
+    {
+      counter.start();
+      const auto begin = std::chrono::steady_clock::now();
+      result          += kernel( m );
+      const auto end   = std::chrono::steady_clock::now();
+      const long long count   = counter.stop();
+      const double    seconds = std::chrono::duration<double>( end - begin ).count();
+      if ( ( r == 0 ) || ( seconds < best ) )
+      {
+        best   = seconds;
+        misses = count;
+      }
+    }
+    if ( counter.available() )
+    {
+      std::printf( "%-10s %-20s %10.2f ms %14lld dTLB misses  (checksum %g)\n", kernel_name, allocator_name, 1e3 * best, misses, result );
+    }
+    else
+    {
+      std::printf( "%-10s %-20s %10.2f ms %14s dTLB misses  (checksum %g)\n", kernel_name, allocator_name, 1e3 * best, "n/a", result );
+    }
+  }
+}
+
+int main()
+{
+  std::printf( "%zux%zu doubles, huge pages %s\n", size, size, LINALG_HUGE_PAGES ? "requested" : "unsupported" );
+  run<std::allocator<double>>( "std::allocator", "strided", []( const auto& m ) { return strided_sum( m ); } );
+  run<std::experimental::math::huge_page_allocator<double>>( "huge_page_allocator", "strided", []( const auto& m ) { return strided_sum( m ); } );
+  run<std::allocator<double>>( "std::allocator", "blocked", []( const auto& m ) { return blocked_sum( m ); } );
+  run<std::experimental::math::huge_page_allocator<double>>( "huge_page_allocator", "blocked", []( const auto& m ) { return blocked_sum( m ); } );
+  return 0;
+}
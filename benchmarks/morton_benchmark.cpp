@@ -0,0 +1,60 @@
+//==================================================================================================
+//  File:       morton_benchmark.cpp
+//
+//  Summary:    Compares transpose and matrix product of matrices stored in Morton (Z) order against
+//              the same operations on matrices stored in layout_right. The Morton operations are
+//              the blocked traversal and recursive kernels selected for recursive layouts.
+//==================================================================================================
+//
+#include <experimental/linear_algebra.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  constexpr std::size_t transpose_size = 2048;
+  constexpr std::size_t product_size   = 512;
+  constexpr int         repeats        = 3;
+
+  // Returns the best run time of the kernel in seconds and accumulates a checksum of its result
+  template < class Kernel >
+  double best_time( Kernel kernel, double& checksum )
+  {
+    double best = 0.0;
+    for ( int r = 0; r < repeats; ++r )
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      checksum        += kernel();
+      const auto end   = std::chrono::steady_clock::now();
+      const double seconds = std::chrono::duration<double>( end - begin ).count();
+      if ( ( r == 0 ) || ( seconds < best ) )
+      {
+        best = seconds;
+      }
+    }
+    return best;
+  }
+
+  template < class Layout >
+  void run( const char* layout_name )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,std::allocator<double>,Layout>;
+    using extents_type = std::experimental::extents<size_t,dynamic_extent,dynamic_extent>;
+    const matrix_type big{ extents_type( transpose_size, transpose_size ), []( auto i, auto j ) { return double( ( i + 2 * j ) % 7 ); } };
+    const matrix_type a{ extents_type( product_size, product_size ), []( auto i, auto j ) { return double( ( i + j ) % 5 ); } };
+    const matrix_type b{ extents_type( product_size, product_size ), []( auto i, auto j ) { return double( ( i * j ) % 3 ); } };
+    double checksum = 0.0;
+    const double transpose_seconds = best_time( [&big]() { auto t = trans( big ); return std::experimental::math::detail::access( t, 1, 0 ); }, checksum );
+    const double product_seconds   = best_time( [&a,&b]() { auto c = a * b; return std::experimental::math::detail::access( c, 1, 1 ); }, checksum );
+    std::printf( "%-14s transpose %zux%zu %10.2f ms   product %zux%zu %10.2f ms  (checksum %g)\n",
+                 layout_name, transpose_size, transpose_size, 1e3 * transpose_seconds, product_size, product_size, 1e3 * product_seconds, checksum );
+  }
+}
+
+int main()
+{
+  std::printf( "Morton index computation uses %s\n", LINALG_MORTON_PDEP ? "pdep" : "a lookup table" );
+  run<std::experimental::layout_right>( "layout_right" );
+  run<std::experimental::math::layout_morton>( "layout_morton" );
+  return 0;
+}
@@ -10,17 +10,29 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <complex>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <execution>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <span>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 //- Disable some unnecessary compiler warnings coming from mdspan.
 //
@@ -53,8 +65,19 @@ using ::std::experimental::dynamic_extent;
 //
 #include "linear_algebra/config.hpp"
 #include "linear_algebra/macros.hpp"
+#include "linear_algebra/thread_pool.hpp"
 #include "linear_algebra/private_support.hpp"
 #include "linear_algebra/forward_declarations.hpp"
+#include "linear_algebra/tiled_layout.hpp"
+#include "linear_algebra/morton_layout.hpp"
+#include "linear_algebra/packed_layout.hpp"
+#include "linear_algebra/banded_layout.hpp"
+#include "linear_algebra/numa_allocator.hpp"
+#include "linear_algebra/arena_allocator.hpp"
+#include "linear_algebra/aligned_allocator.hpp"
+#include "linear_algebra/huge_page_allocator.hpp"
+#include "linear_algebra/inline_allocator.hpp"
+#include "linear_algebra/caching_allocator.hpp"
 #include "linear_algebra/tensor_concepts.hpp"
 #include "linear_algebra/vector_concepts.hpp"
 #include "linear_algebra/matrix_concepts.hpp"
@@ -68,8 +91,16 @@ using ::std::experimental::dynamic_extent;
 #include "linear_algebra/dynamic_matrix.hpp"
 #include "linear_algebra/fixed_size_vector.hpp"
 #include "linear_algebra/dynamic_vector.hpp"
+#include "linear_algebra/slice_range.hpp"
+#include "linear_algebra/tile_grid.hpp"
 #include "linear_algebra/instant_evaluated_operations.hpp"
 namespace std::experimental::math::operations { using namespace std::experimental::math::instant_evaluated_operations; }
 #include "linear_algebra/arithmetic_operators.hpp"
+#include "linear_algebra/csr_matrix.hpp"
+#include "linear_algebra/coo_builder.hpp"
+#include "linear_algebra/packed_matrix.hpp"
+#include "linear_algebra/band_matrix.hpp"
+#include "linear_algebra/diagonal_matrix.hpp"
+#include "linear_algebra/async_operations.hpp"
 
 #endif  //- LINEAR_ALGEBRA_HPP
@@ -0,0 +1,157 @@
+//==================================================================================================
+//  File:       aligned_allocator.hpp
+//
+//  Summary:    This header defines an over-aligned allocator and the leading dimension padding
+//              policy applied to the capacity of dynamic tensors using it. Padding the leading
+//              dimension to a whole number of alignment units aligns the start of every row, and
+//              avoiding leading dimensions which are multiples of the aliasing stride keeps
+//              consecutive rows from mapping onto the same cache sets.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Default alignment in bytes of aligned allocators (one cache line).
+#ifndef LINALG_DEFAULT_ALIGNMENT
+#  define LINALG_DEFAULT_ALIGNMENT 64
+#endif
+
+// Leading dimensions whose size in bytes is a multiple of this stride are padded by one further
+// alignment unit, since rows separated by such strides compete for the same cache sets.
+#ifndef LINALG_ALIASING_STRIDE
+#  define LINALG_ALIASING_STRIDE 512
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Allocator which aligns every allocation to Alignment bytes. Dynamic tensors using this
+///        allocator pad their leading dimension so every row begins on an Alignment boundary.
+/// @tparam T element type
+/// @tparam Alignment alignment in bytes; must be a power of two no smaller than alignof(T)
+template < class T, ::std::size_t Alignment = LINALG_DEFAULT_ALIGNMENT >
+class aligned_allocator
+{
+  static_assert( ( Alignment & ( Alignment - 1 ) ) == 0, "Alignment must be a power of two." );
+  static_assert( Alignment >= alignof(T), "Alignment must not be smaller than the alignment of the element type." );
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Allocator is stateless and therefore always propagates on move
+    using propagate_on_container_move_assignment = ::std::true_type;
+    /// @brief All instances of the allocator are equal
+    using is_always_equal                        = ::std::true_type;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = aligned_allocator< U, Alignment >; };
+
+    /// @brief Alignment in bytes of each allocation
+    static constexpr size_type alignment = Alignment;
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr aligned_allocator() noexcept = default;
+    /// @brief Converting constructor
+    template < class U >
+    constexpr aligned_allocator( [[maybe_unused]] const aligned_allocator<U,Alignment>& rhs ) noexcept { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements aligned to Alignment bytes
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n )
+    {
+      if ( n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+      {
+        throw ::std::bad_array_new_length();
+      }
+      return static_cast<T*>( ::operator new( n * sizeof(T), ::std::align_val_t( Alignment ) ) );
+    }
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, [[maybe_unused]] size_type n ) noexcept
+    {
+      ::operator delete( p, ::std::align_val_t( Alignment ) );
+    }
+};
+
+/// @brief All aligned allocators of the same alignment compare equal
+template < class T, class U, ::std::size_t Alignment >
+[[nodiscard]] constexpr bool operator == ( const aligned_allocator<T,Alignment>&, const aligned_allocator<U,Alignment>& ) noexcept { return true; }
+/// @brief All aligned allocators of the same alignment compare equal
+template < class T, class U, ::std::size_t Alignment >
+[[nodiscard]] constexpr bool operator != ( const aligned_allocator<T,Alignment>&, const aligned_allocator<U,Alignment>& ) noexcept { return false; }
+
+namespace detail
+{
+
+//=================================================================================================
+//  Padding policy
+//=================================================================================================
+
+// Alignment guaranteed by an allocator (zero if the allocator does not advertise one)
+template < class Alloc, typename = void >
+struct allocator_alignment : public ::std::integral_constant< ::std::size_t, 0 > { };
+template < class Alloc >
+struct allocator_alignment< Alloc, ::std::void_t< decltype( Alloc::alignment ) > > :
+  public ::std::integral_constant< ::std::size_t, Alloc::alignment > { };
+template < class Alloc >
+inline constexpr ::std::size_t allocator_alignment_v = allocator_alignment<Alloc>::value;
+
+// Returns the capacity used to store a tensor of the input size. If the allocator advertises an
+// alignment, then the contiguous dimension of a layout_right or layout_left tensor of rank two or
+// more is rounded up to a whole number of alignment units, plus one more if its size in bytes is
+// a multiple of the aliasing stride. Tiled layouts are rounded up to a whole number of tiles.
+// Otherwise the capacity is the size.
+template < class T, class Layout, class Alloc, class Extents >
+[[nodiscard]] constexpr Extents padded_capacity( const Extents& s ) noexcept
+{
+  constexpr ::std::size_t alignment = allocator_alignment_v<Alloc>;
+  if constexpr ( ( Extents::rank() >= 2 ) && ( alignment >= sizeof(T) ) && ( alignment % sizeof(T) == 0 ) &&
+                 ( ::std::is_same_v< Layout, ::std::experimental::layout_right > || ::std::is_same_v< Layout, ::std::experimental::layout_left > ) )
+  {
+    using index_type = typename Extents::index_type;
+    constexpr ::std::size_t leading = ::std::is_same_v< Layout, ::std::experimental::layout_right > ? Extents::rank() - 1 : 0;
+    constexpr ::std::size_t unit    = alignment / sizeof(T);
+    ::std::array< index_type, Extents::rank() > cap {};
+    for ( ::std::size_t dim = 0; dim < Extents::rank(); ++dim )
+    {
+      cap[dim] = s.extent(dim);
+    }
+    if ( cap[leading] != 0 )
+    {
+      ::std::size_t ld = ( ( static_cast<::std::size_t>( cap[leading] ) + unit - 1 ) / unit ) * unit;
+      if ( ( ld * sizeof(T) ) % LINALG_ALIASING_STRIDE == 0 )
+      {
+        ld += unit;
+      }
+      cap[leading] = static_cast<index_type>( ld );
+    }
+    return Extents( cap );
+  }
+  else
+  {
+    return tile_rounded_extents<Layout>( s );
+  }
+}
+
+}       //- detail namespace
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,392 @@
+//==================================================================================================
+//  File:       arena_allocator.hpp
+//
+//  Summary:    This header defines a bump-pointer workspace for short-lived temporaries and an
+//              allocator which allocates from it. Allocation is a pointer increment, deallocation
+//              of the most recent allocation releases it, and everything else is released at once
+//              by rolling the workspace back to a checkpoint.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_ARENA_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_ARENA_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Alignment of every allocation from a workspace (one cache line).
+#ifndef LINALG_WORKSPACE_ALIGNMENT
+#  define LINALG_WORKSPACE_ALIGNMENT 64
+#endif
+
+// Initial size in bytes of the workspace of each thread.
+#ifndef LINALG_WORKSPACE_SIZE
+#  define LINALG_WORKSPACE_SIZE ( 1 << 20 )
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Bump-pointer arena for temporaries. Allocations are aligned to LINALG_WORKSPACE_ALIGNMENT
+///        bytes. If the current block is exhausted, then a block of at least twice its size is
+///        obtained from the global heap; blocks are returned when the workspace is rolled back past them.
+class workspace
+{
+  private:
+    //- Types
+
+    // Header placed at the start of each block obtained from the global heap
+    struct alignas( LINALG_WORKSPACE_ALIGNMENT ) block_header
+    {
+      block_header* previous;
+      ::std::byte*  previous_begin;
+      ::std::byte*  previous_end;
+      ::std::byte*  previous_position;
+      ::std::size_t previous_used;
+    };
+
+  public:
+    //- Types
+
+    /// @brief Alignment of each allocation
+    static constexpr ::std::size_t alignment = LINALG_WORKSPACE_ALIGNMENT;
+
+    /// @brief Position within the workspace which may later be rolled back to
+    class checkpoint_type
+    {
+      private:
+        friend class workspace;
+        block_header* block_    = nullptr;
+        ::std::byte*  position_ = nullptr;
+        ::std::size_t used_     = 0;
+    };
+
+    /// @brief Rolls the workspace back to the position at which the scope was entered once the
+    ///        scope exits. All tensors allocated within the scope must be destroyed by then.
+    class scope
+    {
+      public:
+        /// @brief Enters a scope of the workspace
+        /// @param ws workspace
+        explicit scope( workspace& ws ) noexcept : workspace_( ws ), checkpoint_( ws.checkpoint() ) { }
+        scope( const scope& )              = delete;
+        scope& operator = ( const scope& ) = delete;
+        /// @brief Rolls the workspace back
+        ~scope() noexcept { this->workspace_.rollback( this->checkpoint_ ); }
+      private:
+        workspace&      workspace_;
+        checkpoint_type checkpoint_;
+    };
+
+    //- Constructors / Destructor
+
+    /// @brief Constructs a workspace with an initial block of LINALG_WORKSPACE_SIZE bytes
+    workspace() : workspace( static_cast<::std::size_t>( LINALG_WORKSPACE_SIZE ) ) { }
+    /// @brief Constructs a workspace with an initial block obtained from the global heap
+    /// @param bytes size of the initial block
+    explicit workspace( ::std::size_t bytes );
+    /// @brief Constructs a workspace over a caller-owned buffer. The buffer is not freed by the workspace.
+    /// @param buffer initial block
+    /// @param bytes size of the initial block
+    workspace( void* buffer, ::std::size_t bytes ) noexcept;
+    workspace( const workspace& )              = delete;
+    workspace& operator = ( const workspace& ) = delete;
+    /// @brief Returns all blocks obtained from the global heap
+    ~workspace() noexcept;
+
+    //- Allocation
+
+    /// @brief Allocates storage
+    /// @param bytes number of bytes
+    /// @param align alignment; at least LINALG_WORKSPACE_ALIGNMENT is used
+    /// @return pointer to the allocated storage
+    [[nodiscard]] void* allocate( ::std::size_t bytes, ::std::size_t align = alignment );
+    /// @brief Deallocates storage. Only the most recent allocation is reclaimed immediately;
+    ///        other storage is reclaimed by rollback.
+    /// @param p pointer to the storage
+    /// @param bytes number of bytes
+    void deallocate( void* p, ::std::size_t bytes ) noexcept;
+    /// @brief Resizes storage, preserving its contents. The most recent allocation is resized in
+    ///        place if the current block has room; otherwise the contents are copied.
+    /// @param p pointer to the storage
+    /// @param old_bytes number of bytes currently allocated
+    /// @param new_bytes number of bytes requested
+    /// @param align alignment; at least LINALG_WORKSPACE_ALIGNMENT is used
+    /// @return pointer to the resized storage
+    [[nodiscard]] void* reallocate( void* p, ::std::size_t old_bytes, ::std::size_t new_bytes, ::std::size_t align = alignment );
+
+    //- Checkpoints
+
+    /// @brief Returns the current position of the workspace
+    [[nodiscard]] checkpoint_type checkpoint() const noexcept;
+    /// @brief Releases everything allocated since the checkpoint was taken
+    /// @param cp checkpoint
+    void rollback( const checkpoint_type& cp ) noexcept;
+    /// @brief Releases everything allocated from the workspace
+    void reset() noexcept;
+
+    //- Properties
+
+    /// @brief Returns the number of bytes in use, including padding
+    [[nodiscard]] ::std::size_t used() const noexcept;
+    /// @brief Returns the number of bytes in the current block
+    [[nodiscard]] ::std::size_t capacity() const noexcept;
+
+  private:
+    //- Data
+    block_header* block_    = nullptr;
+    ::std::byte*  begin_    = nullptr;
+    ::std::byte*  end_      = nullptr;
+    ::std::byte*  position_ = nullptr;
+    ::std::size_t used_     = 0;
+    ::std::byte*  owned_    = nullptr;
+
+    //- Implementation details
+
+    // Obtains a block from the global heap large enough for bytes aligned to align
+    void grow( ::std::size_t bytes, ::std::size_t align );
+    // Returns the current block to the global heap
+    void pop_block() noexcept;
+};
+
+/// @brief Returns the workspace of the calling thread
+/// @return thread-local workspace
+[[nodiscard]] inline workspace& thread_workspace()
+{
+  static thread_local workspace ws;
+  return ws;
+}
+
+/// @brief Allocator which allocates from a workspace
+/// @tparam T element type
+template < class T >
+class arena_allocator
+{
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Allocator is not replaced on copy assignment, so storage remains in the original workspace
+    using propagate_on_container_copy_assignment = ::std::false_type;
+    /// @brief Allocator follows the storage on move assignment
+    using propagate_on_container_move_assignment = ::std::true_type;
+    /// @brief Allocator follows the storage on swap
+    using propagate_on_container_swap            = ::std::true_type;
+    /// @brief Allocators bound to different workspaces are unequal
+    using is_always_equal                        = ::std::false_type;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = arena_allocator<U>; };
+
+    //- Constructors
+
+    /// @brief Default constructor binds to the workspace of the calling thread
+    arena_allocator() : workspace_( &thread_workspace() ) { }
+    /// @brief Binds to a workspace
+    /// @param ws workspace
+    explicit constexpr arena_allocator( workspace& ws ) noexcept : workspace_( &ws ) { }
+    /// @brief Converting constructor
+    template < class U >
+    constexpr arena_allocator( const arena_allocator<U>& rhs ) noexcept : workspace_( &rhs.get_workspace() ) { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n )
+    {
+      if ( n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+      {
+        throw ::std::bad_array_new_length();
+      }
+      return static_cast<T*>( this->workspace_->allocate( n * sizeof(T), alignof(T) ) );
+    }
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, size_type n ) noexcept { this->workspace_->deallocate( p, n * sizeof(T) ); }
+    /// @brief Resizes storage previously returned from allocate, preserving its contents
+    /// @param p pointer to the storage
+    /// @param old_n number of elements currently allocated
+    /// @param new_n number of elements requested
+    /// @return pointer to the resized storage
+    [[nodiscard]] T* reallocate( T* p, size_type old_n, size_type new_n )
+    {
+      if ( new_n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+      {
+        throw ::std::bad_array_new_length();
+      }
+      return static_cast<T*>( this->workspace_->reallocate( p, old_n * sizeof(T), new_n * sizeof(T), alignof(T) ) );
+    }
+
+    //- Properties
+
+    /// @brief Returns the workspace allocated from
+    [[nodiscard]] constexpr workspace& get_workspace() const noexcept { return *this->workspace_; }
+
+  private:
+    //- Data
+    workspace* workspace_;
+};
+
+/// @brief Arena allocators are equal if they allocate from the same workspace
+template < class T, class U >
+[[nodiscard]] constexpr bool operator == ( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs ) noexcept
+{ return &lhs.get_workspace() == &rhs.get_workspace(); }
+/// @brief Arena allocators are equal if they allocate from the same workspace
+template < class T, class U >
+[[nodiscard]] constexpr bool operator != ( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs ) noexcept
+{ return !( lhs == rhs ); }
+
+//------------------------------------------
+// Implementation of workspace
+//------------------------------------------
+
+inline workspace::workspace( ::std::size_t bytes ) :
+  owned_( static_cast<::std::byte*>( ::operator new( bytes, ::std::align_val_t( alignment ) ) ) )
+{
+  this->begin_    = this->owned_;
+  this->end_      = this->owned_ + bytes;
+  this->position_ = this->owned_;
+}
+
+inline workspace::workspace( void* buffer, ::std::size_t bytes ) noexcept :
+  begin_( static_cast<::std::byte*>( buffer ) ),
+  end_( static_cast<::std::byte*>( buffer ) + bytes ),
+  position_( static_cast<::std::byte*>( buffer ) )
+{
+}
+
+inline workspace::~workspace() noexcept
+{
+  while ( this->block_ != nullptr )
+  {
+    this->pop_block();
+  }
+  if ( this->owned_ != nullptr )
+  {
+    ::operator delete( this->owned_, ::std::align_val_t( alignment ) );
+  }
+}
+
+[[nodiscard]] inline void* workspace::allocate( ::std::size_t bytes, ::std::size_t align )
+{
+  align = ::std::max( align, alignment );
+  const auto address = reinterpret_cast<::std::uintptr_t>( this->position_ );
+  const auto padding = static_cast<::std::size_t>( ( align - ( address % align ) ) % align );
+  if ( ( padding > static_cast<::std::size_t>( this->end_ - this->position_ ) ) ||
+       ( bytes > static_cast<::std::size_t>( this->end_ - this->position_ ) - padding ) ) LINALG_UNLIKELY
+  {
+    this->grow( bytes, align );
+    return this->allocate( bytes, align );
+  }
+  ::std::byte* p   = this->position_ + padding;
+  this->position_  = p + bytes;
+  this->used_     += padding + bytes;
+  return p;
+}
+
+inline void workspace::deallocate( void* p, ::std::size_t bytes ) noexcept
+{
+  if ( ( p != nullptr ) && ( static_cast<::std::byte*>( p ) + bytes == this->position_ ) )
+  {
+    this->position_  = static_cast<::std::byte*>( p );
+    this->used_     -= bytes;
+  }
+}
+
+[[nodiscard]] inline void* workspace::reallocate( void* p, ::std::size_t old_bytes, ::std::size_t new_bytes, ::std::size_t align )
+{
+  // Resize the most recent allocation in place if the block has room
+  if ( ( p != nullptr ) && ( static_cast<::std::byte*>( p ) + old_bytes == this->position_ ) &&
+       ( new_bytes <= static_cast<::std::size_t>( this->end_ - static_cast<::std::byte*>( p ) ) ) )
+  {
+    this->position_  = static_cast<::std::byte*>( p ) + new_bytes;
+    this->used_      = this->used_ - old_bytes + new_bytes;
+    return p;
+  }
+  void* q = this->allocate( new_bytes, align );
+  if ( p != nullptr )
+  {
+    ::std::memcpy( q, p, ::std::min( old_bytes, new_bytes ) );
+  }
+  return q;
+}
+
+[[nodiscard]] inline workspace::checkpoint_type workspace::checkpoint() const noexcept
+{
+  checkpoint_type cp;
+  cp.block_    = this->block_;
+  cp.position_ = this->position_;
+  cp.used_     = this->used_;
+  return cp;
+}
+
+inline void workspace::rollback( const checkpoint_type& cp ) noexcept
+{
+  while ( this->block_ != cp.block_ )
+  {
+    this->pop_block();
+  }
+  this->position_ = cp.position_;
+  this->used_     = cp.used_;
+}
+
+inline void workspace::reset() noexcept
+{
+  this->rollback( checkpoint_type() );
+  this->position_ = this->begin_;
+}
+
+[[nodiscard]] inline ::std::size_t workspace::used() const noexcept
+{
+  return this->used_;
+}
+
+[[nodiscard]] inline ::std::size_t workspace::capacity() const noexcept
+{
+  return static_cast<::std::size_t>( this->end_ - this->begin_ );
+}
+
+inline void workspace::grow( ::std::size_t bytes, ::std::size_t align )
+{
+  if ( bytes > ::std::numeric_limits<::std::size_t>::max() / 2 - sizeof(block_header) - align ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_alloc();
+  }
+  const ::std::size_t block_bytes = ::std::max( 2 * this->capacity(), bytes + align );
+  auto* header = static_cast<block_header*>( ::operator new( sizeof(block_header) + block_bytes, ::std::align_val_t( alignment ) ) );
+  header->previous          = this->block_;
+  header->previous_begin    = this->begin_;
+  header->previous_end      = this->end_;
+  header->previous_position = this->position_;
+  header->previous_used     = this->used_;
+  this->block_    = header;
+  this->begin_    = reinterpret_cast<::std::byte*>( header + 1 );
+  this->end_      = this->begin_ + block_bytes;
+  this->position_ = this->begin_;
+}
+
+inline void workspace::pop_block() noexcept
+{
+  block_header* header = this->block_;
+  this->block_    = header->previous;
+  this->begin_    = header->previous_begin;
+  this->end_      = header->previous_end;
+  this->position_ = header->previous_position;
+  this->used_     = header->previous_used;
+  ::operator delete( header, ::std::align_val_t( alignment ) );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_ARENA_ALLOCATOR_HPP
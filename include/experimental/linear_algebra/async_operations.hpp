@@ -0,0 +1,806 @@
+//==================================================================================================
+//  File:       async_operations.hpp
+//
+//  Summary:    This header defines asynchronous variants of the arithmetic operations. Each
+//              operation returns a sender (in the style of P2300) which, once started, computes
+//              its result on the library thread pool and writes it into a caller-owned tensor.
+//              Senders are composed with then and when_all and awaited with sync_wait.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_ASYNC_OPERATIONS_HPP
+#define LINEAR_ALGEBRA_ASYNC_OPERATIONS_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace async_operations
+{
+
+//=================================================================================================
+//  Sender protocol
+//
+//  A sender S declares the values it completes with as S::value_types (a tuple type) and is
+//  connected to a receiver with std::move( s ).connect( r ), which returns an operation state.
+//  Calling start() on the operation state begins the work. On completion exactly one of
+//  r.set_value( values ... ), r.set_error( std::exception_ptr ), or r.set_stopped() is called.
+//  Operation states are neither copyable nor movable once started and must outlive the
+//  completion.
+//=================================================================================================
+
+class thread_pool_scheduler;
+
+/// @brief Sender which completes with no values on a worker thread of a thread pool
+class schedule_sender
+{
+  public:
+    //- Types
+
+    /// @brief Values sent on completion
+    using value_types = ::std::tuple<>;
+
+    //- Constructors
+
+    /// @brief Constructs a sender which completes on the specified pool
+    /// @param pool thread pool
+    constexpr explicit schedule_sender( thread_pool& pool ) noexcept;
+
+    //- Connect
+
+    /// @brief Connects the sender to a receiver
+    /// @tparam Receiver receiver type
+    /// @param receiver receiver notified on completion
+    /// @return operation state
+    template < class Receiver >
+    [[nodiscard]] auto connect( Receiver&& receiver ) &&;
+
+  private:
+    //- Types
+
+    /// @brief Operation state which submits the completion to the pool
+    template < class Receiver >
+    struct operation
+    {
+      thread_pool* pool;
+      Receiver     receiver;
+      void start() noexcept
+      {
+        try { this->pool->submit( [this]() { this->receiver.set_value(); } ); }
+        catch ( ... ) { this->receiver.set_error( ::std::current_exception() ); }
+      }
+    };
+
+    //- Data
+
+    /// @brief pool on which the sender completes
+    thread_pool* pool_;
+};
+
+/// @brief Scheduler which executes work on a thread pool.
+///        A default constructed scheduler targets thread_pool::default_pool().
+class thread_pool_scheduler
+{
+  public:
+    //- Constructors
+
+    /// @brief Constructs a scheduler targeting the default pool
+    constexpr thread_pool_scheduler() noexcept = default;
+    /// @brief Constructs a scheduler targeting the specified pool
+    /// @param pool thread pool on which work is executed
+    constexpr explicit thread_pool_scheduler( thread_pool& pool ) noexcept;
+
+    //- Properties
+
+    /// @brief Returns the pool on which work is executed
+    /// @return thread pool
+    [[nodiscard]] thread_pool& pool() const;
+    /// @brief Returns the execution policy used by kernels scheduled on the pool
+    /// @return thread pool policy
+    [[nodiscard]] thread_pool_policy policy() const;
+
+    //- Scheduling
+
+    /// @brief Returns a sender which completes on a worker thread of the pool
+    /// @return schedule sender
+    [[nodiscard]] schedule_sender schedule() const;
+
+    //- Comparison
+
+    /// @brief Schedulers are equal if they target the same pool
+    [[nodiscard]] friend bool operator == ( const thread_pool_scheduler& lhs, const thread_pool_scheduler& rhs ) { return &lhs.pool() == &rhs.pool(); }
+    /// @brief Schedulers are equal if they target the same pool
+    [[nodiscard]] friend bool operator != ( const thread_pool_scheduler& lhs, const thread_pool_scheduler& rhs ) { return !( lhs == rhs ); }
+
+  private:
+    //- Data
+
+    /// @brief target pool; if null, then the default pool is used
+    thread_pool* pool_ = nullptr;
+};
+
+}       //- async_operations namespace
+
+namespace detail
+{
+
+//==================================================================================================
+//  Is Sender returns true if the type declares the values it completes with
+//==================================================================================================
+template < class T, typename = void >
+struct is_sender : public ::std::false_type { };
+template < class T >
+struct is_sender< T, ::std::void_t< typename ::std::decay_t<T>::value_types > > : public ::std::true_type { };
+template < class T >
+inline constexpr bool is_sender_v = is_sender<T>::value;
+
+//==================================================================================================
+//  Then Value Types returns the values sent after invoking a function on the values of a sender
+//==================================================================================================
+template < class Function, class Values >
+struct then_value_types;
+template < class Function, class ... Values >
+struct then_value_types< Function, ::std::tuple< Values ... > >
+{
+  using result_type = ::std::invoke_result_t< Function, Values ... >;
+  using type        = ::std::conditional_t< ::std::is_void_v<result_type>, ::std::tuple<>, ::std::tuple<result_type> >;
+};
+
+//==================================================================================================
+//  When All Child holds the operation state of one sender of when_all
+//==================================================================================================
+template < ::std::size_t Index, class Sender, class Parent >
+struct when_all_child
+{
+  /// @brief Receiver which forwards the completion to the parent operation
+  struct receiver_type
+  {
+    Parent* parent;
+    template < class ... Values >
+    void set_value( Values&& ... values ) noexcept { this->parent->template set_child_value<Index>( ::std::forward<Values>( values ) ... ); }
+    void set_error( ::std::exception_ptr error ) noexcept { this->parent->set_child_error( ::std::move( error ) ); }
+    void set_stopped() noexcept { this->parent->set_child_stopped(); }
+  };
+  using operation_type = decltype( ::std::declval<Sender>().connect( ::std::declval<receiver_type>() ) );
+  when_all_child( Sender&& sender, Parent* parent ) : operation( ::std::move( sender ).connect( receiver_type { parent } ) ) { }
+  operation_type operation;
+};
+
+//==================================================================================================
+//  Sync Wait State is shared between the waiting thread and the receiver of sync_wait
+//==================================================================================================
+template < class Values >
+struct sync_wait_state
+{
+  /// @brief Receiver which stores the completion and wakes the waiting thread
+  struct receiver_type
+  {
+    sync_wait_state* state;
+    template < class ... Args >
+    void set_value( Args&& ... args ) noexcept
+    {
+      try { this->state->values.emplace( ::std::forward<Args>( args ) ... ); }
+      catch ( ... ) { this->state->error = ::std::current_exception(); }
+      this->signal();
+    }
+    void set_error( ::std::exception_ptr error ) noexcept
+    {
+      this->state->error = ::std::move( error );
+      this->signal();
+    }
+    void set_stopped() noexcept { this->signal(); }
+    void signal() noexcept
+    {
+      // Notify while holding the lock since the waiting thread destroys the state once woken
+      ::std::lock_guard< ::std::mutex > lock( this->state->mutex );
+      this->state->done = true;
+      this->state->cv.notify_one();
+    }
+  };
+  ::std::mutex              mutex;
+  ::std::condition_variable cv;
+  bool                      done = false;
+  ::std::optional<Values>   values;
+  ::std::exception_ptr      error;
+};
+
+}       //- detail namespace
+
+namespace async_operations
+{
+
+//=================================================================================================
+//  Sender factories and adaptors
+//=================================================================================================
+
+/// @brief Sender which completes inline with the specified values
+/// @tparam Values types of values sent
+template < class ... Values >
+class just_sender
+{
+  public:
+    //- Types
+
+    /// @brief Values sent on completion
+    using value_types = ::std::tuple< Values ... >;
+
+    //- Constructors
+
+    /// @brief Constructs a sender from the values to be sent
+    /// @param values values to be sent
+    constexpr explicit just_sender( value_types values ) noexcept( ::std::is_nothrow_move_constructible_v<value_types> ) :
+      values_( ::std::move( values ) ) { }
+
+    //- Connect
+
+    /// @brief Connects the sender to a receiver
+    /// @tparam Receiver receiver type
+    /// @param receiver receiver notified on completion
+    /// @return operation state
+    template < class Receiver >
+    [[nodiscard]] auto connect( Receiver&& receiver ) &&
+    {
+      return operation< ::std::decay_t<Receiver> > { ::std::move( this->values_ ), ::std::forward<Receiver>( receiver ) };
+    }
+
+  private:
+    //- Types
+
+    /// @brief Operation state which sends the values when started
+    template < class Receiver >
+    struct operation
+    {
+      value_types values;
+      Receiver    receiver;
+      void start() noexcept
+      {
+        ::std::apply( [this]( Values& ... args ) { this->receiver.set_value( ::std::move( args ) ... ); }, this->values );
+      }
+    };
+
+    //- Data
+
+    /// @brief values to be sent
+    value_types values_;
+};
+
+/// @brief Sender which invokes a function on the values of another sender and sends its result
+/// @tparam Sender predecessor sender
+/// @tparam Function function invocable with the values of the predecessor
+template < class Sender, class Function >
+class then_sender
+{
+  public:
+    //- Types
+
+    /// @brief Values sent on completion
+    using value_types = typename detail::then_value_types< Function, typename Sender::value_types >::type;
+
+    //- Constructors
+
+    /// @brief Constructs a sender from its predecessor and the function applied to its values
+    /// @param sender predecessor sender
+    /// @param function function invocable with the values of the predecessor
+    constexpr then_sender( Sender sender, Function function ) :
+      sender_( ::std::move( sender ) ), function_( ::std::move( function ) ) { }
+
+    //- Connect
+
+    /// @brief Connects the sender to a receiver
+    /// @tparam Receiver receiver type
+    /// @param receiver receiver notified on completion
+    /// @return operation state
+    template < class Receiver >
+    [[nodiscard]] auto connect( Receiver&& receiver ) &&
+    {
+      return ::std::move( this->sender_ ).connect( receiver_type< ::std::decay_t<Receiver> > { ::std::forward<Receiver>( receiver ), ::std::move( this->function_ ) } );
+    }
+
+  private:
+    //- Types
+
+    /// @brief Receiver which invokes the function and forwards its result
+    template < class Receiver >
+    struct receiver_type
+    {
+      Receiver receiver;
+      Function function;
+      template < class ... Values >
+      void set_value( Values&& ... values ) noexcept
+      {
+        try
+        {
+          if constexpr ( ::std::is_void_v< ::std::invoke_result_t< Function, Values ... > > )
+          {
+            ::std::invoke( ::std::move( this->function ), ::std::forward<Values>( values ) ... );
+            this->receiver.set_value();
+          }
+          else
+          {
+            this->receiver.set_value( ::std::invoke( ::std::move( this->function ), ::std::forward<Values>( values ) ... ) );
+          }
+        }
+        catch ( ... ) { this->receiver.set_error( ::std::current_exception() ); }
+      }
+      void set_error( ::std::exception_ptr error ) noexcept { this->receiver.set_error( ::std::move( error ) ); }
+      void set_stopped() noexcept { this->receiver.set_stopped(); }
+    };
+
+    //- Data
+
+    /// @brief predecessor sender
+    Sender   sender_;
+    /// @brief function applied to the values of the predecessor
+    Function function_;
+};
+
+/// @brief Sender which completes once all of its senders complete. The values of all senders are
+///        sent together in order. If any sender fails, then the first error is sent once all
+///        senders have completed.
+/// @tparam Senders senders
+template < class ... Senders >
+class when_all_sender
+{
+  public:
+    //- Types
+
+    /// @brief Values sent on completion
+    using value_types = decltype( ::std::tuple_cat( ::std::declval< typename Senders::value_types >() ... ) );
+
+    //- Constructors
+
+    /// @brief Constructs a sender from the senders to be awaited
+    /// @param senders senders
+    constexpr explicit when_all_sender( Senders ... senders ) :
+      senders_( ::std::move( senders ) ... ) { }
+
+    //- Connect
+
+    /// @brief Connects the sender to a receiver
+    /// @tparam Receiver receiver type
+    /// @param receiver receiver notified on completion
+    /// @return operation state
+    template < class Receiver >
+    [[nodiscard]] auto connect( Receiver&& receiver ) &&
+    {
+      return operation< ::std::decay_t<Receiver>, ::std::index_sequence_for< Senders ... > >( ::std::move( this->senders_ ), ::std::forward<Receiver>( receiver ) );
+    }
+
+  private:
+    //- Types
+
+    template < class Receiver, class Indices >
+    class operation;
+    /// @brief Operation state which starts every sender and counts their completions
+    template < class Receiver, ::std::size_t ... Indices >
+    class operation< Receiver, ::std::index_sequence< Indices ... > > :
+      private detail::when_all_child< Indices, Senders, operation< Receiver, ::std::index_sequence< Indices ... > > > ...
+    {
+      public:
+        operation( ::std::tuple< Senders ... >&& senders, Receiver&& receiver ) :
+          detail::when_all_child< Indices, Senders, operation >( ::std::get<Indices>( ::std::move( senders ) ), this ) ...,
+          receiver_( ::std::move( receiver ) ),
+          remaining_( sizeof...( Senders ) ) { }
+        operation( const operation& )              = delete;
+        operation( operation&& )                   = delete;
+        operation& operator = ( const operation& ) = delete;
+        operation& operator = ( operation&& )      = delete;
+        void start() noexcept
+        {
+          if constexpr ( sizeof...( Senders ) == 0 )
+          {
+            this->receiver_.set_value();
+          }
+          else
+          {
+            ( static_cast< detail::when_all_child< Indices, Senders, operation >& >( *this ).operation.start(), ... );
+          }
+        }
+        template < ::std::size_t Index, class ... Values >
+        void set_child_value( Values&& ... values ) noexcept
+        {
+          try { ::std::get<Index>( this->values_ ).emplace( ::std::forward<Values>( values ) ... ); }
+          catch ( ... ) { this->record( completion::error, ::std::current_exception() ); }
+          this->arrive();
+        }
+        void set_child_error( ::std::exception_ptr error ) noexcept
+        {
+          this->record( completion::error, ::std::move( error ) );
+          this->arrive();
+        }
+        void set_child_stopped() noexcept
+        {
+          this->record( completion::stopped, nullptr );
+          this->arrive();
+        }
+      private:
+        enum class completion { value, error, stopped };
+        void record( completion result, ::std::exception_ptr error ) noexcept
+        {
+          ::std::lock_guard< ::std::mutex > lock( this->mutex_ );
+          if ( this->result_ == completion::value )
+          {
+            this->result_ = result;
+            this->error_  = ::std::move( error );
+          }
+        }
+        void arrive() noexcept
+        {
+          if ( this->remaining_.fetch_sub( 1, ::std::memory_order_acq_rel ) != 1 )
+          {
+            return;
+          }
+          // The last sender to complete notifies the receiver
+          if ( this->result_ == completion::error )
+          {
+            this->receiver_.set_error( ::std::move( this->error_ ) );
+          }
+          else if ( this->result_ == completion::stopped )
+          {
+            this->receiver_.set_stopped();
+          }
+          else
+          {
+            ::std::apply( [this]( auto&& ... values ) { this->receiver_.set_value( ::std::forward<decltype(values)>( values ) ... ); },
+                          ::std::tuple_cat( ::std::move( *::std::get<Indices>( this->values_ ) ) ... ) );
+          }
+        }
+        Receiver                                                           receiver_;
+        ::std::atomic< ::std::size_t >                                     remaining_;
+        ::std::mutex                                                       mutex_;
+        completion                                                         result_ = completion::value;
+        ::std::exception_ptr                                               error_;
+        ::std::tuple< ::std::optional< typename Senders::value_types > ... > values_;
+    };
+
+    //- Data
+
+    /// @brief senders to be awaited
+    ::std::tuple< Senders ... > senders_;
+};
+
+/// @brief Pipeable closure returned by then( function )
+/// @tparam Function function applied to the values of the predecessor
+template < class Function >
+struct then_closure
+{
+  Function function;
+};
+
+/// @brief Returns a sender which completes on a worker thread of the scheduler's pool
+/// @param scheduler scheduler
+/// @return schedule sender
+[[nodiscard]] inline schedule_sender schedule( const thread_pool_scheduler& scheduler )
+{
+  return scheduler.schedule();
+}
+
+/// @brief Returns a sender which completes inline with the specified values
+/// @tparam Values types of values sent
+/// @param values values to be sent
+/// @return just sender
+template < class ... Values >
+[[nodiscard]] constexpr just_sender< ::std::decay_t<Values> ... > just( Values&& ... values )
+{
+  return just_sender< ::std::decay_t<Values> ... >( ::std::tuple< ::std::decay_t<Values> ... >( ::std::forward<Values>( values ) ... ) );
+}
+
+/// @brief Returns a sender which invokes function on the values of sender and sends its result.
+///        The function runs on the thread which completed the predecessor.
+/// @tparam Sender predecessor sender
+/// @tparam Function function invocable with the values of the predecessor
+/// @param sender predecessor sender
+/// @param function function
+/// @return then sender
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Sender, class Function > requires detail::is_sender_v<Sender>
+#else
+template < class Sender, class Function, typename = ::std::enable_if_t< detail::is_sender_v<Sender> > >
+#endif
+[[nodiscard]] constexpr then_sender< ::std::decay_t<Sender>, ::std::decay_t<Function> > then( Sender&& sender, Function&& function )
+{
+  return then_sender< ::std::decay_t<Sender>, ::std::decay_t<Function> >( ::std::forward<Sender>( sender ), ::std::forward<Function>( function ) );
+}
+
+/// @brief Returns a closure which may be piped from a sender, i.e. sender | then( function )
+/// @tparam Function function invocable with the values of the predecessor
+/// @param function function
+/// @return then closure
+template < class Function >
+[[nodiscard]] constexpr then_closure< ::std::decay_t<Function> > then( Function&& function )
+{
+  return then_closure< ::std::decay_t<Function> > { ::std::forward<Function>( function ) };
+}
+
+/// @brief Returns then( sender, closure.function )
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Sender, class Function > requires detail::is_sender_v<Sender>
+#else
+template < class Sender, class Function, typename = ::std::enable_if_t< detail::is_sender_v<Sender> > >
+#endif
+[[nodiscard]] constexpr auto operator | ( Sender&& sender, then_closure<Function> closure )
+{
+  return then( ::std::forward<Sender>( sender ), ::std::move( closure.function ) );
+}
+
+/// @brief Returns a sender which completes once all of the senders complete
+/// @tparam Senders senders
+/// @param senders senders
+/// @return when all sender
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class ... Senders > requires ( detail::is_sender_v<Senders> && ... )
+#else
+template < class ... Senders, typename = ::std::enable_if_t< ( detail::is_sender_v<Senders> && ... ) > >
+#endif
+[[nodiscard]] constexpr when_all_sender< ::std::decay_t<Senders> ... > when_all( Senders&& ... senders )
+{
+  return when_all_sender< ::std::decay_t<Senders> ... >( ::std::forward<Senders>( senders ) ... );
+}
+
+/// @brief Starts the sender and blocks the calling thread until it completes. Must not be called
+///        from a worker of the pool the sender completes on.
+/// @tparam Sender sender
+/// @param sender sender
+/// @return the values sent, or an empty optional if the sender was stopped
+/// @throws the exception sent on error
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Sender > requires detail::is_sender_v<Sender>
+#else
+template < class Sender, typename = ::std::enable_if_t< detail::is_sender_v<Sender> > >
+#endif
+[[nodiscard]] ::std::optional< typename ::std::decay_t<Sender>::value_types > sync_wait( Sender&& sender )
+{
+  using state_type = detail::sync_wait_state< typename ::std::decay_t<Sender>::value_types >;
+  state_type state;
+  auto operation = ::std::decay_t<Sender>( ::std::forward<Sender>( sender ) ).connect( typename state_type::receiver_type { &state } );
+  operation.start();
+  {
+    ::std::unique_lock< ::std::mutex > lock( state.mutex );
+    state.cv.wait( lock, [&state]() { return state.done; } );
+  }
+  if ( state.error ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( state.error );
+  }
+  return ::std::move( state.values );
+}
+
+//=================================================================================================
+//  Asynchronous operations
+//
+//  Each operation returns a sender which, once started, computes the result on the scheduler's
+//  pool, writes it into the caller-owned result and sends a reference to the result. The operands
+//  and result must outlive the operation. Sizes are verified when the operation runs; if they are
+//  incompatable, then std::length_error is sent as an error. The result of a product must not
+//  alias either operand.
+//=================================================================================================
+
+/// @brief Returns a sender which computes result = -t
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::tensor_data T, concepts::tensor_data R >
+#else
+template < class T, class R, typename = ::std::enable_if_t< concepts::tensor_data_v<T> && concepts::tensor_data_v<R> > >
+#endif
+[[nodiscard]] auto negate( const thread_pool_scheduler& scheduler, const T& t, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &t, &result ]() -> R&
+               {
+                 if ( result.size() != t.size() ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( []( auto&& r, auto&& a ) { r = -a; }, policy, result.underlying_span(), t.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = t1 + t2
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::tensor_data T1, concepts::tensor_data T2, concepts::tensor_data R >
+#else
+template < class T1, class T2, class R, typename = ::std::enable_if_t< concepts::tensor_data_v<T1> && concepts::tensor_data_v<T2> && concepts::tensor_data_v<R> > >
+#endif
+[[nodiscard]] auto add( const thread_pool_scheduler& scheduler, const T1& t1, const T2& t2, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &t1, &t2, &result ]() -> R&
+               {
+                 if ( ( t1.size() != t2.size() ) || ( result.size() != t1.size() ) ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( []( auto&& r, auto&& a, auto&& b ) { r = a + b; }, policy, result.underlying_span(), t1.span(), t2.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = t1 - t2
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::tensor_data T1, concepts::tensor_data T2, concepts::tensor_data R >
+#else
+template < class T1, class T2, class R, typename = ::std::enable_if_t< concepts::tensor_data_v<T1> && concepts::tensor_data_v<T2> && concepts::tensor_data_v<R> > >
+#endif
+[[nodiscard]] auto subtract( const thread_pool_scheduler& scheduler, const T1& t1, const T2& t2, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &t1, &t2, &result ]() -> R&
+               {
+                 if ( ( t1.size() != t2.size() ) || ( result.size() != t1.size() ) ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( []( auto&& r, auto&& a, auto&& b ) { r = a - b; }, policy, result.underlying_span(), t1.span(), t2.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = s * t
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class S, concepts::tensor_data T, concepts::tensor_data R > requires ( !concepts::tensor_data<S> )
+#else
+template < class S, class T, class R, typename = ::std::enable_if_t< !concepts::tensor_data_v<S> && concepts::tensor_data_v<T> && concepts::tensor_data_v<R> > >
+#endif
+[[nodiscard]] auto prod( const thread_pool_scheduler& scheduler, const S& s, const T& t, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &s, &t, &result ]() -> R&
+               {
+                 if ( result.size() != t.size() ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( [&s]( auto&& r, auto&& a ) { r = s * a; }, policy, result.underlying_span(), t.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = t * s
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::tensor_data T, class S, concepts::tensor_data R > requires ( !concepts::tensor_data<S> )
+#else
+template < class T, class S, class R, typename = ::std::enable_if_t< concepts::tensor_data_v<T> && !concepts::tensor_data_v<S> && concepts::tensor_data_v<R> >, typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] auto prod( const thread_pool_scheduler& scheduler, const T& t, const S& s, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &t, &s, &result ]() -> R&
+               {
+                 if ( result.size() != t.size() ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( [&s]( auto&& r, auto&& a ) { r = a * s; }, policy, result.underlying_span(), t.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = t / s
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::tensor_data T, class S, concepts::tensor_data R > requires ( !concepts::tensor_data<S> )
+#else
+template < class T, class S, class R, typename = ::std::enable_if_t< concepts::tensor_data_v<T> && !concepts::tensor_data_v<S> && concepts::tensor_data_v<R> > >
+#endif
+[[nodiscard]] auto divide( const thread_pool_scheduler& scheduler, const T& t, const S& s, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &t, &s, &result ]() -> R&
+               {
+                 if ( result.size() != t.size() ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Tensor sizes are incompatable." );
+                 }
+                 detail::apply_all_elementwise( [&s]( auto&& r, auto&& a ) { r = a / s; }, policy, result.underlying_span(), t.span() );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = m1 * m2
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::matrix_data M1, concepts::matrix_data M2, concepts::matrix_data R >
+#else
+template < class M1, class M2, class R, typename = ::std::enable_if_t< concepts::matrix_data_v<M1> && concepts::matrix_data_v<M2> && concepts::matrix_data_v<R> >, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] auto prod( const thread_pool_scheduler& scheduler, const M1& m1, const M2& m2, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &m1, &m2, &result ]() -> R&
+               {
+                 if ( ( m1.size().extent(1) != m2.size().extent(0) ) ||
+                      ( result.size().extent(0) != m1.size().extent(0) ) ||
+                      ( result.size().extent(1) != m2.size().extent(1) ) ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Matrix sizes are incompatable." );
+                 }
+                 detail::matrix_product_into( result, m1, m2, policy );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = m * v
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::matrix_data M, concepts::vector_data V, concepts::vector_data R >
+#else
+template < class M, class V, class R, typename = ::std::enable_if_t< concepts::matrix_data_v<M> && concepts::vector_data_v<V> && concepts::vector_data_v<R> >, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] auto prod( const thread_pool_scheduler& scheduler, const M& m, const V& v, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &m, &v, &result ]() -> R&
+               {
+                 if ( ( m.size().extent(1) != v.size().extent(0) ) || ( result.size().extent(0) != m.size().extent(0) ) ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Matrix and vector sizes are incompatable." );
+                 }
+                 detail::matrix_vector_product_into( result, m, v, policy );
+                 return result;
+               } );
+}
+
+/// @brief Returns a sender which computes result = v * m
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::vector_data V, concepts::matrix_data M, concepts::vector_data R >
+#else
+template < class V, class M, class R, typename = ::std::enable_if_t< concepts::vector_data_v<V> && concepts::matrix_data_v<M> && concepts::vector_data_v<R> >, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true>, typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] auto prod( const thread_pool_scheduler& scheduler, const V& v, const M& m, R& result )
+{
+  return then( scheduler.schedule(),
+               [ policy = scheduler.policy(), &v, &m, &result ]() -> R&
+               {
+                 if ( ( v.size().extent(0) != m.size().extent(0) ) || ( result.size().extent(0) != m.size().extent(1) ) ) LINALG_UNLIKELY
+                 {
+                   throw length_error( "Matrix and vector sizes are incompatable." );
+                 }
+                 detail::vector_matrix_product_into( result, v, m, policy );
+                 return result;
+               } );
+}
+
+//------------------------------------------
+// Implementation of schedule_sender
+//------------------------------------------
+
+constexpr schedule_sender::schedule_sender( thread_pool& pool ) noexcept :
+  pool_( &pool )
+{
+}
+
+template < class Receiver >
+[[nodiscard]] auto schedule_sender::connect( Receiver&& receiver ) &&
+{
+  return operation< ::std::decay_t<Receiver> > { this->pool_, ::std::forward<Receiver>( receiver ) };
+}
+
+//------------------------------------------
+// Implementation of thread_pool_scheduler
+//------------------------------------------
+
+constexpr thread_pool_scheduler::thread_pool_scheduler( thread_pool& pool ) noexcept :
+  pool_( &pool )
+{
+}
+
+[[nodiscard]] inline thread_pool& thread_pool_scheduler::pool() const
+{
+  return this->pool_ ? *this->pool_ : thread_pool::default_pool();
+}
+
+[[nodiscard]] inline thread_pool_policy thread_pool_scheduler::policy() const
+{
+  return thread_pool_policy( this->pool() );
+}
+
+[[nodiscard]] inline schedule_sender thread_pool_scheduler::schedule() const
+{
+  return schedule_sender( this->pool() );
+}
+
+}       //- async_operations namespace
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_ASYNC_OPERATIONS_HPP
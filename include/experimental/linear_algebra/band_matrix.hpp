@@ -0,0 +1,824 @@
+//==================================================================================================
+//  File:       band_matrix.hpp
+//
+//  Summary:    This header defines a banded matrix stored in the LAPACK band layout, together with
+//              a banded matrix-vector product and banded solvers. Storage, products, and the
+//              LU solve cost O(n (kl + ku + 1)) rather than O(n^2); tridiagonal systems may also be
+//              solved in parallel by cyclic reduction.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BAND_MATRIX_HPP
+#define LINEAR_ALGEBRA_BAND_MATRIX_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Minimum number of band elements assigned to each parallel task of a banded kernel
+#ifndef LINALG_BAND_TASK_ELEMENTS
+#  define LINALG_BAND_TASK_ELEMENTS 16384
+#endif
+
+// Minimum number of rows of each independent system which cyclic reduction splits a tridiagonal system into
+#ifndef LINALG_CYCLIC_REDUCTION_ROWS
+#  define LINALG_CYCLIC_REDUCTION_ROWS 4096
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Band Task Count returns the number of parallel tasks used by a banded kernel over the given
+//  number of band elements
+//==================================================================================================
+[[nodiscard]] inline ::std::size_t band_task_count( ::std::size_t elements )
+{
+  return ::std::max< ::std::size_t >( ::std::min< ::std::size_t >( 4 * thread_pool::default_pool().thread_count(),
+                                                                   elements / LINALG_BAND_TASK_ELEMENTS ), 1 );
+}
+
+//==================================================================================================
+//  Band For Each applies the lambda expression to ranges of indices [first, last) covering
+//  [0, size), one range per task, processed on the thread pool when there is more than one task
+//==================================================================================================
+template < class Lambda >
+inline void band_for_each( ::std::size_t size, ::std::size_t count, Lambda&& lambda )
+{
+  if ( count == 1 )
+  {
+    lambda( ::std::size_t( 0 ), size );
+  }
+  else
+  {
+    for_each( LINALG_EXECUTION_PAR,
+              faux_index_iterator< ::std::size_t >( 0 ),
+              faux_index_iterator< ::std::size_t >( count ),
+              [size,count,&lambda]( ::std::size_t p )
+              {
+                const auto [ first, last ] = thread_pool::partition( size, p, count );
+                lambda( first, last );
+              } );
+  }
+}
+
+//==================================================================================================
+//  Band LU factors the n by n band held in work, stored in the band layout with kl + (kl + ku) + 1
+//  elements per column, by Gaussian elimination with partial pivoting. Row interchanges fill in up
+//  to kl further diagonals above the band, which the work layout reserves. The multipliers of L
+//  overwrite the band below the diagonal and U the band above it; pivots[j] is the row exchanged
+//  with row j. Every column is eliminated with contiguous accesses.
+//==================================================================================================
+template < class T >
+inline void band_lu_factor( T* work, ::std::size_t* pivots, ::std::size_t n, ::std::size_t kl, ::std::size_t ku )
+{
+  const ::std::size_t upper = kl + ku;
+  const ::std::size_t ld    = kl + upper + 1;
+  // Element (i, j) of the factored band
+  auto at = [work,ld,upper]( ::std::size_t i, ::std::size_t j ) -> T& { return work[ j * ld + upper + i - j ]; };
+  for ( ::std::size_t j = 0; j < n; ++j )
+  {
+    const ::std::size_t last_row    = ::std::min( n - 1, j + kl );
+    const ::std::size_t last_column = ::std::min( n - 1, j + upper );
+    ::std::size_t       pivot       = j;
+    for ( ::std::size_t i = j + 1; i <= last_row; ++i )
+    {
+      if ( ::std::abs( at( i, j ) ) > ::std::abs( at( pivot, j ) ) )
+      {
+        pivot = i;
+      }
+    }
+    pivots[j] = pivot;
+    if ( at( pivot, j ) == T {} )
+    {
+      throw domain_error( "Matrix is singular." );
+    }
+    if ( pivot != j )
+    {
+      for ( ::std::size_t k = j; k <= last_column; ++k )
+      {
+        ::std::swap( at( j, k ), at( pivot, k ) );
+      }
+    }
+    const T diagonal = at( j, j );
+    for ( ::std::size_t i = j + 1; i <= last_row; ++i )
+    {
+      at( i, j ) /= diagonal;
+    }
+    for ( ::std::size_t k = j + 1; k <= last_column; ++k )
+    {
+      const T value = at( j, k );
+      if ( value != T {} )
+      {
+        for ( ::std::size_t i = j + 1; i <= last_row; ++i )
+        {
+          at( i, k ) -= at( i, j ) * value;
+        }
+      }
+    }
+  }
+}
+
+//==================================================================================================
+//  Band LU Solve overwrites the n by width right hand side, accessed through rhs( i, l ), with the
+//  solution, given the factorization computed by band_lu_factor
+//==================================================================================================
+template < class T, class Rhs >
+inline void band_lu_solve( const T* work, const ::std::size_t* pivots, ::std::size_t n, ::std::size_t kl, ::std::size_t ku,
+                           ::std::size_t width, Rhs&& rhs )
+{
+  const ::std::size_t upper = kl + ku;
+  const ::std::size_t ld    = kl + upper + 1;
+  auto at = [work,ld,upper]( ::std::size_t i, ::std::size_t j ) -> const T& { return work[ j * ld + upper + i - j ]; };
+  // Apply the interchanges and L, column by column
+  for ( ::std::size_t j = 0; j < n; ++j )
+  {
+    if ( pivots[j] != j )
+    {
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        ::std::swap( rhs( j, l ), rhs( pivots[j], l ) );
+      }
+    }
+    const ::std::size_t last_row = ::std::min( n - 1, j + kl );
+    for ( ::std::size_t i = j + 1; i <= last_row; ++i )
+    {
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        rhs( i, l ) -= at( i, j ) * rhs( j, l );
+      }
+    }
+  }
+  // Back substitute U, column by column
+  for ( ::std::size_t j = n; j-- > 0; )
+  {
+    for ( ::std::size_t l = 0; l < width; ++l )
+    {
+      rhs( j, l ) /= at( j, j );
+    }
+    for ( ::std::size_t i = ( j > upper ) ? j - upper : 0; i < j; ++i )
+    {
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        rhs( i, l ) -= at( i, j ) * rhs( j, l );
+      }
+    }
+  }
+}
+
+//==================================================================================================
+//  Band Solve solves the square band matrix m for the n by width right hand side accessed through
+//  rhs( i, l ), overwriting it with the solution
+//==================================================================================================
+template < class M, class Rhs >
+inline void band_solve( const M& m, ::std::size_t width, Rhs&& rhs )
+{
+  using value_type = typename M::value_type;
+  using work_type  = ::std::vector< value_type, typename ::std::allocator_traits<typename M::allocator_type>::template rebind_alloc<value_type> >;
+  using pivot_type = ::std::vector< ::std::size_t, typename ::std::allocator_traits<typename M::allocator_type>::template rebind_alloc< ::std::size_t > >;
+  const ::std::size_t n     = m.rows();
+  const ::std::size_t kl    = m.lower_bandwidth();
+  const ::std::size_t ku    = m.upper_bandwidth();
+  const ::std::size_t ld    = 2 * kl + ku + 1;
+  const value_type*   band  = m.underlying_span().data_handle();
+  // Copy the band below the kl diagonals reserved for fill-in
+  work_type  work( n * ld, value_type {}, typename work_type::allocator_type( m.get_allocator() ) );
+  pivot_type pivots( n, ::std::size_t( 0 ), typename pivot_type::allocator_type( m.get_allocator() ) );
+  for ( ::std::size_t j = 0; j < n; ++j )
+  {
+    ::std::copy_n( band + j * ( kl + ku + 1 ), kl + ku + 1, work.data() + j * ld + kl );
+  }
+  band_lu_factor( work.data(), pivots.data(), n, kl, ku );
+  band_lu_solve( static_cast<const value_type*>( work.data() ), static_cast<const ::std::size_t*>( pivots.data() ), n, kl, ku, width, rhs );
+}
+
+}       //- detail namespace
+
+/// @brief Matrix storing only the diagonals within a lower and an upper bandwidth, in the LAPACK
+///        band layout described by layout_blas_banded. Elements outside of the band are zero.
+//         Implementation satisfies the following concepts:
+//         concepts::matrix_data
+//         Element access returns values; the band is written through underlying_span().
+//         Row, column, and submatrix views are not provided as the band mapping is not unique.
+/// @tparam T     element_type
+/// @tparam Alloc allocator_type
+template < class T, class Alloc >
+class band_matrix
+{
+  public:
+    //- Types
+
+    /// @brief Type used to define memory layout
+    using layout_type                = layout_blas_banded;
+    /// @brief Type of elements
+    using element_type               = T;
+    /// @brief Type returned by const index access
+    using value_type                 = ::std::remove_cv_t<element_type>;
+    /// @brief Type of allocator used to get memory
+    using allocator_type             = Alloc;
+    /// @brief Type used for indexing
+    using index_type                 = ::std::ptrdiff_t;
+    /// @brief Type used for size along any dimension
+    using size_type                  = ::std::size_t;
+    /// @brief Type used to express size of matrix
+    using extents_type               = ::std::experimental::extents<size_type,dynamic_extent,dynamic_extent>;
+    /// @brief Type used to represent a node in the matrix
+    using tuple_type                 = ::std::tuple<index_type,index_type>;
+    /// @brief Type used to view the band; indices outside of it alias other elements
+    using underlying_span_type       = ::std::experimental::mdspan<element_type,extents_type,layout_type>;
+    /// @brief Type used to const view the band; indices outside of it alias other elements
+    using const_underlying_span_type = ::std::experimental::mdspan<const element_type,extents_type,layout_type>;
+    /// @brief Type of a reference to a stored element
+    using reference                  = element_type&;
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Default destructor
+    ~band_matrix()                            = default;
+    /// @brief Default constructor
+    band_matrix()                             = default;
+    /// @brief Default move constructor
+    band_matrix( band_matrix&& )              = default;
+    /// @brief Default copy constructor
+    band_matrix( const band_matrix& )         = default;
+    /// @brief Constructs a zero matrix of the specified size and bandwidths
+    /// @param s     number of rows and columns
+    /// @param lower number of stored diagonals below the main diagonal
+    /// @param upper number of stored diagonals above the main diagonal
+    band_matrix( extents_type s, size_type lower, size_type upper );
+    /// @brief Constructs a zero matrix of the specified size and bandwidths
+    /// @param s     number of rows and columns
+    /// @param lower number of stored diagonals below the main diagonal
+    /// @param upper number of stored diagonals above the main diagonal
+    /// @param alloc allocator used to construct with
+    band_matrix( extents_type s, size_type lower, size_type upper, const allocator_type& alloc );
+    /// @brief Constructs by applying lambda to every element within the band
+    /// @tparam Lambda lambda expression with an operator()( index1, index2 ) defined
+    /// @param s      number of rows and columns
+    /// @param lower  number of stored diagonals below the main diagonal
+    /// @param upper  number of stored diagonals above the main diagonal
+    /// @param lambda lambda expression to be performed on each element within the band
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    band_matrix( extents_type s, size_type lower, size_type upper, Lambda&& lambda )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs by applying lambda to every element within the band
+    /// @tparam Lambda lambda expression with an operator()( index1, index2 ) defined
+    /// @param s      number of rows and columns
+    /// @param lower  number of stored diagonals below the main diagonal
+    /// @param upper  number of stored diagonals above the main diagonal
+    /// @param lambda lambda expression to be performed on each element within the band
+    /// @param alloc  allocator used to construct with
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    band_matrix( extents_type s, size_type lower, size_type upper, Lambda&& lambda, const allocator_type& alloc )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs from the band of a dense matrix; elements outside of the band are not read
+    /// @tparam M dense matrix type
+    /// @param m     matrix to be stored
+    /// @param lower number of stored diagonals below the main diagonal
+    /// @param upper number of stored diagonals above the main diagonal
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class M >
+      requires detail::is_dense_matrix_v<M>
+    #else
+    template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+    #endif
+    band_matrix( const M& m, size_type lower, size_type upper );
+    /// @brief Default move assignment
+    band_matrix& operator = ( band_matrix&& )      = default;
+    /// @brief Default copy assignment
+    band_matrix& operator = ( const band_matrix& ) = default;
+
+    //- Size / Capacity
+
+    /// @brief Returns the current number of (rows, columns)
+    [[nodiscard]] constexpr extents_type size() const noexcept;
+    /// @brief Returns the current capacity of (rows, columns), which is always the size
+    [[nodiscard]] constexpr extents_type capacity() const noexcept;
+    /// @brief Returns the current number of columns
+    [[nodiscard]] constexpr size_type columns() const noexcept;
+    /// @brief Returns the current number of rows
+    [[nodiscard]] constexpr size_type rows() const noexcept;
+    /// @brief Returns the current column capacity
+    [[nodiscard]] constexpr size_type column_capacity() const noexcept;
+    /// @brief Returns the current row capacity
+    [[nodiscard]] constexpr size_type row_capacity() const noexcept;
+    /// @brief Returns the number of stored diagonals below the main diagonal
+    [[nodiscard]] constexpr size_type lower_bandwidth() const noexcept;
+    /// @brief Returns the number of stored diagonals above the main diagonal
+    [[nodiscard]] constexpr size_type upper_bandwidth() const noexcept;
+
+    //- Const views
+
+    /// @brief Returns the value at (i, j) without index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, which is zero outside of the band
+    #if LINALG_USE_BRACKET_OPERATOR
+    [[nodiscard]] value_type operator[]( index_type i, index_type j ) const noexcept;
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    [[nodiscard]] value_type operator()( index_type i, index_type j ) const noexcept;
+    #endif
+    /// @brief Returns the value at (i, j) with index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, which is zero outside of the band
+    /// @throws out_of_range if (i, j) is outside the matrix
+    [[nodiscard]] value_type at( index_type i, index_type j ) const;
+    /// @brief Returns a const view of the band
+    [[nodiscard]] const_underlying_span_type underlying_span() const noexcept;
+
+    //- Mutable views
+
+    /// @brief Returns a mutable view of the band
+    [[nodiscard]] underlying_span_type underlying_span() noexcept;
+
+    //- Allocator
+
+    /// @brief Returns a copy of the allocator used to get memory
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+  private:
+    //- Private functions
+
+    // Returns the value at (i, j), which is zero outside of the band
+    [[nodiscard]] value_type element( index_type i, index_type j ) const noexcept;
+
+    //- Data
+
+    // Mapping of the band, holding the size and the bandwidths
+    typename layout_type::template mapping<extents_type> mapping_;
+    // Band, column by column
+    ::std::vector<element_type,allocator_type>           elems_;
+};
+
+//==================================================================================================
+//                                  I M P L E M E N T A T I O N
+//==================================================================================================
+
+//- Destructor / Constructors / Assignments
+
+template < class T, class Alloc >
+band_matrix<T,Alloc>::band_matrix( extents_type s, size_type lower, size_type upper ) :
+  band_matrix( s, lower, upper, allocator_type() )
+{
+}
+
+template < class T, class Alloc >
+band_matrix<T,Alloc>::band_matrix( extents_type s, size_type lower, size_type upper, const allocator_type& alloc ) :
+  mapping_( s, lower, upper ),
+  elems_( alloc )
+{
+  this->elems_.assign( static_cast<size_type>( this->mapping_.required_span_size() ), value_type {} );
+}
+
+template < class T, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+band_matrix<T,Alloc>::band_matrix( extents_type s, size_type lower, size_type upper, Lambda&& lambda )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename band_matrix<T,Alloc>::index_type>(),
+                                                    ::std::declval<typename band_matrix<T,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename band_matrix<T,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  band_matrix( s, lower, upper, ::std::forward<Lambda>( lambda ), allocator_type() )
+{
+}
+
+template < class T, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+band_matrix<T,Alloc>::band_matrix( extents_type s, size_type lower, size_type upper, Lambda&& lambda, const allocator_type& alloc )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename band_matrix<T,Alloc>::index_type>(),
+                                                    ::std::declval<typename band_matrix<T,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename band_matrix<T,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  band_matrix( s, lower, upper, alloc )
+{
+  // Fill column by column, in storage order
+  for ( size_type j = 0; j < this->columns(); ++j )
+  {
+    const size_type last_row = ::std::min( this->rows(), j + lower + 1 );
+    for ( size_type i = ( j > upper ) ? j - upper : 0; i < last_row; ++i )
+    {
+      this->elems_[ static_cast<size_type>( this->mapping_( i, j ) ) ] = lambda( static_cast<index_type>( i ), static_cast<index_type>( j ) );
+    }
+  }
+}
+
+template < class T, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, typename >
+#endif
+band_matrix<T,Alloc>::band_matrix( const M& m, size_type lower, size_type upper ) :
+  band_matrix( extents_type( m.rows(), m.columns() ), lower, upper,
+               [&m]( index_type i, index_type j ) { return static_cast<element_type>( detail::access( m, i, j ) ); } )
+{
+}
+
+//- Size / Capacity
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::extents_type
+band_matrix<T,Alloc>::size() const noexcept
+{
+  return this->mapping_.extents();
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::extents_type
+band_matrix<T,Alloc>::capacity() const noexcept
+{
+  return this->mapping_.extents();
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::columns() const noexcept
+{
+  return this->mapping_.extents().extent(1);
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::rows() const noexcept
+{
+  return this->mapping_.extents().extent(0);
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::column_capacity() const noexcept
+{
+  return this->mapping_.extents().extent(1);
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::row_capacity() const noexcept
+{
+  return this->mapping_.extents().extent(0);
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::lower_bandwidth() const noexcept
+{
+  return this->mapping_.lower_bandwidth();
+}
+
+template < class T, class Alloc >
+[[nodiscard]] constexpr typename band_matrix<T,Alloc>::size_type
+band_matrix<T,Alloc>::upper_bandwidth() const noexcept
+{
+  return this->mapping_.upper_bandwidth();
+}
+
+//- Const views
+
+#if LINALG_USE_BRACKET_OPERATOR
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::value_type
+band_matrix<T,Alloc>::operator[]( index_type i, index_type j ) const noexcept
+{
+  return this->element( i, j );
+}
+#endif
+
+#if LINALG_USE_PAREN_OPERATOR
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::value_type
+band_matrix<T,Alloc>::operator()( index_type i, index_type j ) const noexcept
+{
+  return this->element( i, j );
+}
+#endif
+
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::value_type
+band_matrix<T,Alloc>::at( index_type i, index_type j ) const
+{
+  // Negative indices convert to sizes beyond any extent
+  if ( ( static_cast<size_type>( i ) >= this->rows() ) || ( static_cast<size_type>( j ) >= this->columns() ) )
+  {
+    throw out_of_range( "Index is outside of the matrix." );
+  }
+  return this->element( i, j );
+}
+
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::const_underlying_span_type
+band_matrix<T,Alloc>::underlying_span() const noexcept
+{
+  return const_underlying_span_type( this->elems_.data(), this->mapping_ );
+}
+
+//- Mutable views
+
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::underlying_span_type
+band_matrix<T,Alloc>::underlying_span() noexcept
+{
+  return underlying_span_type( this->elems_.data(), this->mapping_ );
+}
+
+//- Allocator
+
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::allocator_type
+band_matrix<T,Alloc>::get_allocator() const noexcept
+{
+  return this->elems_.get_allocator();
+}
+
+//- Private functions
+
+template < class T, class Alloc >
+[[nodiscard]] typename band_matrix<T,Alloc>::value_type
+band_matrix<T,Alloc>::element( index_type i, index_type j ) const noexcept
+{
+  if ( ( i - j > static_cast<index_type>( this->lower_bandwidth() ) ) || ( j - i > static_cast<index_type>( this->upper_bandwidth() ) ) )
+  {
+    return value_type {};
+  }
+  return this->elems_[ static_cast<size_type>( this->mapping_( i, j ) ) ];
+}
+
+//==================================================================================================
+//  Band matrix arithmetic
+//==================================================================================================
+
+/// @brief Returns the product m x in O(rows (kl + ku + 1)) operations. Rows are split across the
+///        thread pool for large bands; each task accumulates its rows column by column, reading
+///        the contiguous part of each stored column which falls within its rows.
+/// @throws length_error if the sizes of m and x are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto
+operator * ( const band_matrix<T,Alloc>& m, const V& x )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename V::value_type>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( x.size().extent(0) != m.columns() )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  const ::std::size_t rows  = m.rows();
+  const ::std::size_t cols  = m.columns();
+  const ::std::size_t kl    = m.lower_bandwidth();
+  const ::std::size_t ku    = m.upper_bandwidth();
+  const ::std::size_t ld    = kl + ku + 1;
+  const T*            band  = m.underlying_span().data_handle();
+  result_type y( typename result_type::extents_type( rows ), []( auto ) { return result_value_type {}; },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  detail::band_for_each( rows, detail::band_task_count( rows * ld ), [&]( ::std::size_t first, ::std::size_t last )
+  {
+    const ::std::size_t last_column = ::std::min( cols, last + ku );
+    for ( ::std::size_t j = ( first > kl ) ? first - kl : 0; j < last_column; ++j )
+    {
+      // Element (i, j) is at column[i]
+      const T*            column = band + j * ld + ku - j;
+      const auto          value  = detail::access( x, j );
+      const ::std::size_t end    = ::std::min( last, j + kl + 1 );
+      for ( ::std::size_t i = ::std::max( first, ( j > ku ) ? j - ku : 0 ); i < end; ++i )
+      {
+        detail::access( y, i ) += column[i] * value;
+      }
+    }
+  } );
+  return y;
+}
+
+/// @brief Returns x solving m x = b by banded LU factorization with partial pivoting, in
+///        O(n kl (kl + ku + 1)) operations. For tridiagonal matrices this is the Thomas algorithm
+///        with row interchanges.
+/// @throws length_error if m is not square or the sizes of m and b are incompatible
+/// @throws domain_error if m is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto solve( const band_matrix<T,Alloc>& m, const V& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename V::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( m.rows() != m.columns() ) || ( b.size().extent(0) != m.rows() ) )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  result_type x( typename result_type::extents_type( m.rows() ), [&b]( auto i ) { return result_value_type( detail::access( b, i ) ); },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  detail::band_solve( m, 1, [&x]( ::std::size_t i, ::std::size_t ) -> result_value_type& { return detail::access( x, i ); } );
+  return x;
+}
+
+/// @brief Returns x solving m x = b for every column of the dense matrix b, sharing one factorization
+/// @throws length_error if m is not square or the sizes of m and b are incompatible
+/// @throws domain_error if m is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto solve( const band_matrix<T,Alloc>& m, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( m.rows() != m.columns() ) || ( b.rows() != m.rows() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  result_type x( typename result_type::extents_type( b.rows(), b.columns() ), [&b]( auto i, auto j ) { return result_value_type( detail::access( b, i, j ) ); },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  detail::band_solve( m, b.columns(), [&x]( ::std::size_t i, ::std::size_t l ) -> result_value_type& { return detail::access( x, i, l ); } );
+  return x;
+}
+
+/// @brief Returns x solving the tridiagonal system m x = b in parallel. Steps of parallel cyclic
+///        reduction eliminate the couplings between neighbouring rows until the system splits into
+///        one independent tridiagonal system per task, over rows of equal residue; these are then
+///        solved concurrently by the Thomas algorithm. Small systems are solved by the Thomas
+///        algorithm directly. No rows are interchanged, so m should be diagonally dominant or
+///        symmetric positive definite.
+/// @throws invalid_argument if m is not tridiagonal
+/// @throws length_error if m is not square or the sizes of m and b are incompatible
+/// @throws domain_error if a zero pivot is encountered
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto cyclic_reduction_solve( const band_matrix<T,Alloc>& m, const V& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename V::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  using work_type         = ::std::vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( m.lower_bandwidth() > 1 ) || ( m.upper_bandwidth() > 1 ) )
+  {
+    throw invalid_argument( "Cyclic reduction requires a tridiagonal matrix." );
+  }
+  if ( ( m.rows() != m.columns() ) || ( b.size().extent(0) != m.rows() ) )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  const ::std::size_t n = m.rows();
+  // Number of independent systems, a power of two
+  const ::std::size_t tasks   = ::std::max< ::std::size_t >( ::std::min< ::std::size_t >( 4 * thread_pool::default_pool().thread_count(),
+                                                                                         n / LINALG_CYCLIC_REDUCTION_ROWS ), 1 );
+  ::std::size_t       systems = 1;
+  while ( systems * 2 <= tasks )
+  {
+    systems *= 2;
+  }
+  // Sub-diagonal, diagonal, super-diagonal and right hand side of each equation
+  const typename work_type::allocator_type alloc( m.get_allocator() );
+  work_type lower( n, result_value_type {}, alloc ), diagonal( n, result_value_type {}, alloc ), upper( n, result_value_type {}, alloc ), rhs( n, result_value_type {}, alloc );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    const auto row = static_cast<typename band_matrix<T,Alloc>::index_type>( i );
+    lower[i]    = ( i > 0 ) ? result_value_type( detail::access( m, row, row - 1 ) ) : result_value_type {};
+    diagonal[i] = result_value_type( detail::access( m, row, row ) );
+    upper[i]    = ( i + 1 < n ) ? result_value_type( detail::access( m, row, row + 1 ) ) : result_value_type {};
+    rhs[i]      = result_value_type( detail::access( b, i ) );
+  }
+  ::std::atomic<bool> is_singular = false;
+  // Each step couples equation i to equations i - 2 stride and i + 2 stride instead of i +- stride
+  if ( systems > 1 )
+  {
+    work_type next_lower( n, result_value_type {}, alloc ), next_diagonal( n, result_value_type {}, alloc ),
+              next_upper( n, result_value_type {}, alloc ), next_rhs( n, result_value_type {}, alloc );
+    for ( ::std::size_t stride = 1; stride < systems; stride *= 2 )
+    {
+      detail::band_for_each( n, systems, [&]( ::std::size_t first, ::std::size_t last )
+      {
+        for ( ::std::size_t i = first; i < last; ++i )
+        {
+          result_value_type k1 {}, k2 {};
+          next_lower[i]    = result_value_type {};
+          next_upper[i]    = result_value_type {};
+          next_diagonal[i] = diagonal[i];
+          next_rhs[i]      = rhs[i];
+          if ( i >= stride )
+          {
+            if ( diagonal[i-stride] == result_value_type {} )
+            {
+              is_singular = true;
+              return;
+            }
+            k1                = lower[i] / diagonal[i-stride];
+            next_lower[i]     = -lower[i-stride] * k1;
+            next_diagonal[i] -= upper[i-stride] * k1;
+            next_rhs[i]      -= rhs[i-stride] * k1;
+          }
+          if ( i + stride < n )
+          {
+            if ( diagonal[i+stride] == result_value_type {} )
+            {
+              is_singular = true;
+              return;
+            }
+            k2                = upper[i] / diagonal[i+stride];
+            next_upper[i]     = -upper[i+stride] * k2;
+            next_diagonal[i] -= lower[i+stride] * k2;
+            next_rhs[i]      -= rhs[i+stride] * k2;
+          }
+        }
+      } );
+      if ( is_singular )
+      {
+        throw domain_error( "Matrix is singular or requires pivoting." );
+      }
+      lower.swap( next_lower );
+      diagonal.swap( next_diagonal );
+      upper.swap( next_upper );
+      rhs.swap( next_rhs );
+    }
+  }
+  // Solve the independent systems over rows r, r + systems, r + 2 systems, ... by the Thomas algorithm
+  result_type x( typename result_type::extents_type( n ), []( auto ) { return result_value_type {}; },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  detail::band_for_each( systems, systems, [&]( ::std::size_t first, ::std::size_t last )
+  {
+    for ( ::std::size_t r = first; r < last; ++r )
+    {
+      // Forward elimination, reusing upper and rhs for the modified coefficients
+      ::std::size_t previous = r;
+      for ( ::std::size_t i = r; i < n; i += systems )
+      {
+        const result_value_type pivot = ( i == r ) ? diagonal[i] : diagonal[i] - lower[i] * upper[previous];
+        if ( pivot == result_value_type {} )
+        {
+          is_singular = true;
+          return;
+        }
+        upper[i] /= pivot;
+        rhs[i]    = ( ( i == r ) ? rhs[i] : rhs[i] - lower[i] * rhs[previous] ) / pivot;
+        previous  = i;
+      }
+      // Back substitution
+      if ( r < n )
+      {
+        detail::access( x, previous ) = rhs[previous];
+        for ( ::std::size_t i = previous; i >= r + systems; i -= systems )
+        {
+          detail::access( x, i - systems ) = rhs[i-systems] - upper[i-systems] * detail::access( x, i );
+        }
+      }
+    }
+  } );
+  if ( is_singular )
+  {
+    throw domain_error( "Matrix is singular or requires pivoting." );
+  }
+  return x;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_BAND_MATRIX_HPP
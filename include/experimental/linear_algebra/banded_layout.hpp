@@ -0,0 +1,146 @@
+//==================================================================================================
+//  File:       banded_layout.hpp
+//
+//  Summary:    This header defines the LAPACK band layout policy for matrices. Only the diagonals
+//              within the lower and upper bandwidths are stored, column by column, so an m by n
+//              matrix with bandwidths kl and ku occupies (kl + ku + 1) n elements.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BANDED_LAYOUT_HPP
+#define LINEAR_ALGEBRA_BANDED_LAYOUT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Layout policy storing the band of a matrix as LAPACK does. Each column is stored as
+///        kl + ku + 1 consecutive elements, with element (i, j) at row ku + i - j of column j.
+///        The mapping is strided, with strides 1 and kl + ku, and only indices within the band
+///        are meaningful: indices outside of it alias other elements, so the mapping is not unique,
+///        and the unused corners of the first and last columns make it non-exhaustive.
+struct layout_blas_banded
+{
+  /// @brief Maps indices within the band of a matrix to offsets
+  /// @tparam Extents extents of the matrix
+  template < class Extents >
+  class mapping
+  {
+    static_assert( Extents::rank() == 2, "Banded layouts describe matrices." );
+
+    public:
+      //- Types
+
+      /// @brief Type used to express the extents of the matrix
+      using extents_type = Extents;
+      /// @brief Type used for indices and offsets
+      using index_type   = typename extents_type::index_type;
+      /// @brief Type used for sizes
+      using size_type    = typename extents_type::size_type;
+      /// @brief Type used for ranks
+      using rank_type    = typename extents_type::rank_type;
+      /// @brief Layout policy of the mapping
+      using layout_type  = layout_blas_banded;
+
+      //- Constructors
+
+      /// @brief Default constructor
+      constexpr mapping() noexcept = default;
+      /// @brief Constructs the mapping of a diagonal matrix of the given extents
+      /// @param extents extents of the matrix
+      constexpr mapping( const extents_type& extents ) noexcept : extents_( extents ) { }
+      /// @brief Constructs the mapping of a banded matrix
+      /// @param extents extents of the matrix
+      /// @param lower   number of stored diagonals below the main diagonal
+      /// @param upper   number of stored diagonals above the main diagonal
+      constexpr mapping( const extents_type& extents, size_type lower, size_type upper ) noexcept :
+        extents_( extents ), lower_( lower ), upper_( upper ) { }
+      /// @brief Converting constructor from a mapping with compatible extents
+      template < class OtherExtents, typename = ::std::enable_if_t< ::std::is_constructible_v< extents_type, OtherExtents > > >
+      constexpr mapping( const mapping<OtherExtents>& rhs ) noexcept :
+        extents_( rhs.extents() ), lower_( rhs.lower_bandwidth() ), upper_( rhs.upper_bandwidth() ) { }
+
+      //- Observers
+
+      /// @brief Returns the extents of the matrix
+      [[nodiscard]] constexpr const extents_type& extents() const noexcept { return this->extents_; }
+      /// @brief Returns the number of stored diagonals below the main diagonal
+      [[nodiscard]] constexpr size_type lower_bandwidth() const noexcept { return this->lower_; }
+      /// @brief Returns the number of stored diagonals above the main diagonal
+      [[nodiscard]] constexpr size_type upper_bandwidth() const noexcept { return this->upper_; }
+      /// @brief Returns the number of elements stored for each column, kl + ku + 1
+      [[nodiscard]] constexpr size_type leading_dimension() const noexcept { return this->lower_ + this->upper_ + 1; }
+      /// @brief Returns the number of stored elements, (kl + ku + 1) n
+      [[nodiscard]] constexpr index_type required_span_size() const noexcept;
+
+      //- Mapping
+
+      /// @brief Returns the offset of the element at (i, j), which must lie within the band
+      template < class I, class J >
+      [[nodiscard]] constexpr index_type operator()( I i, J j ) const noexcept;
+
+      //- Properties
+
+      [[nodiscard]] static constexpr bool is_always_unique() noexcept     { return false; }
+      [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept { return false; }
+      [[nodiscard]] static constexpr bool is_always_strided() noexcept    { return true; }
+      [[nodiscard]] constexpr bool        is_unique() const noexcept      { return ( this->lower_ + 1 >= this->extents_.extent(0) ) && ( this->upper_ + 1 >= this->extents_.extent(1) ); }
+      [[nodiscard]] constexpr bool        is_exhaustive() const noexcept  { return ( this->lower_ == 0 ) && ( this->upper_ == 0 ); }
+      [[nodiscard]] static constexpr bool is_strided() noexcept           { return true; }
+      /// @brief Returns the distance between consecutive rows (r = 0) or columns (r = 1) of the band
+      [[nodiscard]] constexpr index_type stride( rank_type r ) const noexcept
+      {
+        return ( r == 0 ) ? index_type( 1 ) : static_cast<index_type>( this->lower_ + this->upper_ );
+      }
+
+      /// @brief Mappings are equal if their extents and bandwidths are equal
+      [[nodiscard]] friend constexpr bool operator == ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return ( lhs.extents() == rhs.extents() ) && ( lhs.lower_ == rhs.lower_ ) && ( lhs.upper_ == rhs.upper_ );
+      }
+      [[nodiscard]] friend constexpr bool operator != ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return !( lhs == rhs );
+      }
+
+    private:
+      //- Data
+
+      /// @brief Extents of the matrix
+      extents_type extents_ {};
+      /// @brief Number of stored diagonals below the main diagonal
+      size_type    lower_   = 0;
+      /// @brief Number of stored diagonals above the main diagonal
+      size_type    upper_   = 0;
+  };
+};
+
+//----------------------------------------------
+// Implementation of layout_blas_banded::mapping<Extents>
+//----------------------------------------------
+
+template < class Extents >
+[[nodiscard]] constexpr typename layout_blas_banded::template mapping<Extents>::index_type
+layout_blas_banded::mapping<Extents>::required_span_size() const noexcept
+{
+  return static_cast<index_type>( this->leading_dimension() * this->extents_.extent(1) );
+}
+
+template < class Extents >
+template < class I, class J >
+[[nodiscard]] constexpr typename layout_blas_banded::template mapping<Extents>::index_type
+layout_blas_banded::mapping<Extents>::operator()( I i, J j ) const noexcept
+{
+  // Row ku + i - j of column j; columns hold kl + ku + 1 elements
+  return static_cast<index_type>( this->upper_ ) + static_cast<index_type>( i ) +
+         static_cast<index_type>( j ) * static_cast<index_type>( this->lower_ + this->upper_ );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_BANDED_LAYOUT_HPP
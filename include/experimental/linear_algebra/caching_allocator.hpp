@@ -0,0 +1,346 @@
+//==================================================================================================
+//  File:       caching_allocator.hpp
+//
+//  Summary:    This header defines a per-thread cache of freed buffers grouped by size class and an
+//              allocator which allocates from it. Loops which repeatedly create and destroy tensors
+//              of the same sizes recycle their buffers instead of returning to the global heap.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_CACHING_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_CACHING_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Alignment of every cached buffer (one cache line).
+#ifndef LINALG_CACHE_ALIGNMENT
+#  define LINALG_CACHE_ALIGNMENT 64
+#endif
+
+// Size in bytes of the smallest size class. Must be a power of two.
+#ifndef LINALG_CACHE_MIN_BLOCK
+#  define LINALG_CACHE_MIN_BLOCK 64
+#endif
+
+// Allocations larger than this many bytes bypass the cache. Must be a power of two.
+#ifndef LINALG_CACHE_THRESHOLD
+#  define LINALG_CACHE_THRESHOLD ( ::std::size_t( 1 ) << 22 )
+#endif
+
+// Default number of bytes each thread may hold in its cache.
+#ifndef LINALG_CACHE_CAPACITY
+#  define LINALG_CACHE_CAPACITY ( ::std::size_t( 1 ) << 26 )
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//=================================================================================================
+//  Size classes of the buffer cache
+//=================================================================================================
+
+// Returns the index of the power of two size class, starting at LINALG_CACHE_MIN_BLOCK, holding bytes
+[[nodiscard]] constexpr ::std::size_t cache_size_class( ::std::size_t bytes ) noexcept
+{
+  ::std::size_t index = 0;
+  for ( ::std::size_t block = LINALG_CACHE_MIN_BLOCK; block < bytes; block <<= 1 )
+  {
+    ++index;
+  }
+  return index;
+}
+
+}       //- detail namespace
+
+/// @brief Cache of freed buffers. Requests are rounded up to a power of two size class; freed
+///        buffers are kept on a free list per size class until the cache holds its capacity in
+///        bytes, after which they are returned to the global heap. Requests above
+///        LINALG_CACHE_THRESHOLD bytes bypass the cache.
+class buffer_cache
+{
+  public:
+    //- Types
+
+    /// @brief Counters describing the effectiveness of the cache
+    struct statistics
+    {
+      /// @brief Number of allocations served from the cache
+      ::std::size_t hits         = 0;
+      /// @brief Number of cacheable allocations served from the global heap
+      ::std::size_t misses       = 0;
+      /// @brief Number of allocations above the threshold
+      ::std::size_t bypasses     = 0;
+      /// @brief Number of bytes currently held by the cache
+      ::std::size_t bytes_cached = 0;
+    };
+
+    /// @brief Alignment of each buffer
+    static constexpr ::std::size_t alignment = LINALG_CACHE_ALIGNMENT;
+    /// @brief Size in bytes of the smallest size class
+    static constexpr ::std::size_t min_block = LINALG_CACHE_MIN_BLOCK;
+    /// @brief Allocations larger than this many bytes bypass the cache
+    static constexpr ::std::size_t threshold = LINALG_CACHE_THRESHOLD;
+
+    //- Constructors / Destructor
+
+    /// @brief Constructs a cache holding at most LINALG_CACHE_CAPACITY bytes
+    buffer_cache() noexcept = default;
+    /// @brief Constructs a cache
+    /// @param capacity maximum number of bytes held by the cache
+    explicit buffer_cache( ::std::size_t capacity ) noexcept : capacity_( capacity ) { }
+    buffer_cache( const buffer_cache& )              = delete;
+    buffer_cache& operator = ( const buffer_cache& ) = delete;
+    /// @brief Returns all cached buffers to the global heap
+    ~buffer_cache() noexcept { this->release(); }
+
+    //- Allocation
+
+    /// @brief Allocates a buffer
+    /// @param bytes number of bytes
+    /// @return pointer to a buffer aligned to LINALG_CACHE_ALIGNMENT
+    [[nodiscard]] void* allocate( ::std::size_t bytes );
+    /// @brief Returns a buffer to the cache, or to the global heap if the cache is full
+    /// @param p pointer to the buffer
+    /// @param bytes number of bytes requested when the buffer was allocated
+    void deallocate( void* p, ::std::size_t bytes ) noexcept;
+    /// @brief Returns true if buffers of the two sizes are of the same size class, in which case
+    ///        a buffer allocated for either size may hold the other
+    [[nodiscard]] static constexpr bool same_size_class( ::std::size_t bytes_a, ::std::size_t bytes_b ) noexcept
+    {
+      return ( bytes_a <= threshold ) && ( bytes_b <= threshold ) && ( size_class( bytes_a ) == size_class( bytes_b ) );
+    }
+    /// @brief Returns all cached buffers to the global heap
+    void release() noexcept;
+
+    //- Properties
+
+    /// @brief Returns the maximum number of bytes held by the cache
+    [[nodiscard]] ::std::size_t capacity() const noexcept { return this->capacity_; }
+    /// @brief Sets the maximum number of bytes held by the cache, releasing buffers above it
+    /// @param capacity maximum number of bytes
+    void set_capacity( ::std::size_t capacity ) noexcept;
+    /// @brief Returns the statistics of the cache
+    [[nodiscard]] const statistics& stats() const noexcept { return this->stats_; }
+    /// @brief Resets the hit, miss and bypass counters
+    void reset_stats() noexcept;
+
+  private:
+    //- Types
+
+    // Header written into each cached buffer
+    struct free_block { free_block* next; };
+
+    //- Implementation details
+
+    // Returns the index of the size class holding bytes
+    [[nodiscard]] static constexpr ::std::size_t size_class( ::std::size_t bytes ) noexcept { return detail::cache_size_class( bytes ); }
+    // Returns the size in bytes of a size class
+    [[nodiscard]] static constexpr ::std::size_t class_size( ::std::size_t index ) noexcept { return min_block << index; }
+
+    static_assert( ( min_block & ( min_block - 1 ) ) == 0, "LINALG_CACHE_MIN_BLOCK must be a power of two." );
+    static_assert( ( threshold & ( threshold - 1 ) ) == 0, "LINALG_CACHE_THRESHOLD must be a power of two." );
+    static_assert( min_block >= sizeof(free_block), "LINALG_CACHE_MIN_BLOCK must hold a pointer." );
+
+    //- Data
+    ::std::array<free_block*,detail::cache_size_class( LINALG_CACHE_THRESHOLD ) + 1> free_lists_ {};
+    ::std::size_t                                                                    capacity_ = LINALG_CACHE_CAPACITY;
+    statistics                                                                       stats_;
+};
+
+/// @brief Returns the buffer cache of the calling thread
+/// @return thread-local buffer cache
+[[nodiscard]] inline buffer_cache& thread_buffer_cache()
+{
+  static thread_local buffer_cache cache;
+  return cache;
+}
+
+/// @brief Allocator which recycles buffers through the buffer cache of the calling thread.
+///        Buffers may be freed by any thread; they join the cache of the freeing thread.
+/// @tparam T element type
+template < class T >
+class caching_allocator
+{
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Allocator is stateless and therefore always propagates on move
+    using propagate_on_container_move_assignment = ::std::true_type;
+    /// @brief All instances of the allocator are equal
+    using is_always_equal                        = ::std::true_type;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = caching_allocator<U>; };
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr caching_allocator() noexcept = default;
+    /// @brief Converting constructor
+    template < class U >
+    constexpr caching_allocator( [[maybe_unused]] const caching_allocator<U>& rhs ) noexcept { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n )
+    {
+      if ( n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+      {
+        throw ::std::bad_array_new_length();
+      }
+      if constexpr ( alignof(T) > buffer_cache::alignment )
+      {
+        return static_cast<T*>( ::operator new( n * sizeof(T), ::std::align_val_t( alignof(T) ) ) );
+      }
+      else
+      {
+        return static_cast<T*>( thread_buffer_cache().allocate( n * sizeof(T) ) );
+      }
+    }
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, size_type n ) noexcept
+    {
+      if constexpr ( alignof(T) > buffer_cache::alignment )
+      {
+        ::operator delete( p, ::std::align_val_t( alignof(T) ) );
+      }
+      else
+      {
+        thread_buffer_cache().deallocate( p, n * sizeof(T) );
+      }
+    }
+    /// @brief Resizes storage previously returned from allocate, preserving its contents. Storage
+    ///        is kept in place if both sizes fall into the same size class.
+    /// @param p pointer to the storage
+    /// @param old_n number of elements currently allocated
+    /// @param new_n number of elements requested
+    /// @return pointer to the resized storage
+    [[nodiscard]] T* reallocate( T* p, size_type old_n, size_type new_n )
+    {
+      if constexpr ( alignof(T) <= buffer_cache::alignment )
+      {
+        if ( ( p != nullptr ) && ( new_n <= ::std::numeric_limits<size_type>::max() / sizeof(T) ) &&
+             buffer_cache::same_size_class( old_n * sizeof(T), new_n * sizeof(T) ) )
+        {
+          return p;
+        }
+      }
+      T* q = this->allocate( new_n );
+      if ( p != nullptr )
+      {
+        ::std::memcpy( static_cast<void*>( q ), static_cast<const void*>( p ), ::std::min( old_n, new_n ) * sizeof(T) );
+      }
+      this->deallocate( p, old_n );
+      return q;
+    }
+};
+
+/// @brief All caching allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator == ( const caching_allocator<T>&, const caching_allocator<U>& ) noexcept { return true; }
+/// @brief All caching allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator != ( const caching_allocator<T>&, const caching_allocator<U>& ) noexcept { return false; }
+
+//------------------------------------------
+// Implementation of buffer_cache
+//------------------------------------------
+
+[[nodiscard]] inline void* buffer_cache::allocate( ::std::size_t bytes )
+{
+  if ( bytes > threshold )
+  {
+    ++this->stats_.bypasses;
+    return ::operator new( bytes, ::std::align_val_t( alignment ) );
+  }
+  const ::std::size_t index = size_class( bytes );
+  if ( free_block* block = this->free_lists_[index] )
+  {
+    this->free_lists_[index]    = block->next;
+    this->stats_.bytes_cached  -= class_size( index );
+    ++this->stats_.hits;
+    return block;
+  }
+  ++this->stats_.misses;
+  return ::operator new( class_size( index ), ::std::align_val_t( alignment ) );
+}
+
+inline void buffer_cache::deallocate( void* p, ::std::size_t bytes ) noexcept
+{
+  if ( p == nullptr )
+  {
+    return;
+  }
+  if ( bytes > threshold )
+  {
+    ::operator delete( p, ::std::align_val_t( alignment ) );
+    return;
+  }
+  const ::std::size_t index = size_class( bytes );
+  if ( this->stats_.bytes_cached + class_size( index ) > this->capacity_ )
+  {
+    ::operator delete( p, ::std::align_val_t( alignment ) );
+    return;
+  }
+  free_block* block          = ::new ( p ) free_block{ this->free_lists_[index] };
+  this->free_lists_[index]   = block;
+  this->stats_.bytes_cached += class_size( index );
+}
+
+inline void buffer_cache::release() noexcept
+{
+  for ( free_block*& head : this->free_lists_ )
+  {
+    while ( head != nullptr )
+    {
+      free_block* next = head->next;
+      ::operator delete( static_cast<void*>( head ), ::std::align_val_t( alignment ) );
+      head = next;
+    }
+  }
+  this->stats_.bytes_cached = 0;
+}
+
+inline void buffer_cache::set_capacity( ::std::size_t capacity ) noexcept
+{
+  this->capacity_ = capacity;
+  // Release buffers of the largest size classes first until the cache fits
+  for ( ::std::size_t index = this->free_lists_.size(); ( index-- > 0 ) && ( this->stats_.bytes_cached > capacity ); )
+  {
+    while ( ( this->free_lists_[index] != nullptr ) && ( this->stats_.bytes_cached > capacity ) )
+    {
+      free_block* block          = this->free_lists_[index];
+      this->free_lists_[index]   = block->next;
+      this->stats_.bytes_cached -= class_size( index );
+      ::operator delete( static_cast<void*>( block ), ::std::align_val_t( alignment ) );
+    }
+  }
+}
+
+inline void buffer_cache::reset_stats() noexcept
+{
+  this->stats_.hits     = 0;
+  this->stats_.misses   = 0;
+  this->stats_.bypasses = 0;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_CACHING_ALLOCATOR_HPP
@@ -0,0 +1,677 @@
+//==================================================================================================
+//  File:       coo_builder.hpp
+//
+//  Summary:    This header defines a builder which assembles a sparse matrix from scattered
+//              (row, column, value) contributions, also known as coordinate (COO) or triplet
+//              format. Contributions are buffered per thread, radix sorted by position in parallel,
+//              and merged with duplicates summed. Sorted runs are merged as chunks arrive, so memory
+//              is bounded by the nonzeros of the result plus the chunks in flight.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_COO_BUILDER_HPP
+#define LINEAR_ALGEBRA_COO_BUILDER_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Number of buffered contributions which triggers sorting them into the assembled nonzeros.
+#ifndef LINALG_COO_CHUNK_SIZE
+#  define LINALG_COO_CHUNK_SIZE ( ::std::size_t( 1 ) << 20 )
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Sparse Entry is a contribution to a sparse matrix. The row and column are packed into a single
+//  key whose order is the order of the compressed storage being assembled.
+//==================================================================================================
+template < class T >
+struct sparse_entry
+{
+  ::std::uint64_t key;
+  T               value;
+};
+
+// Returns the number of bits needed to represent every index below extent
+[[nodiscard]] constexpr unsigned index_bits( ::std::size_t extent ) noexcept
+{
+  unsigned bits = 0;
+  while ( ( bits < 64 ) && ( ( ::std::uint64_t( 1 ) << bits ) < extent ) )
+  {
+    ++bits;
+  }
+  return bits;
+}
+
+//==================================================================================================
+//  Radix Sort stably sorts entries by the low key_bits bits of their keys. Each pass sorts by one
+//  byte: blocks of entries are histogrammed in parallel, the histograms are scanned so each block
+//  owns a slot per digit, and blocks scatter into their slots in parallel. Passes in which every
+//  entry shares a digit are skipped.
+//==================================================================================================
+template < class T, class Alloc >
+void radix_sort( ::std::vector< sparse_entry<T>, Alloc >& entries, unsigned key_bits )
+{
+  constexpr unsigned      digit_bits = 8;
+  constexpr ::std::size_t radix      = ::std::size_t( 1 ) << digit_bits;
+  const ::std::size_t     size       = entries.size();
+  if ( size < 2 )
+  {
+    return;
+  }
+  const ::std::size_t blocks = sparse_task_count( size );
+  ::std::vector< sparse_entry<T>, Alloc >     buffer( size, entries.get_allocator() );
+  ::std::vector< ::std::array<::std::size_t,radix> > counts( blocks );
+  // Applies the lambda expression to each block, in parallel if there is more than one
+  auto for_each_block = [blocks]( auto&& lambda )
+  {
+    if ( blocks == 1 )
+    {
+      lambda( ::std::size_t( 0 ) );
+    }
+    else
+    {
+      for_each( LINALG_EXECUTION_PAR, faux_index_iterator<::std::size_t>( 0 ), faux_index_iterator<::std::size_t>( blocks ), lambda );
+    }
+  };
+  for ( unsigned shift = 0; shift < key_bits; shift += digit_bits )
+  {
+    const sparse_entry<T>* source = entries.data();
+    sparse_entry<T>*       target = buffer.data();
+    for_each_block( [&counts,source,size,blocks,shift]( ::std::size_t b )
+    {
+      const auto [ first, last ] = thread_pool::partition( size, b, blocks );
+      counts[b].fill( 0 );
+      for ( ::std::size_t k = first; k < last; ++k )
+      {
+        ++counts[b][ ( source[k].key >> shift ) & ( radix - 1 ) ];
+      }
+    } );
+    // Exclusive scan in (digit, block) order gives the first slot of each block for each digit
+    bool          is_uniform = false;
+    ::std::size_t total      = 0;
+    for ( ::std::size_t d = 0; d < radix; ++d )
+    {
+      ::std::size_t digit_count = 0;
+      for ( ::std::size_t b = 0; b < blocks; ++b )
+      {
+        const ::std::size_t count = counts[b][d];
+        counts[b][d] = total + digit_count;
+        digit_count += count;
+      }
+      is_uniform = is_uniform || ( digit_count == size );
+      total     += digit_count;
+    }
+    if ( is_uniform )
+    {
+      continue;
+    }
+    for_each_block( [&counts,source,target,size,blocks,shift]( ::std::size_t b )
+    {
+      const auto [ first, last ] = thread_pool::partition( size, b, blocks );
+      for ( ::std::size_t k = first; k < last; ++k )
+      {
+        target[ counts[b][ ( source[k].key >> shift ) & ( radix - 1 ) ]++ ] = source[k];
+      }
+    } );
+    entries.swap( buffer );
+  }
+}
+
+// Sums the values of adjacent entries with equal keys in place
+template < class T, class Alloc >
+void sum_duplicates( ::std::vector< sparse_entry<T>, Alloc >& entries )
+{
+  ::std::size_t count = 0;
+  for ( ::std::size_t k = 0; k < entries.size(); ++k )
+  {
+    if ( ( count > 0 ) && ( entries[count-1].key == entries[k].key ) )
+    {
+      entries[count-1].value += entries[k].value;
+    }
+    else
+    {
+      entries[count++] = entries[k];
+    }
+  }
+  entries.erase( entries.begin() + count, entries.end() );
+}
+
+// Merges two runs of entries sorted by unique keys, summing the values of equal keys
+template < class T, class Alloc >
+[[nodiscard]] ::std::vector< sparse_entry<T>, Alloc > merge_sum( const ::std::vector< sparse_entry<T>, Alloc >& lhs,
+                                                                 const ::std::vector< sparse_entry<T>, Alloc >& rhs )
+{
+  ::std::vector< sparse_entry<T>, Alloc > result( lhs.get_allocator() );
+  result.reserve( lhs.size() + rhs.size() );
+  auto l = lhs.begin();
+  auto r = rhs.begin();
+  while ( ( l != lhs.end() ) && ( r != rhs.end() ) )
+  {
+    if ( l->key < r->key )
+    {
+      result.push_back( *l++ );
+    }
+    else if ( r->key < l->key )
+    {
+      result.push_back( *r++ );
+    }
+    else
+    {
+      result.push_back( sparse_entry<T>{ l->key, l->value + r->value } );
+      ++l;
+      ++r;
+    }
+  }
+  result.insert( result.end(), l, lhs.end() );
+  result.insert( result.end(), r, rhs.end() );
+  return result;
+}
+
+}       //- detail namespace
+
+/// @brief Assembles a sparse matrix from (row, column, value) contributions.
+///        Contributions to the same element are summed. Any number of threads may insert at once
+///        through their own inserter, which buffers contributions and hands them to the builder a
+///        chunk at a time. Once the buffered contributions reach the chunk size they are radix
+///        sorted, their duplicates are summed, and they are merged into the assembled nonzeros.
+///        Finalization must not run concurrently with insertion.
+/// @tparam T     element_type
+/// @tparam Index type used to store indices of the assembled matrix
+/// @tparam Alloc allocator_type
+template < class T,
+           class Index,
+           class Alloc >
+class coo_builder
+{
+  public:
+    //- Types
+
+    /// @brief Type of elements
+    using element_type           = T;
+    /// @brief Type of contributed values
+    using value_type             = ::std::remove_cv_t<element_type>;
+    /// @brief Type of allocator used for values
+    using allocator_type         = Alloc;
+    /// @brief Type used for indexing
+    using index_type             = Index;
+    /// @brief Type used for size along any dimension
+    using size_type              = ::std::size_t;
+    /// @brief Type used to express size of matrix
+    using extents_type           = ::std::experimental::extents<size_type,dynamic_extent,dynamic_extent>;
+    /// @brief Type of the assembled matrix
+    using csr_type               = csr_matrix<T,Index,Alloc>;
+    /// @brief Type of a buffered contribution
+    using entry_type             = detail::sparse_entry<value_type>;
+    /// @brief Type of container holding contributions
+    using entries_container_type = ::std::vector< entry_type, typename ::std::allocator_traits<allocator_type>::template rebind_alloc<entry_type> >;
+
+    /// @brief Buffer of contributions owned by a single thread
+    class inserter
+    {
+      public:
+        //- Destructor / Constructors / Assignments
+
+        /// @brief Hands remaining contributions to the builder. Call flush() beforehand to observe
+        ///        failures: if handing them over throws here, the remaining contributions are dropped.
+        ~inserter();
+        /// @brief Moves the buffer and its binding to the builder
+        inserter( inserter&& rhs ) noexcept;
+        /// @brief Inserters are not copyable
+        inserter( const inserter& )              = delete;
+        /// @brief Inserters are not assignable
+        inserter& operator = ( inserter&& )      = delete;
+        /// @brief Inserters are not assignable
+        inserter& operator = ( const inserter& ) = delete;
+
+        //- Insertion
+
+        /// @brief Adds value to element (i, j)
+        /// @throws out_of_range if (i, j) is outside the matrix
+        void insert( index_type i, index_type j, value_type value );
+        /// @brief Adds the nonzero elements of a dense block whose first element is at (i, j)
+        /// @tparam M dense matrix type
+        /// @throws out_of_range if the block extends outside the matrix
+        #ifdef LINALG_ENABLE_CONCEPTS
+        template < class M >
+          requires detail::is_dense_matrix_v<M>
+        #else
+        template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+        #endif
+        void insert( index_type i, index_type j, const M& block );
+        /// @brief Hands buffered contributions to the builder
+        /// @throws bad_alloc if the contributions cannot be assembled, in which case they are dropped
+        void flush();
+
+      private:
+        friend class coo_builder;
+        explicit inserter( coo_builder& builder );
+
+        // Builder receiving contributions
+        coo_builder*           builder_;
+        // Buffered contributions
+        entries_container_type entries_;
+    };
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Default destructor
+    ~coo_builder()                              = default;
+    /// @brief Constructs a builder of a matrix of the specified size
+    /// @param s number of rows and columns
+    /// @throws length_error if the rows and columns cannot be packed into 64 bits, or either needs all 64
+    explicit coo_builder( extents_type s );
+    /// @brief Constructs a builder of a matrix of the specified size
+    /// @param s          number of rows and columns
+    /// @param chunk_size number of buffered contributions which triggers their assembly
+    /// @param alloc      allocator used to construct with
+    /// @throws length_error if the rows and columns cannot be packed into 64 bits, or either needs all 64
+    coo_builder( extents_type s, size_type chunk_size, const allocator_type& alloc );
+    /// @brief Builders are neither copyable nor movable
+    coo_builder( const coo_builder& )              = delete;
+    /// @brief Builders are neither copyable nor movable
+    coo_builder( coo_builder&& )                   = delete;
+    /// @brief Builders are neither copyable nor movable
+    coo_builder& operator = ( const coo_builder& ) = delete;
+    /// @brief Builders are neither copyable nor movable
+    coo_builder& operator = ( coo_builder&& )      = delete;
+
+    //- Size
+
+    /// @brief Returns the number of (rows, columns)
+    [[nodiscard]] constexpr extents_type size() const noexcept;
+
+    //- Insertion
+
+    /// @brief Returns a buffer through which one thread may contribute without contention
+    [[nodiscard]] inserter make_inserter();
+    /// @brief Adds value to element (i, j). Safe to call concurrently, but serializes callers.
+    /// @throws out_of_range if (i, j) is outside the matrix
+    void insert( index_type i, index_type j, value_type value );
+    /// @brief Adds the nonzero elements of a dense block whose first element is at (i, j).
+    ///        Safe to call concurrently, but serializes callers.
+    /// @tparam M dense matrix type
+    /// @throws out_of_range if the block extends outside the matrix
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class M >
+      requires detail::is_dense_matrix_v<M>
+    #else
+    template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+    #endif
+    void insert( index_type i, index_type j, const M& block );
+
+    //- Finalization
+
+    /// @brief Assembles all contributions into compressed sparse row storage.
+    ///        The builder keeps its contributions, so insertion and finalization may continue.
+    [[nodiscard]] csr_type finalize_csr();
+    /// @brief Assembles all contributions into compressed sparse column storage, returned as the
+    ///        compressed sparse row storage of the transpose.
+    ///        The builder keeps its contributions, so insertion and finalization may continue.
+    [[nodiscard]] csr_type finalize_csc();
+    /// @brief Discards all contributions
+    void clear();
+
+  private:
+    //- Private functions
+
+    // Packs (i, j) into a key ordered by row, then column
+    [[nodiscard]] ::std::uint64_t key( index_type i, index_type j ) const;
+    // Appends contributions of a dense block to entries
+    template < class M >
+    void append( entries_container_type& entries, index_type i, index_type j, const M& block ) const;
+    // Queues a chunk of contributions, assembling queued chunks once they reach the chunk size
+    void submit( entries_container_type&& chunk );
+    // Sorts chunks, sums their duplicates, and merges them into the assembled nonzeros
+    void assemble( ::std::vector<entries_container_type>&& chunks );
+    // Assembles all queued and shared contributions
+    void assemble_all();
+    // Converts nonzeros sorted by key into compressed storage with major index key >> shift
+    [[nodiscard]] csr_type compress( const entries_container_type& entries, extents_type s, unsigned shift ) const;
+
+    //- Data
+
+    // Number of rows and columns
+    extents_type                          size_;
+    // Number of bits of a key holding the column index
+    unsigned                              column_bits_;
+    // Number of bits of a key holding the row index
+    unsigned                              row_bits_;
+    // Number of queued contributions which triggers their assembly
+    size_type                             chunk_size_;
+    // Allocator used for values
+    allocator_type                        alloc_;
+    // Guards shared_, queued_, and queued_count_
+    ::std::mutex                          mutex_;
+    // Contributions inserted directly into the builder
+    entries_container_type                shared_;
+    // Chunks waiting to be assembled
+    ::std::vector<entries_container_type> queued_;
+    // Number of contributions waiting to be assembled
+    size_type                             queued_count_;
+    // Guards assembled_
+    ::std::mutex                          assembled_mutex_;
+    // Nonzeros assembled so far, sorted by unique key
+    entries_container_type                assembled_;
+};
+
+//==================================================================================================
+//                                  I M P L E M E N T A T I O N
+//==================================================================================================
+
+//- Inserter
+
+template < class T, class Index, class Alloc >
+coo_builder<T,Index,Alloc>::inserter::~inserter()
+{
+  // Destructors may not throw, so contributions which fail to be handed over are dropped
+  try
+  {
+    this->flush();
+  }
+  catch ( ... )
+  {
+  }
+}
+
+template < class T, class Index, class Alloc >
+coo_builder<T,Index,Alloc>::inserter::inserter( inserter&& rhs ) noexcept :
+  builder_( ::std::exchange( rhs.builder_, nullptr ) ),
+  entries_( ::std::move( rhs.entries_ ) )
+{
+}
+
+template < class T, class Index, class Alloc >
+coo_builder<T,Index,Alloc>::inserter::inserter( coo_builder& builder ) :
+  builder_( &builder ),
+  entries_( builder.alloc_ )
+{
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::inserter::insert( index_type i, index_type j, value_type value )
+{
+  this->entries_.push_back( entry_type{ this->builder_->key( i, j ), value } );
+  if ( this->entries_.size() >= this->builder_->chunk_size_ )
+  {
+    this->flush();
+  }
+}
+
+template < class T, class Index, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, typename >
+#endif
+void coo_builder<T,Index,Alloc>::inserter::insert( index_type i, index_type j, const M& block )
+{
+  this->builder_->append( this->entries_, i, j, block );
+  if ( this->entries_.size() >= this->builder_->chunk_size_ )
+  {
+    this->flush();
+  }
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::inserter::flush()
+{
+  if ( this->builder_ && !this->entries_.empty() )
+  {
+    entries_container_type chunk( this->builder_->alloc_ );
+    chunk.swap( this->entries_ );
+    this->builder_->submit( ::std::move( chunk ) );
+  }
+}
+
+//- Destructor / Constructors / Assignments
+
+template < class T, class Index, class Alloc >
+coo_builder<T,Index,Alloc>::coo_builder( extents_type s ) :
+  coo_builder( s, LINALG_COO_CHUNK_SIZE, allocator_type() )
+{
+}
+
+template < class T, class Index, class Alloc >
+coo_builder<T,Index,Alloc>::coo_builder( extents_type s, size_type chunk_size, const allocator_type& alloc ) :
+  size_( s ),
+  column_bits_( detail::index_bits( s.extent(1) ) ),
+  row_bits_( detail::index_bits( s.extent(0) ) ),
+  chunk_size_( ::std::max< size_type >( chunk_size, 1 ) ),
+  alloc_( alloc ),
+  mutex_(),
+  shared_( alloc ),
+  queued_(),
+  queued_count_( 0 ),
+  assembled_mutex_(),
+  assembled_( alloc )
+{
+  // Keys shift by either index width, which must therefore stay below 64 bits
+  if ( ( this->row_bits_ + this->column_bits_ > 64 ) || ( this->row_bits_ == 64 ) || ( this->column_bits_ == 64 ) )
+  {
+    throw length_error( "Matrix is too large to assemble." );
+  }
+}
+
+//- Size
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename coo_builder<T,Index,Alloc>::extents_type
+coo_builder<T,Index,Alloc>::size() const noexcept
+{
+  return this->size_;
+}
+
+//- Insertion
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename coo_builder<T,Index,Alloc>::inserter
+coo_builder<T,Index,Alloc>::make_inserter()
+{
+  return inserter( *this );
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::insert( index_type i, index_type j, value_type value )
+{
+  const entry_type entry { this->key( i, j ), value };
+  entries_container_type chunk( this->alloc_ );
+  {
+    ::std::lock_guard<::std::mutex> lock( this->mutex_ );
+    this->shared_.push_back( entry );
+    if ( this->shared_.size() < this->chunk_size_ )
+    {
+      return;
+    }
+    chunk.swap( this->shared_ );
+  }
+  this->submit( ::std::move( chunk ) );
+}
+
+template < class T, class Index, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, typename >
+#endif
+void coo_builder<T,Index,Alloc>::insert( index_type i, index_type j, const M& block )
+{
+  entries_container_type chunk( this->alloc_ );
+  this->append( chunk, i, j, block );
+  this->submit( ::std::move( chunk ) );
+}
+
+//- Finalization
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename coo_builder<T,Index,Alloc>::csr_type
+coo_builder<T,Index,Alloc>::finalize_csr()
+{
+  this->assemble_all();
+  ::std::lock_guard<::std::mutex> lock( this->assembled_mutex_ );
+  return this->compress( this->assembled_, this->size_, this->column_bits_ );
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename coo_builder<T,Index,Alloc>::csr_type
+coo_builder<T,Index,Alloc>::finalize_csc()
+{
+  this->assemble_all();
+  entries_container_type transposed( this->alloc_ );
+  {
+    ::std::lock_guard<::std::mutex> lock( this->assembled_mutex_ );
+    transposed = this->assembled_;
+  }
+  // Rekey by column, then row
+  const ::std::uint64_t column_mask = ( ::std::uint64_t( 1 ) << this->column_bits_ ) - 1;
+  for ( entry_type& entry : transposed )
+  {
+    entry.key = ( ( entry.key & column_mask ) << this->row_bits_ ) | ( entry.key >> this->column_bits_ );
+  }
+  detail::radix_sort( transposed, this->row_bits_ + this->column_bits_ );
+  return this->compress( transposed, extents_type( this->size_.extent(1), this->size_.extent(0) ), this->row_bits_ );
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::clear()
+{
+  ::std::lock_guard<::std::mutex> lock( this->mutex_ );
+  ::std::lock_guard<::std::mutex> assembled_lock( this->assembled_mutex_ );
+  this->shared_.clear();
+  this->queued_.clear();
+  this->queued_count_ = 0;
+  this->assembled_.clear();
+}
+
+//- Private functions
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] ::std::uint64_t coo_builder<T,Index,Alloc>::key( index_type i, index_type j ) const
+{
+  // Negative indices convert to sizes beyond any extent
+  if ( ( static_cast<size_type>( i ) >= this->size_.extent(0) ) || ( static_cast<size_type>( j ) >= this->size_.extent(1) ) )
+  {
+    throw out_of_range( "Index is outside of the matrix." );
+  }
+  return ( static_cast<::std::uint64_t>( i ) << this->column_bits_ ) | static_cast<::std::uint64_t>( j );
+}
+
+template < class T, class Index, class Alloc >
+template < class M >
+void coo_builder<T,Index,Alloc>::append( entries_container_type& entries, index_type i, index_type j, const M& block ) const
+{
+  if ( ( static_cast<size_type>( i ) > this->size_.extent(0) ) || ( static_cast<size_type>( j ) > this->size_.extent(1) ) ||
+       ( block.rows() > this->size_.extent(0) - static_cast<size_type>( i ) ) || ( block.columns() > this->size_.extent(1) - static_cast<size_type>( j ) ) )
+  {
+    throw out_of_range( "Block extends outside of the matrix." );
+  }
+  for ( size_type bi = 0; bi < block.rows(); ++bi )
+  {
+    for ( size_type bj = 0; bj < block.columns(); ++bj )
+    {
+      const value_type value = detail::access( block, bi, bj );
+      if ( value != value_type {} )
+      {
+        entries.push_back( entry_type{ this->key( static_cast<index_type>( i + bi ), static_cast<index_type>( j + bj ) ), value } );
+      }
+    }
+  }
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::submit( entries_container_type&& chunk )
+{
+  ::std::vector<entries_container_type> chunks;
+  {
+    ::std::lock_guard<::std::mutex> lock( this->mutex_ );
+    this->queued_count_ += chunk.size();
+    this->queued_.push_back( ::std::move( chunk ) );
+    if ( this->queued_count_ < this->chunk_size_ )
+    {
+      return;
+    }
+    chunks.swap( this->queued_ );
+    this->queued_count_ = 0;
+  }
+  // Assemble without holding the lock so other threads keep submitting
+  this->assemble( ::std::move( chunks ) );
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::assemble( ::std::vector<entries_container_type>&& chunks )
+{
+  entries_container_type batch( this->alloc_ );
+  size_type count = 0;
+  for ( const auto& chunk : chunks )
+  {
+    count += chunk.size();
+  }
+  batch.reserve( count );
+  for ( auto& chunk : chunks )
+  {
+    batch.insert( batch.end(), chunk.begin(), chunk.end() );
+    entries_container_type().swap( chunk );
+  }
+  detail::radix_sort( batch, this->row_bits_ + this->column_bits_ );
+  detail::sum_duplicates( batch );
+  ::std::lock_guard<::std::mutex> lock( this->assembled_mutex_ );
+  if ( this->assembled_.empty() )
+  {
+    this->assembled_.swap( batch );
+  }
+  else
+  {
+    this->assembled_ = detail::merge_sum( this->assembled_, batch );
+  }
+}
+
+template < class T, class Index, class Alloc >
+void coo_builder<T,Index,Alloc>::assemble_all()
+{
+  ::std::vector<entries_container_type> chunks;
+  {
+    ::std::lock_guard<::std::mutex> lock( this->mutex_ );
+    chunks.swap( this->queued_ );
+    this->queued_count_ = 0;
+    if ( !this->shared_.empty() )
+    {
+      chunks.push_back( ::std::move( this->shared_ ) );
+      this->shared_ = entries_container_type( this->alloc_ );
+    }
+  }
+  if ( !chunks.empty() )
+  {
+    this->assemble( ::std::move( chunks ) );
+  }
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename coo_builder<T,Index,Alloc>::csr_type
+coo_builder<T,Index,Alloc>::compress( const entries_container_type& entries, extents_type s, unsigned shift ) const
+{
+  const ::std::uint64_t mask = ( ::std::uint64_t( 1 ) << shift ) - 1;
+  typename csr_type::offsets_container_type offsets( s.extent(0) + 1, size_type( 0 ), this->alloc_ );
+  typename csr_type::indices_container_type indices( entries.size(), index_type( 0 ), this->alloc_ );
+  typename csr_type::values_container_type  values( entries.size(), value_type {}, this->alloc_ );
+  for ( size_type k = 0; k < entries.size(); ++k )
+  {
+    ++offsets[ ( entries[k].key >> shift ) + 1 ];
+    indices[k] = static_cast<index_type>( entries[k].key & mask );
+    values[k]  = entries[k].value;
+  }
+  ::std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+  return csr_type( s, ::std::move( offsets ), ::std::move( indices ), ::std::move( values ) );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_COO_BUILDER_HPP
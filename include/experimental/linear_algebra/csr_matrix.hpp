@@ -0,0 +1,738 @@
+//==================================================================================================
+//  File:       csr_matrix.hpp
+//
+//  Summary:    This header defines a matrix stored in compressed sparse row (CSR) format, along
+//              with sparse matrix-vector (SpMV) and sparse matrix-dense matrix (SpMM) products.
+//              Products are partitioned across the thread pool by nonzeros rather than by rows, so
+//              that matrices with a few dense rows do not serialize on a single task.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_CSR_MATRIX_HPP
+#define LINEAR_ALGEBRA_CSR_MATRIX_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Minimum number of nonzeros assigned to each parallel task of a sparse kernel.
+#ifndef LINALG_SPARSE_TASK_NONZEROS
+#  define LINALG_SPARSE_TASK_NONZEROS 16384
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Sparse Partition splits the rows of a CSR matrix into count ranges holding roughly equal
+//  numbers of nonzeros. Range p is [bounds[p], bounds[p+1]).
+//==================================================================================================
+template < class SizeType >
+[[nodiscard]] inline ::std::vector<SizeType> sparse_partition( const SizeType* row_offsets, SizeType rows, SizeType count )
+{
+  ::std::vector<SizeType> bounds( count + 1 );
+  const SizeType nonzeros = row_offsets[rows];
+  bounds[0]               = 0;
+  for ( SizeType p = 1; p < count; ++p )
+  {
+    const SizeType target = static_cast<SizeType>( ( static_cast<long double>( nonzeros ) * p ) / count );
+    bounds[p] = static_cast<SizeType>( ::std::lower_bound( row_offsets + bounds[p-1], row_offsets + rows, target ) - row_offsets );
+  }
+  bounds[count] = rows;
+  return bounds;
+}
+
+//==================================================================================================
+//  Sparse Task Count returns the number of parallel tasks among which a sparse kernel over the
+//  specified number of nonzeros is divided
+//==================================================================================================
+[[nodiscard]] inline ::std::size_t sparse_task_count( ::std::size_t nonzeros )
+{
+  return ::std::max< ::std::size_t >( ::std::min< ::std::size_t >( 4 * thread_pool::default_pool().thread_count(),
+                                                                   nonzeros / LINALG_SPARSE_TASK_NONZEROS ), 1 );
+}
+
+//==================================================================================================
+//  Sparse For Each applies the lambda expression to ranges of rows [first, last) covering all
+//  rows of a CSR matrix. Ranges are balanced by nonzeros and processed on the thread pool when
+//  the matrix holds enough nonzeros to amortize scheduling.
+//==================================================================================================
+template < class SizeType, class Lambda >
+inline void sparse_for_each( const SizeType* row_offsets, SizeType rows, Lambda&& lambda )
+{
+  const SizeType count = static_cast<SizeType>( sparse_task_count( row_offsets[rows] ) );
+  if ( count == 1 )
+  {
+    lambda( SizeType( 0 ), rows );
+  }
+  else
+  {
+    const auto bounds = sparse_partition( row_offsets, rows, count );
+    for_each( LINALG_EXECUTION_PAR,
+              faux_index_iterator<SizeType>( 0 ),
+              faux_index_iterator<SizeType>( count ),
+              [&bounds,&lambda]( SizeType p ) { lambda( bounds[p], bounds[p+1] ); } );
+  }
+}
+
+//==================================================================================================
+//  Sparse Dot returns the dot product of one CSR row with a dense vector. Four independent
+//  partial sums break the dependency chain of the reduction so the gathers and multiplies of
+//  consecutive nonzeros can be issued together.
+//==================================================================================================
+template < class R, class T, class Index, class Gather >
+[[nodiscard]] LINALG_FORCE_INLINE_FUNCTION inline R sparse_dot( const T* values, const Index* columns, ::std::size_t count, const Gather& gather )
+{
+  R s0 {}, s1 {}, s2 {}, s3 {};
+  ::std::size_t k = 0;
+  for ( ; k + 4 <= count; k += 4 )
+  {
+    s0 += values[k]   * gather( columns[k] );
+    s1 += values[k+1] * gather( columns[k+1] );
+    s2 += values[k+2] * gather( columns[k+2] );
+    s3 += values[k+3] * gather( columns[k+3] );
+  }
+  for ( ; k < count; ++k )
+  {
+    s0 += values[k] * gather( columns[k] );
+  }
+  return ( s0 + s1 ) + ( s2 + s3 );
+}
+
+//==================================================================================================
+//  Is Contiguous Span returns true if elements of a rank one mdspan are adjacent in memory and
+//  may be read directly through its data handle
+//==================================================================================================
+template < class MDS >
+inline constexpr bool is_contiguous_span_v = ( MDS::rank() == 1 ) &&
+                                             ( ::std::is_same_v< typename MDS::layout_type, ::std::experimental::layout_right > ||
+                                               ::std::is_same_v< typename MDS::layout_type, ::std::experimental::layout_left > ) &&
+                                             ::std::is_same_v< typename MDS::accessor_type, ::std::experimental::default_accessor< typename MDS::element_type > >;
+
+//==================================================================================================
+//  Is Dense Matrix returns true if the matrix stores every element and exposes them through an
+//  mdspan, i.e. it may be compressed or multiplied by a sparse matrix
+//==================================================================================================
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+inline constexpr bool is_dense_matrix_v = concepts::matrix_data<M> && requires { typename M::const_underlying_span_type; };
+#else
+template < class M, typename = void >
+struct is_dense_matrix : public ::std::false_type { };
+template < class M >
+struct is_dense_matrix< M, ::std::void_t< typename M::const_underlying_span_type > > : public ::std::bool_constant< concepts::matrix_data_v<M> > { };
+template < class M >
+inline constexpr bool is_dense_matrix_v = is_dense_matrix<M>::value;
+#endif
+
+// Returns a callable reading element j of the vector
+template < class V >
+[[nodiscard]] inline constexpr auto sparse_gather( const V& v ) noexcept
+{
+  if constexpr ( is_contiguous_span_v< typename V::const_underlying_span_type > )
+  {
+    return [ data = v.underlying_span().data_handle() ]( auto j ) noexcept { return data[j]; };
+  }
+  else
+  {
+    return [ &v ]( auto j ) noexcept { return access( v, j ); };
+  }
+}
+
+}       //- detail namespace
+
+/// @brief Matrix stored in compressed sparse row format.
+///        Nonzeros of row i occupy positions [row_offsets()[i], row_offsets()[i+1]) of values() and
+///        column_indices(), with column indices strictly increasing within each row. Elements not
+///        stored are zero.
+//         Implementation satisfies the following concepts:
+//         concepts::matrix_data
+//         Element access returns values, but span, row, column, and submatrix views are not
+//         provided as mdspan cannot portray compressed storage.
+/// @tparam T     element_type
+/// @tparam Index type used to store column indices
+/// @tparam Alloc allocator_type
+template < class T,
+           class Index,
+           class Alloc >
+class csr_matrix
+{
+  static_assert( ::std::is_integral_v<Index>, "Column indices must be of integral type." );
+
+  public:
+    //- Types
+
+    /// @brief Type of elements
+    using element_type              = T;
+    /// @brief Type returned by const index access
+    using value_type                = ::std::remove_cv_t<element_type>;
+    /// @brief Type of allocator used for values
+    using allocator_type            = Alloc;
+    /// @brief Type used for indexing
+    using index_type                = Index;
+    /// @brief Type used for size along any dimension
+    using size_type                 = ::std::size_t;
+    /// @brief Type used to express size of matrix
+    using extents_type              = ::std::experimental::extents<size_type,dynamic_extent,dynamic_extent>;
+    /// @brief Type used to represent a node in the matrix
+    using tuple_type                = ::std::tuple<index_type,index_type>;
+    /// @brief Type of container holding the offset of the first nonzero of each row
+    using offsets_container_type    = ::std::vector< size_type, typename ::std::allocator_traits<allocator_type>::template rebind_alloc<size_type> >;
+    /// @brief Type of container holding the column index of each nonzero
+    using indices_container_type    = ::std::vector< index_type, typename ::std::allocator_traits<allocator_type>::template rebind_alloc<index_type> >;
+    /// @brief Type of container holding the value of each nonzero
+    using values_container_type     = ::std::vector< value_type, allocator_type >;
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Default destructor
+    ~csr_matrix()                             = default;
+    /// @brief Default constructor
+    csr_matrix()                              = default;
+    /// @brief Default move constructor
+    csr_matrix( csr_matrix&& )                = default;
+    /// @brief Default copy constructor
+    csr_matrix( const csr_matrix& )           = default;
+    /// @brief Constructs an empty matrix using the specified allocator
+    /// @param alloc allocator used to construct with
+    explicit csr_matrix( const allocator_type& alloc );
+    /// @brief Constructs a matrix of the specified size with no nonzeros
+    /// @param s number of rows and columns
+    explicit csr_matrix( extents_type s );
+    /// @brief Constructs a matrix of the specified size with no nonzeros
+    /// @param s     number of rows and columns
+    /// @param alloc allocator used to construct with
+    csr_matrix( extents_type s, const allocator_type& alloc );
+    /// @brief Constructs a matrix taking ownership of existing compressed storage
+    /// @param s              number of rows and columns
+    /// @param row_offsets    offset of the first nonzero of each row, followed by the number of nonzeros
+    /// @param column_indices column index of each nonzero, strictly increasing within each row
+    /// @param values         value of each nonzero
+    /// @throws invalid_argument if the compressed storage is inconsistent with s
+    csr_matrix( extents_type s, offsets_container_type row_offsets, indices_container_type column_indices, values_container_type values );
+    /// @brief Constructs a matrix holding the nonzero elements of a dense matrix
+    /// @tparam M dense matrix type
+    /// @param m matrix to be compressed
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class M >
+      requires detail::is_dense_matrix_v<M> && ::std::is_default_constructible_v<Alloc>
+    #else
+    template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> && ::std::is_default_constructible_v<Alloc> > >
+    #endif
+    explicit csr_matrix( const M& m );
+    /// @brief Constructs a matrix holding the nonzero elements of a dense matrix
+    /// @tparam M dense matrix type
+    /// @param m     matrix to be compressed
+    /// @param alloc allocator used to construct with
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class M >
+      requires detail::is_dense_matrix_v<M>
+    #else
+    template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+    #endif
+    csr_matrix( const M& m, const allocator_type& alloc );
+    /// @brief Default move assignment
+    csr_matrix& operator = ( csr_matrix&& )      = default;
+    /// @brief Default copy assignment
+    csr_matrix& operator = ( const csr_matrix& ) = default;
+
+    //- Size / Capacity
+
+    /// @brief Returns the current number of (rows, columns)
+    [[nodiscard]] constexpr extents_type size() const noexcept;
+    /// @brief Returns the current capacity of (rows, columns), which is always the size
+    [[nodiscard]] constexpr extents_type capacity() const noexcept;
+    /// @brief Returns the current number of columns
+    [[nodiscard]] constexpr size_type columns() const noexcept;
+    /// @brief Returns the current number of rows
+    [[nodiscard]] constexpr size_type rows() const noexcept;
+    /// @brief Returns the current column capacity
+    [[nodiscard]] constexpr size_type column_capacity() const noexcept;
+    /// @brief Returns the current row capacity
+    [[nodiscard]] constexpr size_type row_capacity() const noexcept;
+    /// @brief Returns the number of stored nonzeros
+    [[nodiscard]] size_type nonzeros() const noexcept;
+
+    //- Compressed storage
+
+    /// @brief Returns the offset of the first nonzero of each row, followed by the number of nonzeros
+    [[nodiscard]] const offsets_container_type& row_offsets() const noexcept;
+    /// @brief Returns the column index of each nonzero
+    [[nodiscard]] const indices_container_type& column_indices() const noexcept;
+    /// @brief Returns the value of each nonzero
+    [[nodiscard]] const values_container_type& values() const noexcept;
+
+    //- Const views
+
+    /// @brief Returns the value at (i, j) without index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, or zero if the element is not stored
+    #if LINALG_USE_BRACKET_OPERATOR
+    [[nodiscard]] value_type operator[]( index_type i, index_type j ) const noexcept;
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    [[nodiscard]] value_type operator()( index_type i, index_type j ) const noexcept;
+    #endif
+    /// @brief Returns the value at (i, j) with index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, or zero if the element is not stored
+    /// @throws out_of_range if (i, j) is outside the matrix
+    [[nodiscard]] value_type at( index_type i, index_type j ) const;
+
+    //- Allocator
+
+    /// @brief Returns a copy of the allocator used for values
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+  private:
+    //- Private functions
+
+    // Returns the value at (i, j), or zero if the element is not stored
+    [[nodiscard]] value_type find( index_type i, index_type j ) const noexcept;
+    // Compresses the nonzero elements of a dense matrix
+    template < class M >
+    void compress( const M& m );
+
+    //- Data
+
+    // Number of rows and columns
+    extents_type           size_;
+    // Offset of the first nonzero of each row
+    offsets_container_type row_offsets_;
+    // Column index of each nonzero
+    indices_container_type column_indices_;
+    // Value of each nonzero
+    values_container_type  values_;
+};
+
+//==================================================================================================
+//                                  I M P L E M E N T A T I O N
+//==================================================================================================
+
+//- Destructor / Constructors / Assignments
+
+template < class T, class Index, class Alloc >
+csr_matrix<T,Index,Alloc>::csr_matrix( const allocator_type& alloc ) :
+  size_(),
+  row_offsets_( 1, size_type( 0 ), alloc ),
+  column_indices_( alloc ),
+  values_( alloc )
+{
+}
+
+template < class T, class Index, class Alloc >
+csr_matrix<T,Index,Alloc>::csr_matrix( extents_type s ) :
+  csr_matrix( s, allocator_type() )
+{
+}
+
+template < class T, class Index, class Alloc >
+csr_matrix<T,Index,Alloc>::csr_matrix( extents_type s, const allocator_type& alloc ) :
+  size_( s ),
+  row_offsets_( s.extent(0) + 1, size_type( 0 ), alloc ),
+  column_indices_( alloc ),
+  values_( alloc )
+{
+}
+
+template < class T, class Index, class Alloc >
+csr_matrix<T,Index,Alloc>::csr_matrix( extents_type s, offsets_container_type row_offsets, indices_container_type column_indices, values_container_type values ) :
+  size_( s ),
+  row_offsets_( ::std::move( row_offsets ) ),
+  column_indices_( ::std::move( column_indices ) ),
+  values_( ::std::move( values ) )
+{
+  if ( ( this->row_offsets_.size() != s.extent(0) + 1 ) || ( this->row_offsets_.front() != 0 ) ||
+       ( this->row_offsets_.back() != this->values_.size() ) || ( this->column_indices_.size() != this->values_.size() ) )
+  {
+    throw invalid_argument( "Row offsets, column indices, and values are inconsistent." );
+  }
+  for ( size_type i = 0; i < s.extent(0); ++i )
+  {
+    if ( this->row_offsets_[i] > this->row_offsets_[i+1] )
+    {
+      throw invalid_argument( "Row offsets must be nondecreasing." );
+    }
+    for ( size_type k = this->row_offsets_[i]; k < this->row_offsets_[i+1]; ++k )
+    {
+      // Negative indices convert to sizes beyond any extent
+      if ( ( static_cast<size_type>( this->column_indices_[k] ) >= s.extent(1) ) ||
+           ( ( k > this->row_offsets_[i] ) && ( this->column_indices_[k] <= this->column_indices_[k-1] ) ) )
+      {
+        throw invalid_argument( "Column indices must be in bounds and strictly increasing within each row." );
+      }
+    }
+  }
+}
+
+template < class T, class Index, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M> && ::std::is_default_constructible_v<Alloc>
+#else
+template < class M, typename >
+#endif
+csr_matrix<T,Index,Alloc>::csr_matrix( const M& m ) :
+  csr_matrix( m, allocator_type() )
+{
+}
+
+template < class T, class Index, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, typename >
+#endif
+csr_matrix<T,Index,Alloc>::csr_matrix( const M& m, const allocator_type& alloc ) :
+  size_( m.rows(), m.columns() ),
+  row_offsets_( alloc ),
+  column_indices_( alloc ),
+  values_( alloc )
+{
+  this->compress( m );
+}
+
+//- Size / Capacity
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::extents_type
+csr_matrix<T,Index,Alloc>::size() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::extents_type
+csr_matrix<T,Index,Alloc>::capacity() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::size_type
+csr_matrix<T,Index,Alloc>::columns() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::size_type
+csr_matrix<T,Index,Alloc>::rows() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::size_type
+csr_matrix<T,Index,Alloc>::column_capacity() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] constexpr typename csr_matrix<T,Index,Alloc>::size_type
+csr_matrix<T,Index,Alloc>::row_capacity() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::size_type
+csr_matrix<T,Index,Alloc>::nonzeros() const noexcept
+{
+  return this->values_.size();
+}
+
+//- Compressed storage
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] const typename csr_matrix<T,Index,Alloc>::offsets_container_type&
+csr_matrix<T,Index,Alloc>::row_offsets() const noexcept
+{
+  return this->row_offsets_;
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] const typename csr_matrix<T,Index,Alloc>::indices_container_type&
+csr_matrix<T,Index,Alloc>::column_indices() const noexcept
+{
+  return this->column_indices_;
+}
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] const typename csr_matrix<T,Index,Alloc>::values_container_type&
+csr_matrix<T,Index,Alloc>::values() const noexcept
+{
+  return this->values_;
+}
+
+//- Const views
+
+#if LINALG_USE_BRACKET_OPERATOR
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::value_type
+csr_matrix<T,Index,Alloc>::operator[]( index_type i, index_type j ) const noexcept
+{
+  return this->find( i, j );
+}
+#endif
+
+#if LINALG_USE_PAREN_OPERATOR
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::value_type
+csr_matrix<T,Index,Alloc>::operator()( index_type i, index_type j ) const noexcept
+{
+  return this->find( i, j );
+}
+#endif
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::value_type
+csr_matrix<T,Index,Alloc>::at( index_type i, index_type j ) const
+{
+  // Negative indices convert to sizes beyond any extent
+  if ( ( static_cast<size_type>( i ) >= this->rows() ) || ( static_cast<size_type>( j ) >= this->columns() ) )
+  {
+    throw out_of_range( "Index is outside of the matrix." );
+  }
+  return this->find( i, j );
+}
+
+//- Allocator
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::allocator_type
+csr_matrix<T,Index,Alloc>::get_allocator() const noexcept
+{
+  return this->values_.get_allocator();
+}
+
+//- Private functions
+
+template < class T, class Index, class Alloc >
+[[nodiscard]] typename csr_matrix<T,Index,Alloc>::value_type
+csr_matrix<T,Index,Alloc>::find( index_type i, index_type j ) const noexcept
+{
+  const auto first = this->column_indices_.begin() + this->row_offsets_[i];
+  const auto last  = this->column_indices_.begin() + this->row_offsets_[i+1];
+  const auto pos   = ::std::lower_bound( first, last, j );
+  return ( ( pos != last ) && ( *pos == j ) ) ? this->values_[ pos - this->column_indices_.begin() ] : value_type {};
+}
+
+template < class T, class Index, class Alloc >
+template < class M >
+void csr_matrix<T,Index,Alloc>::compress( const M& m )
+{
+  const size_type rows    = m.rows();
+  const size_type columns = m.columns();
+  this->row_offsets_.assign( rows + 1, size_type( 0 ) );
+  for ( size_type i = 0; i < rows; ++i )
+  {
+    size_type count = 0;
+    for ( size_type j = 0; j < columns; ++j )
+    {
+      count += ( detail::access( m, i, j ) != value_type {} );
+    }
+    this->row_offsets_[i+1] = this->row_offsets_[i] + count;
+  }
+  this->column_indices_.resize( this->row_offsets_[rows] );
+  this->values_.resize( this->row_offsets_[rows] );
+  for ( size_type i = 0, k = 0; i < rows; ++i )
+  {
+    for ( size_type j = 0; j < columns; ++j )
+    {
+      const value_type value = detail::access( m, i, j );
+      if ( value != value_type {} )
+      {
+        this->column_indices_[k] = static_cast<index_type>( j );
+        this->values_[k++]       = value;
+      }
+    }
+  }
+}
+
+//==================================================================================================
+//  Sparse products
+//==================================================================================================
+
+/// @brief Computes y = a x, overwriting y
+/// @param a sparse matrix
+/// @param x vector of a.columns() elements
+/// @param y vector of a.rows() elements receiving the product
+/// @returns y
+/// @throws length_error if the sizes of a, x, and y are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, concepts::vector_data V, concepts::vector_data Y >
+#else
+template < class T, class Index, class Alloc, class V, class Y,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> && concepts::vector_data_v<Y> > >
+#endif
+inline Y& spmv( const csr_matrix<T,Index,Alloc>& a, const V& x, Y& y )
+{
+  using size_type = typename csr_matrix<T,Index,Alloc>::size_type;
+  if ( ( x.size().extent(0) != a.columns() ) || ( y.size().extent(0) != a.rows() ) )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  const size_type* offsets = a.row_offsets().data();
+  const Index*     columns = a.column_indices().data();
+  const auto*      values  = a.values().data();
+  const auto       gather  = detail::sparse_gather( x );
+  detail::sparse_for_each( offsets, a.rows(), [&]( size_type first, size_type last )
+  {
+    for ( size_type i = first; i < last; ++i )
+    {
+      detail::access( y, i ) = detail::sparse_dot< typename Y::value_type >( values + offsets[i], columns + offsets[i], offsets[i+1] - offsets[i], gather );
+    }
+  } );
+  return y;
+}
+
+/// @brief Returns the product a x
+/// @param a sparse matrix
+/// @param x vector of a.columns() elements
+/// @returns dynamic vector of a.rows() elements
+/// @throws length_error if the sizes of a and x are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Index, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto spmv( const csr_matrix<T,Index,Alloc>& a, const V& x )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename V::value_type>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if constexpr ( ::std::is_trivially_default_constructible_v<result_value_type> )
+  {
+    result_type y( typename result_type::extents_type( a.rows() ), uninitialized, typename result_type::allocator_type( a.get_allocator() ) );
+    spmv( a, x, y );
+    return y;
+  }
+  else
+  {
+    result_type y( typename result_type::extents_type( a.rows() ), typename result_type::allocator_type( a.get_allocator() ) );
+    spmv( a, x, y );
+    return y;
+  }
+}
+
+/// @brief Computes c = a b, overwriting c
+/// @param a sparse matrix
+/// @param b dense matrix of a.columns() rows
+/// @param c dense matrix of a.rows() rows and b.columns() columns receiving the product
+/// @returns c
+/// @throws length_error if the sizes of a, b, and c are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, class M, class C >
+  requires detail::is_dense_matrix_v<M> && detail::is_dense_matrix_v<C>
+#else
+template < class T, class Index, class Alloc, class M, class C,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> && detail::is_dense_matrix_v<C> > >
+#endif
+inline C& spmm( const csr_matrix<T,Index,Alloc>& a, const M& b, C& c )
+{
+  using size_type = typename csr_matrix<T,Index,Alloc>::size_type;
+  if ( ( b.rows() != a.columns() ) || ( c.rows() != a.rows() ) || ( c.columns() != b.columns() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  const size_type* offsets = a.row_offsets().data();
+  const Index*     columns = a.column_indices().data();
+  const auto*      values  = a.values().data();
+  const size_type  width   = b.columns();
+  // Each nonzero scales a row of b into a row of c, so the inner loop runs along rows of both
+  detail::sparse_for_each( offsets, a.rows(), [&]( size_type first, size_type last )
+  {
+    for ( size_type i = first; i < last; ++i )
+    {
+      for ( size_type l = 0; l < width; ++l )
+      {
+        detail::access( c, i, l ) = typename C::value_type {};
+      }
+      for ( size_type k = offsets[i]; k < offsets[i+1]; ++k )
+      {
+        const auto      value = values[k];
+        const size_type j     = static_cast<size_type>( columns[k] );
+        for ( size_type l = 0; l < width; ++l )
+        {
+          detail::access( c, i, l ) += value * detail::access( b, j, l );
+        }
+      }
+    }
+  } );
+  return c;
+}
+
+/// @brief Returns the product a b
+/// @param a sparse matrix
+/// @param b dense matrix of a.columns() rows
+/// @returns dynamic matrix of a.rows() rows and b.columns() columns
+/// @throws length_error if the sizes of a and b are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Index, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto spmm( const csr_matrix<T,Index,Alloc>& a, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename M::value_type>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if constexpr ( ::std::is_trivially_default_constructible_v<result_value_type> )
+  {
+    result_type c( typename result_type::extents_type( a.rows(), b.columns() ), uninitialized, typename result_type::allocator_type( a.get_allocator() ) );
+    spmm( a, b, c );
+    return c;
+  }
+  else
+  {
+    result_type c( typename result_type::extents_type( a.rows(), b.columns() ), typename result_type::allocator_type( a.get_allocator() ) );
+    spmm( a, b, c );
+    return c;
+  }
+}
+
+//=================================================================================================
+//  Sparse Matrix Vector product
+//=================================================================================================
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Index, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto
+operator * ( const csr_matrix<T,Index,Alloc>& a, const V& x )
+{
+  return spmv( a, x );
+}
+
+//=================================================================================================
+//  Sparse Matrix Dense Matrix product
+//=================================================================================================
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Index, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Index, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto
+operator * ( const csr_matrix<T,Index,Alloc>& a, const M& b )
+{
+  return spmm( a, b );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_CSR_MATRIX_HPP
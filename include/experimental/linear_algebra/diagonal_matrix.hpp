@@ -0,0 +1,837 @@
+//==================================================================================================
+//  File:       diagonal_matrix.hpp
+//
+//  Summary:    This header defines diagonal, identity, and scaled identity matrices. They store
+//              n, zero, and one diagonal values respectively, and their products, sums, and solves
+//              with vectors, dense matrices, and each other are computed in O(n) or O(n^2) without
+//              ever materializing the zeros off the diagonal.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_DIAGONAL_MATRIX_HPP
+#define LINEAR_ALGEBRA_DIAGONAL_MATRIX_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Is Diagonal Matrix returns true if the type is a diagonal, identity, or scaled identity matrix
+//==================================================================================================
+template < class M >
+struct is_diagonal_matrix : public ::std::false_type { };
+template < class T, class Structure, class Alloc >
+struct is_diagonal_matrix< diagonal_matrix<T,Structure,Alloc> > : public ::std::true_type { };
+template < class M >
+inline constexpr bool is_diagonal_matrix_v = is_diagonal_matrix<M>::value;
+
+//==================================================================================================
+//  Diagonal structures of results. Products of identities are identities; products and sums of
+//  identities and scaled identities are scaled identities; anything involving a general diagonal
+//  is a general diagonal.
+//==================================================================================================
+template < class S1, class S2 >
+using diagonal_product_structure_t =
+  ::std::conditional_t< ::std::is_same_v< S1, identity_t > && ::std::is_same_v< S2, identity_t >, identity_t,
+  ::std::conditional_t< ::std::is_same_v< S1, general_diagonal_t > || ::std::is_same_v< S2, general_diagonal_t >, general_diagonal_t,
+                        scaled_identity_t > >;
+template < class S1, class S2 >
+using diagonal_sum_structure_t =
+  ::std::conditional_t< ::std::is_same_v< S1, general_diagonal_t > || ::std::is_same_v< S2, general_diagonal_t >, general_diagonal_t,
+                        scaled_identity_t >;
+template < class S >
+using diagonal_scaled_structure_t = ::std::conditional_t< ::std::is_same_v< S, identity_t >, scaled_identity_t, S >;
+
+//==================================================================================================
+//  Make Diagonal returns a diagonal matrix of the given structure whose diagonal values are
+//  lambda( i ). Only the values the structure stores are computed.
+//==================================================================================================
+template < class Structure, class R, class Alloc, class Lambda >
+[[nodiscard]] inline auto make_diagonal( ::std::size_t n, const Alloc& alloc, Lambda&& lambda )
+{
+  using result_type = diagonal_matrix< R, Structure, typename ::std::allocator_traits<Alloc>::template rebind_alloc<R> >;
+  const typename result_type::extents_type     s( n, n );
+  const typename result_type::allocator_type result_alloc( alloc );
+  if constexpr ( ::std::is_same_v< Structure, general_diagonal_t > )
+  {
+    return result_type( s, [&lambda]( auto i ) { return static_cast<R>( lambda( static_cast<::std::size_t>( i ) ) ); }, result_alloc );
+  }
+  else if constexpr ( ::std::is_same_v< Structure, scaled_identity_t > )
+  {
+    return result_type( s, static_cast<R>( lambda( ::std::size_t( 0 ) ) ), result_alloc );
+  }
+  else
+  {
+    return result_type( s, result_alloc );
+  }
+}
+
+//==================================================================================================
+//  Check Nonsingular throws if a diagonal value of the diagonal matrix is zero
+//==================================================================================================
+template < class D >
+inline void check_nonsingular( const D& d )
+{
+  const auto values = d.diagonal_span();
+  for ( ::std::size_t i = 0; i < values.extent(0); ++i )
+  {
+    if ( values[i] == typename D::value_type {} )
+    {
+      throw domain_error( "Matrix is singular." );
+    }
+  }
+}
+
+}       //- detail namespace
+
+/// @brief Square matrix which is zero off the diagonal. General diagonal matrices store every
+///        diagonal value, scaled identity matrices store one value shared by the whole diagonal,
+///        and identity matrices store nothing but their size.
+//         Implementation satisfies the following concepts:
+//         concepts::matrix_data
+//         Element access returns values; stored diagonal values are written through diagonal_span().
+//         Row, column, and submatrix views are not provided as the zeros are not stored.
+/// @tparam T         element_type
+/// @tparam Structure general_diagonal_t, identity_t, or scaled_identity_t
+/// @tparam Alloc     allocator_type
+template < class T,
+           class Structure,
+           class Alloc >
+class diagonal_matrix
+{
+  static_assert( ::std::is_same_v< Structure, general_diagonal_t > || ::std::is_same_v< Structure, identity_t > || ::std::is_same_v< Structure, scaled_identity_t >,
+                 "The structure must be general_diagonal_t, identity_t, or scaled_identity_t." );
+
+  public:
+    //- Types
+
+    /// @brief Structure selecting which diagonal values are stored
+    using structure_type           = Structure;
+    /// @brief Type of elements
+    using element_type             = T;
+    /// @brief Type returned by const index access
+    using value_type               = ::std::remove_cv_t<element_type>;
+    /// @brief Type of allocator used to get memory
+    using allocator_type           = Alloc;
+    /// @brief Type used for indexing
+    using index_type               = ::std::ptrdiff_t;
+    /// @brief Type used for size along any dimension
+    using size_type                = ::std::size_t;
+    /// @brief Type used to express size of matrix
+    using extents_type             = ::std::experimental::extents<size_type,dynamic_extent,dynamic_extent>;
+    /// @brief Type used to represent a node in the matrix
+    using tuple_type               = ::std::tuple<index_type,index_type>;
+    /// @brief Type used to view the stored diagonal values: n, one, or none of them
+    using diagonal_span_type       = ::std::experimental::mdspan<element_type,::std::experimental::extents<size_type,dynamic_extent>>;
+    /// @brief Type used to const view the stored diagonal values: n, one, or none of them
+    using const_diagonal_span_type = ::std::experimental::mdspan<const element_type,::std::experimental::extents<size_type,dynamic_extent>>;
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Default destructor
+    ~diagonal_matrix()                                = default;
+    /// @brief Default constructor
+    diagonal_matrix()                                 = default;
+    /// @brief Default move constructor
+    diagonal_matrix( diagonal_matrix&& )              = default;
+    /// @brief Default copy constructor
+    diagonal_matrix( const diagonal_matrix& )         = default;
+    /// @brief Constructs a matrix of the specified size, which is zero unless it is an identity
+    /// @param s number of rows and columns
+    /// @throws length_error if s is not square
+    explicit diagonal_matrix( extents_type s );
+    /// @brief Constructs a matrix of the specified size, which is zero unless it is an identity
+    /// @param s     number of rows and columns
+    /// @param alloc allocator used to construct with
+    /// @throws length_error if s is not square
+    diagonal_matrix( extents_type s, const allocator_type& alloc );
+    /// @brief Constructs a general or scaled identity matrix with every diagonal value equal to value
+    /// @param s     number of rows and columns
+    /// @param value diagonal value
+    /// @throws length_error if s is not square
+    diagonal_matrix( extents_type s, const element_type& value );
+    /// @brief Constructs a general or scaled identity matrix with every diagonal value equal to value
+    /// @param s     number of rows and columns
+    /// @param value diagonal value
+    /// @param alloc allocator used to construct with
+    /// @throws length_error if s is not square
+    diagonal_matrix( extents_type s, const element_type& value, const allocator_type& alloc );
+    /// @brief Constructs a general diagonal matrix by applying lambda to every diagonal index
+    /// @tparam Lambda lambda expression with an operator()( index ) defined
+    /// @param s      number of rows and columns
+    /// @param lambda lambda expression returning the value on row and column index
+    /// @throws length_error if s is not square
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    diagonal_matrix( extents_type s, Lambda&& lambda )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs a general diagonal matrix by applying lambda to every diagonal index
+    /// @tparam Lambda lambda expression with an operator()( index ) defined
+    /// @param s      number of rows and columns
+    /// @param lambda lambda expression returning the value on row and column index
+    /// @param alloc  allocator used to construct with
+    /// @throws length_error if s is not square
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    diagonal_matrix( extents_type s, Lambda&& lambda, const allocator_type& alloc )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs a general diagonal matrix whose diagonal is the vector v
+    /// @tparam V vector type
+    /// @param v diagonal values
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < concepts::vector_data V >
+    #else
+    template < class V, typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+    #endif
+    explicit diagonal_matrix( const V& v );
+    /// @brief Constructs a general diagonal matrix whose diagonal is the vector v
+    /// @tparam V vector type
+    /// @param v     diagonal values
+    /// @param alloc allocator used to construct with
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < concepts::vector_data V >
+    #else
+    template < class V, typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+    #endif
+    diagonal_matrix( const V& v, const allocator_type& alloc );
+    /// @brief Default move assignment
+    diagonal_matrix& operator = ( diagonal_matrix&& )      = default;
+    /// @brief Default copy assignment
+    diagonal_matrix& operator = ( const diagonal_matrix& ) = default;
+
+    //- Size / Capacity
+
+    /// @brief Returns the current number of (rows, columns)
+    [[nodiscard]] constexpr extents_type size() const noexcept;
+    /// @brief Returns the current capacity of (rows, columns), which is always the size
+    [[nodiscard]] constexpr extents_type capacity() const noexcept;
+    /// @brief Returns the current number of columns
+    [[nodiscard]] constexpr size_type columns() const noexcept;
+    /// @brief Returns the current number of rows
+    [[nodiscard]] constexpr size_type rows() const noexcept;
+    /// @brief Returns the current column capacity
+    [[nodiscard]] constexpr size_type column_capacity() const noexcept;
+    /// @brief Returns the current row capacity
+    [[nodiscard]] constexpr size_type row_capacity() const noexcept;
+
+    //- Const views
+
+    /// @brief Returns the value at (i, j) without index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, which is zero off the diagonal
+    #if LINALG_USE_BRACKET_OPERATOR
+    [[nodiscard]] value_type operator[]( index_type i, index_type j ) const noexcept;
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    [[nodiscard]] value_type operator()( index_type i, index_type j ) const noexcept;
+    #endif
+    /// @brief Returns the value at (i, j) with index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j, which is zero off the diagonal
+    /// @throws out_of_range if (i, j) is outside the matrix
+    [[nodiscard]] value_type at( index_type i, index_type j ) const;
+    /// @brief Returns the diagonal value at (i, i) without index bounds checking
+    /// @param i row and column index
+    [[nodiscard]] value_type diagonal( index_type i ) const noexcept;
+    /// @brief Returns a const view of the stored diagonal values
+    [[nodiscard]] const_diagonal_span_type diagonal_span() const noexcept;
+
+    //- Mutable views
+
+    /// @brief Returns a mutable view of the stored diagonal values
+    [[nodiscard]] diagonal_span_type diagonal_span() noexcept;
+
+    //- Allocator
+
+    /// @brief Returns a copy of the allocator used to get memory
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+  private:
+    //- Data
+
+    // Number of rows and columns
+    extents_type                               size_;
+    // Stored diagonal values
+    ::std::vector<element_type,allocator_type> elems_;
+};
+
+//==================================================================================================
+//                                  I M P L E M E N T A T I O N
+//==================================================================================================
+
+//- Destructor / Constructors / Assignments
+
+template < class T, class Structure, class Alloc >
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s ) :
+  diagonal_matrix( s, allocator_type() )
+{
+}
+
+template < class T, class Structure, class Alloc >
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s, const allocator_type& alloc ) :
+  size_( s ),
+  elems_( alloc )
+{
+  if ( s.extent(0) != s.extent(1) )
+  {
+    throw length_error( "Diagonal matrices must be square." );
+  }
+  if constexpr ( ::std::is_same_v< Structure, general_diagonal_t > )
+  {
+    this->elems_.assign( s.extent(0), value_type {} );
+  }
+  else if constexpr ( ::std::is_same_v< Structure, scaled_identity_t > )
+  {
+    this->elems_.assign( 1, value_type {} );
+  }
+}
+
+template < class T, class Structure, class Alloc >
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s, const element_type& value ) :
+  diagonal_matrix( s, value, allocator_type() )
+{
+}
+
+template < class T, class Structure, class Alloc >
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s, const element_type& value, const allocator_type& alloc ) :
+  diagonal_matrix( s, alloc )
+{
+  static_assert( !::std::is_same_v< Structure, identity_t >, "The diagonal values of an identity matrix are fixed." );
+  ::std::fill( this->elems_.begin(), this->elems_.end(), value );
+}
+
+template < class T, class Structure, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s, Lambda&& lambda )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename diagonal_matrix<T,Structure,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename diagonal_matrix<T,Structure,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  diagonal_matrix( s, ::std::forward<Lambda>( lambda ), allocator_type() )
+{
+}
+
+template < class T, class Structure, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( extents_type s, Lambda&& lambda, const allocator_type& alloc )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename diagonal_matrix<T,Structure,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename diagonal_matrix<T,Structure,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  diagonal_matrix( s, alloc )
+{
+  static_assert( ::std::is_same_v< Structure, general_diagonal_t >, "Only general diagonal matrices store a value for each index." );
+  for ( size_type i = 0; i < this->elems_.size(); ++i )
+  {
+    this->elems_[i] = lambda( static_cast<index_type>( i ) );
+  }
+}
+
+template < class T, class Structure, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::vector_data V >
+#else
+template < class V, typename >
+#endif
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( const V& v ) :
+  diagonal_matrix( v, allocator_type() )
+{
+}
+
+template < class T, class Structure, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < concepts::vector_data V >
+#else
+template < class V, typename >
+#endif
+diagonal_matrix<T,Structure,Alloc>::diagonal_matrix( const V& v, const allocator_type& alloc ) :
+  diagonal_matrix( extents_type( v.size().extent(0), v.size().extent(0) ),
+                   [&v]( index_type i ) { return static_cast<element_type>( detail::access( v, i ) ); }, alloc )
+{
+}
+
+//- Size / Capacity
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::extents_type
+diagonal_matrix<T,Structure,Alloc>::size() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::extents_type
+diagonal_matrix<T,Structure,Alloc>::capacity() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::size_type
+diagonal_matrix<T,Structure,Alloc>::columns() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::size_type
+diagonal_matrix<T,Structure,Alloc>::rows() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::size_type
+diagonal_matrix<T,Structure,Alloc>::column_capacity() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] constexpr typename diagonal_matrix<T,Structure,Alloc>::size_type
+diagonal_matrix<T,Structure,Alloc>::row_capacity() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+//- Const views
+
+#if LINALG_USE_BRACKET_OPERATOR
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::value_type
+diagonal_matrix<T,Structure,Alloc>::operator[]( index_type i, index_type j ) const noexcept
+{
+  return ( i == j ) ? this->diagonal( i ) : value_type {};
+}
+#endif
+
+#if LINALG_USE_PAREN_OPERATOR
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::value_type
+diagonal_matrix<T,Structure,Alloc>::operator()( index_type i, index_type j ) const noexcept
+{
+  return ( i == j ) ? this->diagonal( i ) : value_type {};
+}
+#endif
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::value_type
+diagonal_matrix<T,Structure,Alloc>::at( index_type i, index_type j ) const
+{
+  // Negative indices convert to sizes beyond any extent
+  if ( ( static_cast<size_type>( i ) >= this->rows() ) || ( static_cast<size_type>( j ) >= this->columns() ) )
+  {
+    throw out_of_range( "Index is outside of the matrix." );
+  }
+  return ( i == j ) ? this->diagonal( i ) : value_type {};
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::value_type
+diagonal_matrix<T,Structure,Alloc>::diagonal( [[maybe_unused]] index_type i ) const noexcept
+{
+  if constexpr ( ::std::is_same_v< Structure, general_diagonal_t > )
+  {
+    return this->elems_[ static_cast<size_type>( i ) ];
+  }
+  else if constexpr ( ::std::is_same_v< Structure, scaled_identity_t > )
+  {
+    return this->elems_[0];
+  }
+  else
+  {
+    return value_type( 1 );
+  }
+}
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::const_diagonal_span_type
+diagonal_matrix<T,Structure,Alloc>::diagonal_span() const noexcept
+{
+  return const_diagonal_span_type( this->elems_.data(), this->elems_.size() );
+}
+
+//- Mutable views
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::diagonal_span_type
+diagonal_matrix<T,Structure,Alloc>::diagonal_span() noexcept
+{
+  return diagonal_span_type( this->elems_.data(), this->elems_.size() );
+}
+
+//- Allocator
+
+template < class T, class Structure, class Alloc >
+[[nodiscard]] typename diagonal_matrix<T,Structure,Alloc>::allocator_type
+diagonal_matrix<T,Structure,Alloc>::get_allocator() const noexcept
+{
+  return this->elems_.get_allocator();
+}
+
+//==================================================================================================
+//  Diagonal matrix arithmetic
+//==================================================================================================
+
+/// @brief Returns the diagonal matrix itself, which is its own transpose
+template < class T, class Structure, class Alloc >
+[[nodiscard]] inline diagonal_matrix<T,Structure,Alloc> trans( const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  return d;
+}
+
+/// @brief Returns the conjugate transpose, conjugating only the stored diagonal values
+template < class T, class Structure, class Alloc >
+[[nodiscard]] inline diagonal_matrix<T,Structure,Alloc> conj( const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  auto       result = d;
+  const auto values = result.diagonal_span();
+  for ( ::std::size_t i = 0; i < values.extent(0); ++i )
+  {
+    values[i] = detail::conjugate( values[i] );
+  }
+  return result;
+}
+
+/// @brief Returns the negated diagonal matrix in O(n)
+template < class T, class Structure, class Alloc >
+[[nodiscard]] inline auto operator - ( const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  return detail::make_diagonal< detail::diagonal_scaled_structure_t<Structure>, T >( d.rows(), d.get_allocator(), [&d]( ::std::size_t i )
+    { return -d.diagonal( static_cast<::std::ptrdiff_t>( i ) ); } );
+}
+
+/// @brief Returns the diagonal matrix scaled by s in O(n)
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class S, class T, class Structure, class Alloc >
+  requires ( !concepts::tensor_data<S> ) && requires { ::std::declval<S>() * ::std::declval<T>(); }
+#else
+template < class S, class T, class Structure, class Alloc,
+           typename = ::std::enable_if_t< !concepts::tensor_data_v<S> && concepts::product_exists_v< T, S > > >
+#endif
+[[nodiscard]] inline auto operator * ( const S& s, const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<S>() * ::std::declval<T>() ) >;
+  return detail::make_diagonal< detail::diagonal_scaled_structure_t<Structure>, result_value_type >( d.rows(), d.get_allocator(), [&s,&d]( ::std::size_t i )
+    { return s * d.diagonal( static_cast<::std::ptrdiff_t>( i ) ); } );
+}
+
+/// @brief Returns the diagonal matrix scaled by s in O(n)
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class S >
+  requires ( !concepts::tensor_data<S> ) && requires { ::std::declval<T>() * ::std::declval<S>(); }
+#else
+template < class T, class Structure, class Alloc, class S,
+           typename = ::std::enable_if_t< !concepts::tensor_data_v<S> && concepts::product_exists_v< T, S > > >
+#endif
+[[nodiscard]] inline auto operator * ( const diagonal_matrix<T,Structure,Alloc>& d, const S& s )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<S>() ) >;
+  return detail::make_diagonal< detail::diagonal_scaled_structure_t<Structure>, result_value_type >( d.rows(), d.get_allocator(), [&s,&d]( ::std::size_t i )
+    { return d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) * s; } );
+}
+
+/// @brief Returns the diagonal matrix divided by s in O(n)
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class S >
+  requires ( !concepts::tensor_data<S> ) && requires { ::std::declval<T>() / ::std::declval<S>(); }
+#else
+template < class T, class Structure, class Alloc, class S,
+           typename = ::std::enable_if_t< !concepts::tensor_data_v<S> >,
+           typename = ::std::void_t< decltype( ::std::declval<T>() / ::std::declval<S>() ) > >
+#endif
+[[nodiscard]] inline auto operator / ( const diagonal_matrix<T,Structure,Alloc>& d, const S& s )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() / ::std::declval<S>() ) >;
+  return detail::make_diagonal< detail::diagonal_scaled_structure_t<Structure>, result_value_type >( d.rows(), d.get_allocator(), [&s,&d]( ::std::size_t i )
+    { return d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) / s; } );
+}
+
+/// @brief Returns the product of two diagonal matrices in O(n), keeping the narrowest structure
+/// @throws length_error if the sizes of d1 and d2 are incompatible
+template < class T1, class S1, class A1, class T2, class S2, class A2 >
+[[nodiscard]] inline auto operator * ( const diagonal_matrix<T1,S1,A1>& d1, const diagonal_matrix<T2,S2,A2>& d2 )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T1>() * ::std::declval<T2>() ) >;
+  if ( d1.columns() != d2.rows() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return detail::make_diagonal< detail::diagonal_product_structure_t<S1,S2>, result_value_type >( d1.rows(), d1.get_allocator(), [&d1,&d2]( ::std::size_t i )
+    { return d1.diagonal( static_cast<::std::ptrdiff_t>( i ) ) * d2.diagonal( static_cast<::std::ptrdiff_t>( i ) ); } );
+}
+
+/// @brief Returns the sum of two diagonal matrices in O(n), keeping the narrowest structure
+/// @throws length_error if the sizes of d1 and d2 are incompatible
+template < class T1, class S1, class A1, class T2, class S2, class A2 >
+[[nodiscard]] inline auto operator + ( const diagonal_matrix<T1,S1,A1>& d1, const diagonal_matrix<T2,S2,A2>& d2 )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T1>() + ::std::declval<T2>() ) >;
+  if ( d1.size() != d2.size() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return detail::make_diagonal< detail::diagonal_sum_structure_t<S1,S2>, result_value_type >( d1.rows(), d1.get_allocator(), [&d1,&d2]( ::std::size_t i )
+    { return d1.diagonal( static_cast<::std::ptrdiff_t>( i ) ) + d2.diagonal( static_cast<::std::ptrdiff_t>( i ) ); } );
+}
+
+/// @brief Returns the difference of two diagonal matrices in O(n), keeping the narrowest structure
+/// @throws length_error if the sizes of d1 and d2 are incompatible
+template < class T1, class S1, class A1, class T2, class S2, class A2 >
+[[nodiscard]] inline auto operator - ( const diagonal_matrix<T1,S1,A1>& d1, const diagonal_matrix<T2,S2,A2>& d2 )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T1>() - ::std::declval<T2>() ) >;
+  if ( d1.size() != d2.size() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return detail::make_diagonal< detail::diagonal_sum_structure_t<S1,S2>, result_value_type >( d1.rows(), d1.get_allocator(), [&d1,&d2]( ::std::size_t i )
+    { return d1.diagonal( static_cast<::std::ptrdiff_t>( i ) ) - d2.diagonal( static_cast<::std::ptrdiff_t>( i ) ); } );
+}
+
+/// @brief Returns the product d x in O(n)
+/// @throws length_error if the sizes of d and x are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Structure, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> >,
+           typename = ::std::enable_if_t<true>,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto operator * ( const diagonal_matrix<T,Structure,Alloc>& d, const V& x )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename V::value_type>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( x.size().extent(0) != d.columns() )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( d.rows() ),
+                      [&d,&x]( auto i ) { return result_value_type( d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) * detail::access( x, i ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the product d b, scaling each row of the dense matrix b in one pass over b
+/// @throws length_error if the sizes of d and b are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto operator * ( const diagonal_matrix<T,Structure,Alloc>& d, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename M::value_type>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.rows() != d.columns() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( b.rows(), b.columns() ),
+                      [&d,&b]( auto i, auto j ) { return result_value_type( d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) * detail::access( b, i, j ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the product a d, scaling each column of the dense matrix a in one pass over a
+/// @throws length_error if the sizes of a and d are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class T, class Structure, class Alloc >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, class T, class Structure, class Alloc,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto operator * ( const M& a, const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() * ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( a.columns() != d.rows() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( a.rows(), a.columns() ),
+                      [&d,&a]( auto i, auto j ) { return result_value_type( detail::access( a, i, j ) * d.diagonal( static_cast<::std::ptrdiff_t>( j ) ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the sum d + b, copying the dense matrix b and adding to its diagonal
+/// @throws length_error if the sizes of d and b are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto operator + ( const diagonal_matrix<T,Structure,Alloc>& d, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() + ::std::declval<typename M::value_type>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( b.rows() != d.rows() ) || ( b.columns() != d.columns() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( b.rows(), b.columns() ),
+                      [&d,&b]( auto i, auto j ) { return result_value_type( ( i == j ) ? d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) + detail::access( b, i, j ) : detail::access( b, i, j ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the sum a + d, copying the dense matrix a and adding to its diagonal
+/// @throws length_error if the sizes of a and d are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class T, class Structure, class Alloc >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, class T, class Structure, class Alloc,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto operator + ( const M& a, const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() + ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( a.rows() != d.rows() ) || ( a.columns() != d.columns() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( a.rows(), a.columns() ),
+                      [&d,&a]( auto i, auto j ) { return result_value_type( ( i == j ) ? detail::access( a, i, j ) + d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) : detail::access( a, i, j ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the difference d - b, negating the dense matrix b and adding to its diagonal
+/// @throws length_error if the sizes of d and b are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto operator - ( const diagonal_matrix<T,Structure,Alloc>& d, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() - ::std::declval<typename M::value_type>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( b.rows() != d.rows() ) || ( b.columns() != d.columns() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( b.rows(), b.columns() ),
+                      [&d,&b]( auto i, auto j ) { return result_value_type( ( i == j ) ? d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) - detail::access( b, i, j ) : -detail::access( b, i, j ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns the difference a - d, copying the dense matrix a and subtracting from its diagonal
+/// @throws length_error if the sizes of a and d are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class T, class Structure, class Alloc >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class M, class T, class Structure, class Alloc,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto operator - ( const M& a, const diagonal_matrix<T,Structure,Alloc>& d )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() - ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( ( a.rows() != d.rows() ) || ( a.columns() != d.columns() ) )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  return result_type( typename result_type::extents_type( a.rows(), a.columns() ),
+                      [&d,&a]( auto i, auto j ) { return result_value_type( ( i == j ) ? detail::access( a, i, j ) - d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) : detail::access( a, i, j ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns x solving d x = b in O(n)
+/// @throws length_error if the sizes of d and b are incompatible
+/// @throws domain_error if d is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Structure, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto solve( const diagonal_matrix<T,Structure,Alloc>& d, const V& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename V::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.size().extent(0) != d.rows() )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  detail::check_nonsingular( d );
+  return result_type( typename result_type::extents_type( d.rows() ),
+                      [&d,&b]( auto i ) { return result_value_type( detail::access( b, i ) / d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+/// @brief Returns x solving d x = b for every column of the dense matrix b, scaling each row of b
+///        in one pass over b
+/// @throws length_error if the sizes of d and b are incompatible
+/// @throws domain_error if d is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto solve( const diagonal_matrix<T,Structure,Alloc>& d, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.rows() != d.rows() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  detail::check_nonsingular( d );
+  return result_type( typename result_type::extents_type( b.rows(), b.columns() ),
+                      [&d,&b]( auto i, auto j ) { return result_value_type( detail::access( b, i, j ) / d.diagonal( static_cast<::std::ptrdiff_t>( i ) ) ); },
+                      typename result_type::allocator_type( d.get_allocator() ) );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_DIAGONAL_MATRIX_HPP
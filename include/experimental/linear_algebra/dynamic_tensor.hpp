@@ -17,6 +17,29 @@ namespace experimental
 namespace math
 {
 
+/// @brief Traits defining how the capacity of a dynamic tensor grows when a resize exceeds it.
+///        Each dimension which must grow is scaled by its factor, and grown to at least the
+///        required extent plus its slack. Specialize for a particular dr_tensor to change its growth.
+/// @tparam Tensor dynamic tensor type
+template < class Tensor >
+struct growth_traits
+{
+  /// @brief Factor by which each dimension of the capacity grows
+  static constexpr ::std::array<double,Tensor::extents_type::rank()> factor = []() constexpr
+  {
+    ::std::array<double,Tensor::extents_type::rank()> factors {};
+    for ( auto& f : factors ) { f = LINALG_GROWTH_FACTOR; }
+    return factors;
+  }();
+  /// @brief Minimum number of elements of slack added to each dimension of the capacity
+  static constexpr ::std::array<::std::size_t,Tensor::extents_type::rank()> slack = []() constexpr
+  {
+    ::std::array<::std::size_t,Tensor::extents_type::rank()> slacks {};
+    for ( auto& s : slacks ) { s = LINALG_GROWTH_SLACK; }
+    return slacks;
+  }();
+};
+
 /// @brief Dynamic-size, dynamic-capacity tensor.
 //         Implementation satisfies the following concepts:
 //         concepts::dynamic_tensor
@@ -152,8 +175,9 @@ class dr_tensor
     /// @brief Move constructor
     /// @param dr_tensor to be moved
     constexpr dr_tensor( dr_tensor&& rhs )
-      noexcept( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment{} ||
-                typename ::std::allocator_traits<allocator_type>::is_always_equal{} );
+      noexcept( ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment{} ||
+                  typename ::std::allocator_traits<allocator_type>::is_always_equal{} ) &&
+                ( ( detail::inline_capacity_v<allocator_type> == 0 ) || ::std::is_nothrow_copy_constructible_v<element_type> ) );
     /// @brief Copy constructor
     /// @param dr_tensor to be copied
     constexpr dr_tensor( const dr_tensor& rhs );
@@ -191,6 +215,17 @@ class dr_tensor
     #else
       ;
     #endif
+    /// @brief Attempt to allocate sufficient resources for a size tensor without initializing its elements
+    /// @param s defines the length of each dimension of the tensor
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_default_constructible_v<allocator_type> && ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    constexpr dr_tensor( extents_type s, uninitialized_t )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_default_constructible_v<allocator_type> && ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Attempt to allocate sufficient resources for a size tensor with the input capacity and construct
     /// @param s defines the length of each dimension of the tensor
     /// @param cap defines the capacity along each of the dimensions of the tensor
@@ -255,6 +290,18 @@ class dr_tensor
     /// @param s defines the length of each dimension of the tensor
     /// @param alloc allocator used to construct with
     constexpr dr_tensor( extents_type s, const allocator_type& alloc );
+    /// @brief Attempt to allocate sufficient resources for a size tensor without initializing its elements
+    /// @param s defines the length of each dimension of the tensor
+    /// @param alloc allocator used to construct with
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    constexpr dr_tensor( extents_type s, uninitialized_t, const allocator_type& alloc )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Attempt to allocate sufficient resources for a size tensor with the input capacity and construct
     /// @param s defines the length of each dimension of the tensor
     /// @param cap defines the capacity along each of the dimensions of the tensor
@@ -295,12 +342,44 @@ class dr_tensor
     #else
       ;
     #endif
+    /// @brief Attempt to allocate sufficient resources and value initialize every element in parallel.
+    ///        The whole capacity is first touched by the workers of the pool under a static partition,
+    ///        so on first-touch systems pages are spread across the NUMA nodes of those workers.
+    ///        Placement is best-effort: later kernels schedule their work independently and are
+    ///        only likely to agree with it when they are also given a statically partitioned policy.
+    /// @param s defines the length of each dimension of the tensor
+    /// @param cap defines the capacity along each of the dimensions of the tensor
+    /// @param policy thread pool policy used to construct the elements
+    /// @param alloc allocator used to construct with
+    constexpr dr_tensor( extents_type s, extents_type cap, const thread_pool_policy& policy, const allocator_type& alloc );
+    /// @brief Construct by applying lambda to every element in the tensor in parallel.
+    ///        The whole capacity is first touched by the workers of the pool under a static
+    ///        partition; as with the value initializing overload placement is best-effort.
+    /// @tparam Lambda lambda expression with an operator()( indices ... ) defined
+    /// @param s defines the length of each dimension of the tensor
+    /// @param cap defines the capacity along each of the dimensions of the tensor
+    /// @param lambda lambda expression to be performed on each element
+    /// @param policy thread pool policy used to construct the elements
+    /// @param alloc allocator used to construct with
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< convertible_lambda_expression_v< Lambda, ::std::make_integer_sequence<index_type,R> > > >
+    #endif
+    constexpr dr_tensor( extents_type s, extents_type cap, Lambda&& lambda, const thread_pool_policy& policy, const allocator_type& alloc )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires convertible_lambda_expression_v< Lambda, ::std::make_integer_sequence<index_type,R> >;
+    #else
+      ;
+    #endif
     /// @brief Move assignment
     /// @param  dr_tensor to be moved
     /// @return self
     constexpr dr_tensor& operator = ( dr_tensor&& rhs )
-      noexcept( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment() ||
-                typename ::std::allocator_traits<allocator_type>::is_always_equal() );
+      noexcept( ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment() ||
+                  typename ::std::allocator_traits<allocator_type>::is_always_equal() ) &&
+                ( ( detail::inline_capacity_v<allocator_type> == 0 ) || ::std::is_nothrow_copy_constructible_v<element_type> ) );
     /// @brief Copy assignment
     /// @param  fs_tensor to be copied
     /// @return self
@@ -342,6 +421,8 @@ class dr_tensor
     /// @brief Attempts to reserve the capacity of the tensor to the input extents
     /// @param new_size extents type defining the new capacity along each dimension of the tensor
     constexpr void reserve( extents_type new_cap );
+    /// @brief Reduces the capacity of the tensor to the smallest capacity able to hold its size
+    constexpr void shrink_to_fit();
 
     //- Memory access
 
@@ -355,6 +436,9 @@ class dr_tensor
     /// @brief returns the allocator being used
     /// @returns the allocator being used
     [[nodiscard]] constexpr const allocator_type& get_allocator() const & noexcept;
+    /// @brief Returns true if the elements are stored within the tensor rather than allocated.
+    ///        Only tensors whose allocator advertises an inline_capacity store elements inline.
+    [[nodiscard]] constexpr bool is_inline() const noexcept;
 
     //- Data access
     
@@ -475,8 +559,13 @@ class dr_tensor
   private:
     //- Data
   
+    /// @brief Number of elements which may be stored within the tensor
+    static constexpr size_t inline_capacity = detail::inline_capacity_v<allocator_type>;
+
     /// @brief Allocator used for memory management
     [[no_unique_address]] allocator_type alloc_;
+    /// @brief Storage for elements which fit within the tensor
+    [[no_unique_address]] detail::inline_buffer<element_type,inline_capacity> inline_;
     /// @brief Maintains current capacity
     extents_type                         cap_;
     /// @brief Pointer to beginning of elements
@@ -510,8 +599,39 @@ class dr_tensor
     constexpr void resize_impl( extents_type new_size, [[maybe_unused]] ::std::integer_sequence<SizeType,Indices...> );
     // Returns an extents which is the maximum of the two inputs
     static constexpr extents_type max_extents( extents_type extents_a, extents_type extents_b ) noexcept;
+    // Returns the capacity grown to hold the required extents. Dimensions which must grow are grown
+    // geometrically as defined by growth_traits<dr_tensor>.
+    static constexpr extents_type grow_extents( extents_type cap, extents_type required ) noexcept;
+    // Moves the elements into new memory of the input capacity and sets the new size.
+    // Elements outside of the current size are default constructed.
+    template < size_t ... Indices >
+    inline void reallocate( extents_type new_size, extents_type new_cap, [[maybe_unused]] ::std::index_sequence<Indices...> );
+    // Default constructs elements of the view outside of the input extents
+    template < size_t ... Indices >
+    constexpr void construct_outside( extents_type old_size, [[maybe_unused]] ::std::index_sequence<Indices...> );
+    // Copy constructs all elements from a tensor of the same type
+    inline void copy_elements( const dr_tensor& rhs );
+    // True if elements may be relocated and copied as raw memory in contiguous runs
+    static constexpr bool is_bulk_copyable = ::std::is_trivially_copyable_v<element_type> &&
+                                             ::std::is_same_v< accessor_type, ::std::experimental::default_accessor<element_type> > &&
+                                             ( ::std::is_same_v< L, ::std::experimental::layout_right > ||
+                                               ::std::is_same_v< L, ::std::experimental::layout_left > );
+    // Allocates storage for n elements, within the tensor if they fit its free inline buffer
+    [[nodiscard]] element_type* allocate_elements( size_t n );
+    // Deallocates storage returned from allocate_elements
+    void deallocate_elements( element_type* p, size_t n ) noexcept;
+    // Writes zeros to the raw storage page by page in parallel, so each page of the capacity is
+    // placed by a worker of the pool rather than by whichever thread happens to touch it later
+    void first_touch_capacity( const thread_pool_policy& policy ) noexcept;
     // Returns the total number of elements allocated
     [[nodiscard]] constexpr size_t linear_capacity() noexcept;
+    // Returns the number of elements to allocate for the given capacity
+    [[nodiscard]] static constexpr size_t linear_capacity( extents_type cap ) noexcept;
+    // Returns the capacity padded for the layout and allocator, checked as by checked_capacity
+    [[nodiscard]] static constexpr extents_type padded_capacity( extents_type cap );
+    // Returns the capacity unchanged. Throws length_error if the layout is recursive and would span
+    // far more elements than the capacity holds, as Morton order does for very unequal extents.
+    [[nodiscard]] static constexpr extents_type checked_capacity( extents_type cap );
 
 };
 
@@ -540,8 +660,10 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor() noexcept :
 
 template < class T, size_t R, class Alloc, class L , class Access >
 constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( dr_tensor&& rhs )
-  noexcept( typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::propagate_on_container_move_assignment{}||
-            typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::is_always_equal{} ) :
+  noexcept( ( typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::propagate_on_container_move_assignment{}||
+              typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::is_always_equal{} ) &&
+            ( ( detail::inline_capacity_v<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type> == 0 ) ||
+              ::std::is_nothrow_copy_constructible_v<typename dr_tensor<T,R,Alloc,L,Access>::element_type> ) ) :
   // Default construct or move construct allocator depending on allocator_type::propagate_on_container_move_assignment
   alloc_( dr_tensor<T,R,Alloc,L,Access>::
     template Alloc_move_helper< dr_tensor<T,R,Alloc,L,Access>,
@@ -549,30 +671,21 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( dr_tensor&& rhs )
       propogate( ::std::move( rhs ) ) ),
   // Move capacity extents
   cap_( ::std::move( rhs.capacity() ) ),
-  // If the allocator has moved or if all allocator types are equal, then just set element pointer; otherwise, allocate new pointer
+  // If the allocator has moved or if all allocator types are equal, then just set element pointer; otherwise, allocate new pointer.
+  // Elements stored inline within the moved tensor cannot be taken and are allocated anew as well.
   elems_( [&] () constexpr { if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment{} ||
                                             typename ::std::allocator_traits<allocator_type>::is_always_equal{} )
-                             { return ::std::move( rhs.elems_ ); } else
-                             { return ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() ); } }() ),
-  // If the allocator has moved or if all allocator types are equal, then move view; otherwise, construct new view on new elements
-  view_( [&] () constexpr { if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment() ||
-                                           typename ::std::allocator_traits<allocator_type>::is_always_equal() )
+                             { if ( !rhs.is_inline() ) { return ::std::move( rhs.elems_ ); } }
+                             return this->allocate_elements( this->linear_capacity() ); }() ),
+  // If the element pointer was taken, then move view; otherwise, construct new view on new elements
+  view_( [&] () constexpr { if ( this->elems_ == rhs.elems_ )
                             { return ::std::move( rhs.underlying_span() ); } else
                             { return ::std::move( this->create_view( rhs.underlying_span().extents() ) ); } }() )
 {
-  // If the allocator was not moved, then elements have to be copied.
-  if constexpr ( !::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value )
+  // If the element pointer was not taken, then elements have to be copied.
+  if ( this->elems_ != rhs.elems_ )
   {
-    if constexpr ( ::std::is_nothrow_copy_constructible_v<element_type> )
-    {
-      // Copy construct all elements
-      detail::copy_view( this->view_, rhs.span() );
-    }
-    else
-    {
-      // Copy all elements - handling possible exceptions
-      this->copy_view_except( rhs.span() );
-    }
+    this->copy_elements( rhs );
   }
   else
   {
@@ -591,20 +704,11 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( const dr_tensor& rhs ) :
   // Copy capacity extents
   cap_( rhs.capacity() ),
   // Allocate elements
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
   // Create new view over elements
   view_( this->create_view( rhs.span().extents() ) )
 {
-  if constexpr ( ::std::is_nothrow_copy_constructible_v<element_type> )
-  {
-    // Copy construct all elements
-    detail::copy_view( this->view_, rhs.span() );
-  }
-  else
-  {
-    // Copy all elements - handling possible exceptions
-    this->copy_view_except( rhs.span() );
-  }
+  this->copy_elements( rhs );
 }
 
 template < class T, size_t R, class Alloc, class L , class Access >
@@ -625,9 +729,9 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( const T2& rhs ) :
   #endif
       propogate( rhs ) ),
   // Copy capacity extents
-  cap_( rhs.capacity() ),
+  cap_( checked_capacity( extents_type( rhs.capacity() ) ) ),
   // Allocate elements
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
   // Create new view over elements
   view_( this->create_view( rhs.span().extents() ) )
 {
@@ -665,6 +769,21 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s )
 {
 }
 
+template < class T, size_t R, class Alloc, class L , class Access >
+#ifndef LINALG_ENABLE_CONCEPTS
+template < class U, typename >
+#endif
+constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, uninitialized_t )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_default_constructible_v<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type> &&
+           ::std::is_trivially_default_constructible_v<typename dr_tensor<T,R,Alloc,L,Access>::element_type> :
+#else
+  :
+#endif
+  dr_tensor<T,R,Alloc,L,Access>( s, uninitialized, allocator_type() )
+{
+}
+
 template < class T, size_t R, class Alloc, class L , class Access >
 #ifndef LINALG_ENABLE_CONCEPTS
 template < typename >
@@ -730,9 +849,9 @@ template < class MDS, typename >
 #endif
 constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( const MDS& view, const allocator_type& alloc ) :
   alloc_( alloc ),
-  cap_( view.extents() ),
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
-  view_( this->create_view( this->cap_ ) )
+  cap_( padded_capacity( extents_type( view.extents() ) ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( view.extents() ) )
 {
   detail::copy_view( this->view_, view );
 }
@@ -740,9 +859,9 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( const MDS& view, const alloc
 template < class T, size_t R, class Alloc, class L , class Access >
 constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, const allocator_type& alloc ) :
   alloc_( alloc ),
-  cap_( s ),
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
-  view_( this->create_view( this->cap_ ) )
+  cap_( padded_capacity( s ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( s ) )
 {
   // If construct, assign, and destruct are not trivial, then initialize data
   if constexpr ( !( ::std::is_trivially_default_constructible_v<element_type> &&
@@ -753,11 +872,29 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, const alloca
   }
 }
 
+template < class T, size_t R, class Alloc, class L , class Access >
+#ifndef LINALG_ENABLE_CONCEPTS
+template < class U, typename >
+#endif
+constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, uninitialized_t, const allocator_type& alloc )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_trivially_default_constructible_v<typename dr_tensor<T,R,Alloc,L,Access>::element_type> :
+#else
+  :
+#endif
+  alloc_( alloc ),
+  cap_( padded_capacity( s ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( s ) )
+{
+  // Elements are left uninitialized; the caller writes every element before reading it
+}
+
 template < class  T, size_t R, class Alloc, class L , class Access >
 constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, extents_type cap, const allocator_type& alloc ) :
   alloc_( alloc ),
-  cap_( cap ),
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
+  cap_( padded_capacity( cap ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
   view_( this->create_view( s ) )
 {
   // TODO: Assume each dimension of s is less than cap or check through an assert or exception?
@@ -784,9 +921,9 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, Lambda&& lam
   :
 #endif
   alloc_( alloc ),
-  cap_( s ),
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
-  view_( this->create_view( this->cap_ ) )
+  cap_( padded_capacity( s ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( s ) )
 {
   // Construct all elements from lambda expression
   auto lambda_ctor = [this,&lambda]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_copy_constructible_v<element_type> )
@@ -810,8 +947,8 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, extents_type
   :
 #endif
   alloc_( alloc ),
-  cap_( cap ),
-  elems_( ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::allocate( this->alloc_, this->linear_capacity() ) ),
+  cap_( padded_capacity( cap ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
   view_( this->create_view( s ) )
 {
   // Construct all elements from lambda expression
@@ -823,21 +960,85 @@ constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, extents_type
   detail::apply_all( this->view_, lambda_ctor, LINALG_EXECUTION_UNSEQ );
 }
 
+template < class  T, size_t R, class Alloc, class L , class Access >
+constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, extents_type cap, const thread_pool_policy& policy, const allocator_type& alloc ) :
+  alloc_( alloc ),
+  cap_( padded_capacity( cap ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( s ) )
+{
+  this->first_touch_capacity( policy );
+  // Value initialize every element
+  auto value_ctor = [this]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_default_constructible_v<element_type> )
+  {
+    ::new ( ::std::addressof( detail::access( this->view_, indices ... ) ) ) element_type();
+  };
+  detail::apply_all( this->view_, value_ctor, policy.with_static_partitioning() );
+}
+
+template < class  T, size_t R, class Alloc, class L , class Access >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+constexpr dr_tensor<T,R,Alloc,L,Access>::dr_tensor( extents_type s, extents_type cap, Lambda&& lambda, const thread_pool_policy& policy, const allocator_type& alloc )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires convertible_lambda_expression_v< Lambda, ::std::make_integer_sequence<index_type,R> > :
+#else
+  :
+#endif
+  alloc_( alloc ),
+  cap_( padded_capacity( cap ) ),
+  elems_( this->allocate_elements( this->linear_capacity() ) ),
+  view_( this->create_view( s ) )
+{
+  this->first_touch_capacity( policy );
+  // Construct all elements from lambda expression
+  auto lambda_ctor = [this,&lambda]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_copy_constructible_v<element_type> )
+  {
+    ::new ( ::std::addressof( detail::access( this->view_, indices ... ) ) ) element_type( lambda( indices ... ) );
+  };
+  detail::apply_all( this->view_, lambda_ctor, policy.with_static_partitioning() );
+}
+
 template < class T, size_t R, class Alloc, class L , class Access >
 constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator = ( dr_tensor&& rhs )
-  noexcept( typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::propagate_on_container_move_assignment() ||
-            typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::is_always_equal() )
+  noexcept( ( typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::propagate_on_container_move_assignment() ||
+              typename ::std::allocator_traits<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type>::is_always_equal() ) &&
+            ( ( detail::inline_capacity_v<typename dr_tensor<T,R,Alloc,L,Access>::allocator_type> == 0 ) ||
+              ::std::is_nothrow_copy_constructible_v<typename dr_tensor<T,R,Alloc,L,Access>::element_type> ) )
 {
   // If the allocator is moved, then move everything
   if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_move_assignment() ||
                  typename ::std::allocator_traits<allocator_type>::is_always_equal() )
   {
+    if ( this == &rhs )
+    {
+      return *this;
+    }
+    // Release the current elements before the allocator which provided them is replaced
+    if ( this->elems_ )
+    {
+      this->destroy_all();
+      this->elems_ = nullptr;
+    }
     this->alloc_ = ::std::move( rhs.get_allocator() );
-    this->elems_ = rhs.elems_;
-    this->cap_   = ::std::move( rhs.cap_ );
-    this->view_  = this->create_view( rhs.size() );
-    // Set moved tensor element pointer to null so its destruction doesn't deallocate
-    rhs.elems_   = nullptr;
+    this->cap_   = rhs.cap_;
+    if ( rhs.is_inline() )
+    {
+      // Elements stored inline within the moved tensor are copied into storage of this tensor
+      this->elems_ = this->allocate_elements( this->linear_capacity() );
+      this->view_  = this->create_view( rhs.size() );
+      this->copy_elements( rhs );
+    }
+    else
+    {
+      this->elems_ = rhs.elems_;
+      this->view_  = this->create_view( rhs.size() );
+      // Set moved tensor element pointer to null so its destruction doesn't deallocate
+      rhs.elems_   = nullptr;
+    }
   }
   else
   {
@@ -846,11 +1047,11 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
       if ( this->capacity() != rhs.capacity() )
       {
         // Deallocate
-        ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+        this->deallocate_elements( this->elems_, this->linear_capacity() );
         // Set new capacity
         this->cap_   = rhs.capacity();
         // Allocate to new capacity
-        this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+        this->elems_ = this->allocate_elements( this->linear_capacity() );
         // Define new view
         this->view_  = this->create_view( rhs.size() );
         // Copy construct all elements
@@ -871,7 +1072,7 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
       // Set new capacity
       this->cap_   = rhs.capacity();
       // Allocate to new capacity
-      this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+      this->elems_ = this->allocate_elements( this->linear_capacity() );
       // Define new view
       this->view_  = this->create_view( rhs.size() );
       // Copy construct all elements
@@ -886,39 +1087,42 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
 {
   if constexpr ( ::std::is_trivially_destructible_v<element_type> )
   {
-    if ( this->capacity() != rhs.capacity() )
+    // Reallocate only if the current capacity cannot hold the assigned tensor
+    if ( !detail::sufficient_extents( this->capacity(), rhs.size() ) )
     {
+      // Find new capacity before anything is released
+      const extents_type new_cap = padded_capacity( max_extents( rhs.capacity(), grow_extents( this->capacity(), rhs.size() ) ) );
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
       // Propogate allocator
       if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment() )
       {
         this->alloc_ = rhs.get_allocator();
       }
       // Set new capacity
-      this->cap_   = rhs.capacity();
+      this->cap_   = new_cap;
       // Allocate to new capacity
-      this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+      this->elems_ = this->allocate_elements( this->linear_capacity() );
       // Define new view
       this->view_  = this->create_view( rhs.size() );
       // Copy construct all elements
-      detail::copy_view( this->view_, rhs.span() );
+      this->copy_elements( rhs );
     }
     else
     {
       if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment() )
       {
         // Deallocate
-        ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+        this->deallocate_elements( this->elems_, this->linear_capacity() );
         // Propogate allocator
         this->alloc_ = rhs.get_allocator();
         // Allocate
-        this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+        this->elems_ = this->allocate_elements( this->linear_capacity() );
       }
       // Define new view
       this->view_ = this->create_view( rhs.size() );
       // Copy construct all elements
-      detail::copy_view( this->view_, rhs.span() );
+      this->copy_elements( rhs );
     }
   }
   else
@@ -933,11 +1137,11 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
     // Set new capacity
     this->cap_   = rhs.capacity();
     // Allocate to new capacity
-    this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+    this->elems_ = this->allocate_elements( this->linear_capacity() );
     // Define new view
     this->view_  = this->create_view( rhs.size() );
     // Copy construct all elements
-      detail::copy_view( this->view_, rhs.span() );
+      this->copy_elements( rhs );
   }
   return *this;
 }
@@ -952,10 +1156,13 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
 {
   if constexpr ( ::std::is_trivially_destructible_v<element_type> )
   {
-    if ( this->capacity() != rhs.capacity() )
+    // Reallocate only if the current capacity cannot hold the assigned tensor
+    if ( !detail::sufficient_extents( this->capacity(), rhs.size() ) )
     {
+      // Find new capacity before anything is released
+      const extents_type new_cap = padded_capacity( max_extents( extents_type( rhs.capacity() ), grow_extents( this->capacity(), extents_type( rhs.size() ) ) ) );
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
       // Propogate allocator
       if constexpr ( typename ::std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment() &&
       #ifdef LINALG_ENABLE_CONCEPTS
@@ -967,9 +1174,9 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
         this->alloc_ = rhs.get_allocator();
       }
       // Set new capacity
-      this->cap_   = rhs.capacity();
+      this->cap_   = new_cap;
       // Allocate to new capacity
-      this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+      this->elems_ = this->allocate_elements( this->linear_capacity() );
       // Define new view
       this->view_  = this->create_view( rhs.size() );
       // Copy construct all elements
@@ -985,11 +1192,11 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
       #endif
       {
         // Deallocate
-        ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+        this->deallocate_elements( this->elems_, this->linear_capacity() );
         // Propogate allocator
         this->alloc_ = rhs.get_allocator();
         // Allocate
-        this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+        this->elems_ = this->allocate_elements( this->linear_capacity() );
       }
       // Define new view
       this->view_ = this->create_view( rhs.size() );
@@ -999,6 +1206,8 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
   }
   else
   {
+    // Find new capacity before anything is released
+    const extents_type new_cap = checked_capacity( extents_type( rhs.capacity() ) );
     // Destroy all
     this->destroy_all();
     // Propogate allocator
@@ -1012,9 +1221,9 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
       this->alloc_ = rhs.get_allocator();
     }
     // Set new capacity
-    this->cap_   = rhs.capacity();
+    this->cap_   = new_cap;
     // Allocate to new capacity
-    this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+    this->elems_ = this->allocate_elements( this->linear_capacity() );
     // Define new view
     this->view_  = this->create_view( rhs.size() );
     // Copy construct all elements
@@ -1060,17 +1269,19 @@ constexpr dr_tensor<T,R,Alloc,L,Access>& dr_tensor<T,R,Alloc,L,Access>::operator
     }
     else
     {
+      // Find new capacity before anything is released
+      const extents_type new_cap = padded_capacity( grow_extents( this->capacity(), extents_type( view.extents() ) ) );
       // Destroy if needed
       if constexpr ( ::std::is_trivially_destructible_v<element_type> )
       {
         this->destroy_all();
       }
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
       // Set new capacity
-      this->cap_   = view.extents();
+      this->cap_   = new_cap;
       // Allocate
-      this->elems_ = ::std::allocator_traits<allocator_type>::allocate( this->alloc_, this->linear_capacity() );
+      this->elems_ = this->allocate_elements( this->linear_capacity() );
       // Construct new view
       this->view_  = this->create_view( view.extents() );
       // Construct
@@ -1106,12 +1317,10 @@ constexpr void dr_tensor<T,R,Alloc,L,Access>::resize( extents_type new_size )
   }
   else
   {
-    // Copy current state
-    dr_tensor clone = ::std::move( *this );
-    // Set to new size
-    *this = dr_tensor( new_size, max_extents( new_size, this->capacity() ), this->get_allocator() );
-    // Copy view
-    detail::assign_view( this->view_, clone.underlying_span() );
+    // Grow geometrically so repeated growth is amortized
+    this->reallocate( new_size,
+                      padded_capacity( grow_extents( this->capacity(), new_size ) ),
+                      ::std::make_index_sequence<extents_type::rank()>() );
   }
 }
 
@@ -1119,14 +1328,20 @@ template < class T, size_t R, class Alloc, class L , class Access >
 constexpr void dr_tensor<T,R,Alloc,L,Access>::reserve( extents_type new_cap )
 {
   // Only expand if capacity is not currently sufficient
-  if ( detail::sufficient_extents( this->cap_, new_cap ) )
+  if ( !detail::sufficient_extents( this->cap_, new_cap ) )
   {
-    // Copy current state
-    dr_tensor clone = ::std::move( *this );
-    // Set to new size
-    *this = dr_tensor( this->size(), max_extents( new_cap, this->capacity() ), this->get_allocator() );
-    // Copy view
-    detail::assign_view( this->view_, clone.underlying_span() );
+    this->reallocate( this->size(), padded_capacity( max_extents( new_cap, this->capacity() ) ), ::std::make_index_sequence<extents_type::rank()>() );
+  }
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+constexpr void dr_tensor<T,R,Alloc,L,Access>::shrink_to_fit()
+{
+  const extents_type fitted_cap = detail::padded_capacity< element_type, L, allocator_type >( this->size() );
+  // Only reallocate if capacity would change, and keep it if the layout would span too much
+  if ( ( fitted_cap != this->capacity() ) && detail::is_acceptable_span<L>( fitted_cap ) )
+  {
+    this->reallocate( this->size(), fitted_cap, ::std::make_index_sequence<extents_type::rank()>() );
   }
 }
 
@@ -1155,6 +1370,19 @@ dr_tensor<T,R,Alloc,L,Access>::get_allocator() const & noexcept
   return this->alloc_;
 }
 
+template < class T, size_t R, class Alloc, class L , class Access >
+[[nodiscard]] constexpr bool dr_tensor<T,R,Alloc,L,Access>::is_inline() const noexcept
+{
+  if constexpr ( inline_capacity > 0 )
+  {
+    return this->inline_.in_use && ( this->elems_ == this->inline_.data() );
+  }
+  else
+  {
+    return false;
+  }
+}
+
 //- Const views
 
 #if LINALG_USE_BRACKET_OPERATOR
@@ -1321,7 +1549,7 @@ inline void dr_tensor<T,R,Alloc,L,Access>::copy_view_except( MDS&& span )
   catch ( ... )
   {
     // Deallocate
-    ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+    this->deallocate_elements( this->elems_, this->linear_capacity() );
     // Rethrow
     rethrow_exception( current_exception() );
   }
@@ -1335,9 +1563,7 @@ constexpr void dr_tensor<T,R,Alloc,L,Access>::destroy_all()
   if constexpr ( ::std::is_trivially_destructible_v<element_type> )
   {
     // Deallocate
-    ::std::allocator_traits<allocator_type>::deallocate( this->alloc_,
-                                                         this->elems_,
-                                                         this->linear_capacity() );
+    this->deallocate_elements( this->elems_, this->linear_capacity() );
   }
   else
   {
@@ -1348,7 +1574,7 @@ constexpr void dr_tensor<T,R,Alloc,L,Access>::destroy_all()
                         this->elems_ + this->view_.size(),
                         []( const element_type& elem ) constexpr noexcept { elem.~element_type(); } );
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
     }
     else
     {
@@ -1368,7 +1594,7 @@ inline void dr_tensor<T,R,Alloc,L,Access>::destroy_all_except()
                     this->elems_ + this->view_.size(),
                     [this,&eptr]( const element_type& elem ) { try { this->elem_.~element_type(); } catch ( ... ) { eptr = ::std::current_exception(); } } );
   // Deallocate
-  ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+  this->deallocate_elements( this->elems_, this->linear_capacity() );
   // If exceptions were thrown, rethrow the last
   if ( eptr ) LINALG_UNLIKELY
   {
@@ -1385,7 +1611,7 @@ constexpr void dr_tensor<T,R,Alloc,L,Access>::construct_all()
     detail::for_each( LINALG_EXECUTION_UNSEQ,
                       this->elems_,
                       this->elems_ + this->view_.size(),
-                      []( auto elem ) constexpr noexcept { ::new ( &elem ) element_type; } );
+                      []( auto& elem ) constexpr noexcept { ::new ( &elem ) element_type; } );
   }
   else
   {
@@ -1405,12 +1631,12 @@ inline void dr_tensor<T,R,Alloc,L,Access>::construct_all_except()
     detail::for_each( LINALG_EXECUTION_UNSEQ,
                       this->elems_,
                       this->elems_ + this->view_.size(),
-                      [&eptr]( auto elem ) { try { ::new (&elem) element_type; } catch ( ... ) { eptr = ::std::current_exception(); } } );
+                      [&eptr]( auto& elem ) { try { ::new (&elem) element_type; } catch ( ... ) { eptr = ::std::current_exception(); } } );
     // If exceptions were thrown, rethrow the last
     if ( eptr )
     {
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
       // Rethrow
       ::std::rethrow_exception( eptr );
     }
@@ -1419,11 +1645,11 @@ inline void dr_tensor<T,R,Alloc,L,Access>::construct_all_except()
   {
     // Cache pointer to constructor which threw exception
     element_type* elem_except_ptr;
-    // Attempt to construct
+    // Attempt to construct, stopping at the first exception
     detail::for_each( LINALG_EXECUTION_SEQ,
                       this->elems_,
                       this->elems_ + this->view_.size(),
-                      [&eptr,&elem_except_ptr]( auto elem ) { try { ::new (&elem) element_type(); } catch ( ... ) { elem_except_ptr = &elem; eptr = ::std::current_exception(); } } );
+                      [&eptr,&elem_except_ptr]( auto& elem ) { if ( eptr ) { return; } try { ::new (&elem) element_type(); } catch ( ... ) { elem_except_ptr = &elem; eptr = ::std::current_exception(); } } );
     // If exceptions were thrown, destroy all which have already been constructed, then rethrow the last
     if ( eptr ) LINALG_UNLIKELY
     {
@@ -1432,9 +1658,9 @@ inline void dr_tensor<T,R,Alloc,L,Access>::construct_all_except()
       detail::for_each( LINALG_EXECUTION_UNSEQ,
                         this->elems_,
                         elem_except_ptr,
-                        []( auto elem ) constexpr noexcept( is_nothrow_destructible_v<element_type> ){ elem.~element_type(); } );
+                        []( auto& elem ) constexpr noexcept( is_nothrow_destructible_v<element_type> ){ elem.~element_type(); } );
       // Deallocate
-      ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, this->elems_, this->linear_capacity() );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
       ::std::rethrow_exception( eptr );
     }
   }
@@ -1453,7 +1679,7 @@ dr_tensor<T,R,Alloc,L,Access>::resize_impl( extents_type new_size,
     // Create subview of elements to be destroyed
     auto destroy_extent = [this,new_size]( SizeType index ) constexpr noexcept
     {
-      return this->size().extent(index) > new_size(index) ?
+      return this->size().extent(index) > new_size.extent(index) ?
                tuple( new_size.extent(index), this->size().extent(index) ) :
                tuple( this->size().extent(index), this->size().extent(index) );
     };
@@ -1467,7 +1693,7 @@ dr_tensor<T,R,Alloc,L,Access>::resize_impl( extents_type new_size,
     // Create subview of elements to be constructed
     auto construct_extent = [this,new_size]( SizeType index ) constexpr noexcept
     {
-      return this->size().extent(index) < new_size(index) ?
+      return this->size().extent(index) < new_size.extent(index) ?
                tuple( this->size().extent(index), new_size.extent(index) ) :
                tuple( this->size().extent(index), this->size().extent(index) );
     };
@@ -1501,10 +1727,279 @@ dr_tensor<T,R,Alloc,L,Access>::max_extents( extents_type extents_a, extents_type
   return extents_type( max_extents );
 }
 
+template < class T, size_t R, class Alloc, class L , class Access >
+constexpr typename dr_tensor<T,R,Alloc,L,Access>::extents_type
+dr_tensor<T,R,Alloc,L,Access>::grow_extents( extents_type cap, extents_type required ) noexcept
+{
+  using traits = growth_traits<dr_tensor>;
+  // Construct array to contain grown capacity
+  ::std::array<index_type,extents_type::rank()> grown_extents;
+  for ( size_t index = 0; index < extents_type::rank(); ++index )
+  {
+    if ( required.extent(index) > cap.extent(index) )
+    {
+      const auto geometric = static_cast<index_type>( cap.extent(index) * traits::factor[index] );
+      const auto minimum   = static_cast<index_type>( required.extent(index) + traits::slack[index] );
+      grown_extents[index] = ( geometric > minimum ) ? geometric : minimum;
+    }
+    else
+    {
+      grown_extents[index] = cap.extent(index);
+    }
+  }
+  return extents_type( grown_extents );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+template < size_t ... Indices >
+inline void dr_tensor<T,R,Alloc,L,Access>::reallocate( extents_type new_size, extents_type new_cap, [[maybe_unused]] ::std::index_sequence<Indices...> )
+{
+  const extents_type old_size  = this->size();
+  const size_t       new_count = linear_capacity( new_cap );
+  if constexpr ( is_bulk_copyable )
+  {
+    // If the capacity only changes along the slowest dimension, then every element keeps its offset,
+    // so inline elements which still fit stay in place and allocators able to resize an allocation
+    // may do so without copying (e.g. mremap)
+    if constexpr ( detail::has_reallocate_v<allocator_type> || ( inline_capacity > 0 ) )
+    {
+      constexpr size_t slowest = ::std::is_same_v< L, ::std::experimental::layout_right > ? 0 : R - 1;
+      bool same_offsets = ( this->elems_ != nullptr );
+      for ( size_t dim = 0; ( dim < R ) && same_offsets; ++dim )
+      {
+        same_offsets = ( dim == slowest ) || ( this->cap_.extent(dim) == new_cap.extent(dim) );
+      }
+      const bool stays_inline = this->is_inline() && ( new_count != 0 ) && ( new_count <= inline_capacity );
+      if ( same_offsets && ( stays_inline || detail::has_reallocate_v<allocator_type> ) )
+      {
+        if constexpr ( detail::has_reallocate_v<allocator_type> )
+        {
+          if ( !stays_inline )
+          {
+            this->elems_ = this->alloc_.reallocate( this->elems_, this->linear_capacity(), new_count );
+          }
+        }
+        this->cap_   = new_cap;
+        this->view_  = this->create_view( new_size );
+        this->construct_outside( old_size, ::std::index_sequence<Indices...>() );
+        return;
+      }
+    }
+    // Otherwise, copy contiguous runs of the elements which remain into new memory
+    element_type* new_elems = this->allocate_elements( new_count );
+    if ( this->elems_ )
+    {
+      const extents_type region( ( ( old_size.extent(Indices) < new_size.extent(Indices) ) ? old_size.extent(Indices) : new_size.extent(Indices) ) ... );
+      detail::copy_block<L>( new_elems, new_cap, this->elems_, this->cap_, region );
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
+    }
+    this->elems_ = new_elems;
+    this->cap_   = new_cap;
+    this->view_  = this->create_view( new_size );
+    this->construct_outside( old_size, ::std::index_sequence<Indices...>() );
+  }
+  else
+  {
+    // Allocate new elements and define a view over them
+    element_type* new_elems = this->allocate_elements( new_count );
+    underlying_span_type new_view = ::std::experimental::submdspan( capacity_span_type( new_elems, new_cap ), tuple( 0, new_size.extent(Indices) ) ... );
+    // Default construct the elements outside the current size first, so that an exception leaves
+    // the current elements untouched, then move or copy the rest. Both passes traverse new_view in
+    // the same sequential order, so the elements built before an exception are the first ones visited.
+    auto is_relocated = [&old_size]( auto ... indices ) constexpr noexcept
+    {
+      return ( ( static_cast<size_type>( indices ) < old_size.extent(Indices) ) && ... );
+    };
+    size_type constructed = 0;
+    size_type relocated   = 0;
+    auto construct = [&new_view,&is_relocated,&constructed]( auto ... indices ) constexpr
+    {
+      if ( !is_relocated( indices ... ) )
+      {
+        ::new ( ::std::addressof( detail::access( new_view, indices ... ) ) ) element_type();
+        ++constructed;
+      }
+    };
+    auto relocate = [this,&new_view,&is_relocated,&relocated]( auto ... indices ) constexpr
+    {
+      if ( is_relocated( indices ... ) )
+      {
+        ::new ( ::std::addressof( detail::access( new_view, indices ... ) ) ) element_type( ::std::move_if_noexcept( detail::access( this->view_, indices ... ) ) );
+        ++relocated;
+      }
+    };
+    // Destroys the first count elements built by the pass selected by of_relocated
+    auto destroy = [&new_view,&is_relocated]( bool of_relocated, size_type count ) noexcept
+    {
+      detail::apply_all( new_view, [&new_view,&is_relocated,of_relocated,&count]( auto ... indices ) constexpr noexcept
+      {
+        if ( ( count > 0 ) && ( is_relocated( indices ... ) == of_relocated ) )
+        {
+          detail::access( new_view, indices ... ).~element_type();
+          --count;
+        }
+      }, LINALG_EXECUTION_SEQ );
+    };
+    try
+    {
+      if constexpr ( !( ::std::is_trivially_default_constructible_v<element_type> && ::std::is_trivially_destructible_v<element_type> ) )
+      {
+        detail::apply_all( new_view, construct, LINALG_EXECUTION_SEQ );
+      }
+      // Relocation only throws when copying, which leaves the current elements intact
+      detail::apply_all( new_view, relocate, LINALG_EXECUTION_SEQ );
+    }
+    catch ( ... )
+    {
+      // Destroy the elements built so far and deallocate
+      if constexpr ( !::std::is_trivially_destructible_v<element_type> )
+      {
+        destroy( false, constructed );
+        destroy( true, relocated );
+      }
+      this->deallocate_elements( new_elems, new_count );
+      // Rethrow
+      ::std::rethrow_exception( ::std::current_exception() );
+    }
+    // Destroy the moved-from elements and deallocate
+    if constexpr ( !::std::is_trivially_destructible_v<element_type> )
+    {
+      detail::apply_all( this->view_, [this]( auto ... indices ) constexpr noexcept { detail::access( this->view_, indices ... ).~element_type(); }, LINALG_EXECUTION_UNSEQ );
+    }
+    if ( this->elems_ )
+    {
+      this->deallocate_elements( this->elems_, this->linear_capacity() );
+    }
+    // Adopt the new elements
+    this->elems_ = new_elems;
+    this->cap_   = new_cap;
+    this->view_  = new_view;
+  }
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+template < size_t ... Indices >
+constexpr void dr_tensor<T,R,Alloc,L,Access>::construct_outside( extents_type old_size, [[maybe_unused]] ::std::index_sequence<Indices...> )
+{
+  if constexpr ( !::std::is_trivially_default_constructible_v<element_type> )
+  {
+    auto constructor = [this,&old_size]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_default_constructible_v<element_type> )
+    {
+      if ( !( ( static_cast<size_type>( indices ) < old_size.extent(Indices) ) && ... ) )
+      {
+        ::new ( ::std::addressof( detail::access( this->view_, indices ... ) ) ) element_type();
+      }
+    };
+    detail::apply_all( this->view_, constructor, LINALG_EXECUTION_UNSEQ );
+  }
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+inline void dr_tensor<T,R,Alloc,L,Access>::copy_elements( const dr_tensor& rhs )
+{
+  if constexpr ( is_bulk_copyable )
+  {
+    detail::copy_block<L>( this->elems_, this->cap_, rhs.elems_, rhs.cap_, rhs.size() );
+  }
+  else if constexpr ( ::std::is_nothrow_copy_constructible_v<element_type> )
+  {
+    // Copy construct all elements
+    detail::copy_view( this->view_, rhs.span() );
+  }
+  else
+  {
+    // Copy all elements - handling possible exceptions
+    this->copy_view_except( rhs.span() );
+  }
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+[[nodiscard]] typename dr_tensor<T,R,Alloc,L,Access>::element_type*
+dr_tensor<T,R,Alloc,L,Access>::allocate_elements( size_t n )
+{
+  if constexpr ( inline_capacity > 0 )
+  {
+    if ( ( n != 0 ) && ( n <= inline_capacity ) && !this->inline_.in_use )
+    {
+      this->inline_.in_use = true;
+      return this->inline_.data();
+    }
+  }
+  return ::std::allocator_traits<allocator_type>::allocate( this->alloc_, n );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+void dr_tensor<T,R,Alloc,L,Access>::deallocate_elements( element_type* p, size_t n ) noexcept
+{
+  if constexpr ( inline_capacity > 0 )
+  {
+    if ( this->inline_.in_use && ( p == this->inline_.data() ) )
+    {
+      this->inline_.in_use = false;
+      return;
+    }
+  }
+  ::std::allocator_traits<allocator_type>::deallocate( this->alloc_, p, n );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+void dr_tensor<T,R,Alloc,L,Access>::first_touch_capacity( const thread_pool_policy& policy ) noexcept
+{
+  // Inline storage lives within the tensor itself and is already placed
+  if ( this->is_inline() )
+  {
+    return;
+  }
+  const size_t bytes = this->linear_capacity() * sizeof( element_type );
+  if ( bytes == 0 )
+  {
+    return;
+  }
+  // Pages are numbered by address so that no page is split between two workers
+  constexpr size_t page  = LINALG_FIRST_TOUCH_PAGE_SIZE;
+  const auto       first = reinterpret_cast<::std::uintptr_t>( this->elems_ );
+  const auto       last  = first + bytes;
+  auto touch_page = [first,last]( size_t index ) noexcept
+  {
+    const auto begin = ::std::max<::std::uintptr_t>( index * page, first );
+    const auto end   = ::std::min<::std::uintptr_t>( ( index + 1 ) * page, last );
+    ::std::memset( reinterpret_cast<void*>( begin ), 0, end - begin );
+  };
+  detail::for_each( policy.with_static_partitioning(),
+                    detail::faux_index_iterator<size_t>( first / page ),
+                    detail::faux_index_iterator<size_t>( ( last + page - 1 ) / page ),
+                    touch_page );
+}
+
 template < class T, size_t R, class Alloc, class L , class Access >
 [[nodiscard]] constexpr size_t dr_tensor<T,R,Alloc,L,Access>::linear_capacity() noexcept
 {
-  return detail::template extents_helper<size_type,R>::size( this->cap_ );
+  return linear_capacity( this->cap_ );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+[[nodiscard]] constexpr size_t dr_tensor<T,R,Alloc,L,Access>::linear_capacity( extents_type cap ) noexcept
+{
+  // Layouts which are not exhaustive may span more elements than the capacity holds
+  return static_cast<size_t>( typename capacity_span_type::mapping_type( cap ).required_span_size() );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+[[nodiscard]] constexpr typename dr_tensor<T,R,Alloc,L,Access>::extents_type
+dr_tensor<T,R,Alloc,L,Access>::padded_capacity( extents_type cap )
+{
+  return checked_capacity( detail::padded_capacity< element_type, L, allocator_type >( cap ) );
+}
+
+template < class T, size_t R, class Alloc, class L , class Access >
+[[nodiscard]] constexpr typename dr_tensor<T,R,Alloc,L,Access>::extents_type
+dr_tensor<T,R,Alloc,L,Access>::checked_capacity( extents_type cap )
+{
+  if ( !detail::is_acceptable_span<L>( cap ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Capacity would span too many elements in the layout." );
+  }
+  return cap;
 }
 
 }       //- math namespace
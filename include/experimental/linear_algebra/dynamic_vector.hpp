@@ -142,6 +142,17 @@ class dr_vector : public dr_tensor<T,1,Alloc,L,Access>
     #else
       ;
     #endif
+    /// @brief Attempt to allocate sufficient resources for a size s vector without initializing its elements
+    /// @param s defines the length of the vector
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_default_constructible_v<allocator_type> && ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    constexpr dr_vector( extents_type s, uninitialized_t ) noexcept( noexcept( base_type(s,uninitialized) ) )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_default_constructible_v<allocator_type> && ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Attempt to allocate sufficient resources for a size s vector with the input capacity and construct
     /// @param s defines the length of the vector
     /// @param cap defines the capacity of the vector
@@ -208,6 +219,18 @@ class dr_vector : public dr_tensor<T,1,Alloc,L,Access>
     /// @param s defines the length of the vector
     /// @param alloc allocator used to construct with
     constexpr dr_vector( extents_type s, const allocator_type& alloc ) noexcept( noexcept( base_type(s,alloc) ) );
+    /// @brief Attempt to allocate sufficient resources for a size s vector without initializing its elements
+    /// @param s defines the length of the vector
+    /// @param alloc allocator used to construct with
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    constexpr dr_vector( extents_type s, uninitialized_t, const allocator_type& alloc ) noexcept( noexcept( base_type(s,uninitialized,alloc) ) )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Attempt to allocate sufficient resources for a size s vector with the input capacity and construct
     /// @param s defines the length of the vector
     /// @param cap defines the capacity of the vector
@@ -250,6 +273,33 @@ class dr_vector : public dr_tensor<T,1,Alloc,L,Access>
     #else
       ;
     #endif
+    /// @brief Attempt to allocate sufficient resources and value initialize every element in parallel
+    ///        such that each element is first touched by the worker which later processes it
+    /// @param s defines the length of the vector
+    /// @param cap defines the capacity along each of the dimensions of the vector
+    /// @param policy thread pool policy used to construct the elements
+    /// @param alloc allocator used to construct with
+    constexpr dr_vector( extents_type s, extents_type cap, const thread_pool_policy& policy, const allocator_type& alloc ) noexcept( noexcept( base_type(s,cap,policy,alloc) ) );
+    /// @brief Construct by applying lambda to every element in the vector in parallel
+    ///        such that each element is first touched by the worker which later processes it
+    /// @tparam Lambda lambda expression with an operator()( index ) defined
+    /// @param s defines the length of the vector
+    /// @param cap defines the capacity along each of the dimensions of the vector
+    /// @param lambda lambda expression to be performed on each element
+    /// @param policy thread pool policy used to construct the elements
+    /// @param alloc allocator used to construct with
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    constexpr dr_vector( extents_type s, extents_type cap, Lambda&& lambda, const thread_pool_policy& policy, const allocator_type& alloc ) noexcept( noexcept( base_type(s,cap,lambda,policy,alloc) ) )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
     /// @brief Default move constructor
     /// @param  dr_vector to be moved
     /// @return self
@@ -285,6 +335,7 @@ class dr_vector : public dr_tensor<T,1,Alloc,L,Access>
     using base_type::capacity;
     using base_type::resize;
     using base_type::reserve;
+    using base_type::shrink_to_fit;
 
     //- Const views
 
@@ -447,6 +498,37 @@ constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, const allocato
 {
 }
 
+template < class T, class Alloc, class L, class Access >
+#ifndef LINALG_ENABLE_CONCEPTS
+template < class U, typename >
+#endif
+constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, uninitialized_t )
+  noexcept( noexcept( dr_vector<T,Alloc,L,Access>::base_type(s,uninitialized) ) )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_default_constructible_v<typename dr_vector<T,Alloc,L,Access>::allocator_type> &&
+           ::std::is_trivially_default_constructible_v<typename dr_vector<T,Alloc,L,Access>::element_type> :
+#else
+  :
+#endif
+  dr_vector<T,Alloc,L,Access>::base_type(s,uninitialized)
+{
+}
+
+template < class T, class Alloc, class L, class Access >
+#ifndef LINALG_ENABLE_CONCEPTS
+template < class U, typename >
+#endif
+constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, uninitialized_t, const allocator_type& alloc )
+  noexcept( noexcept( dr_vector<T,Alloc,L,Access>::base_type(s,uninitialized,alloc) ) )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_trivially_default_constructible_v<typename dr_vector<T,Alloc,L,Access>::element_type> :
+#else
+  :
+#endif
+  dr_vector<T,Alloc,L,Access>::base_type(s,uninitialized,alloc)
+{
+}
+
 template < class T, class Alloc, class L, class Access >
 constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, extents_type cap, const allocator_type& alloc )
   noexcept( noexcept( dr_vector<T,Alloc,L,Access>::base_type(s,cap,alloc) ) ) :
@@ -490,6 +572,31 @@ constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, extents_type c
 {
 }
 
+template < class T, class Alloc, class L, class Access >
+constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, extents_type cap, const thread_pool_policy& policy, const allocator_type& alloc )
+  noexcept( noexcept( dr_vector<T,Alloc,L,Access>::base_type(s,cap,policy,alloc) ) ) :
+  dr_vector<T,Alloc,L,Access>::base_type(s,cap,policy,alloc)
+{
+}
+
+template < class T, class Alloc, class L, class Access >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+constexpr dr_vector<T,Alloc,L,Access>::dr_vector( extents_type s, extents_type cap, Lambda&& lambda, const thread_pool_policy& policy, const allocator_type& alloc )
+  noexcept( noexcept( dr_vector<T,Alloc,L,Access>::base_type(s,cap,lambda,policy,alloc) ) )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename dr_vector<T,Alloc,L,Access>::index_type>() ) }
+                      -> ::std::convertible_to<typename dr_vector<T,Alloc,L,Access>::element_type>; } :
+#else
+  :
+#endif
+  dr_vector<T,Alloc,L,Access>::base_type(s,cap,lambda,policy,alloc)
+{
+}
+
 template < class T, class Alloc, class L, class Access >
 #ifdef LINALG_ENABLE_CONCEPTS
 template < concepts::tensor_may_be_constructible< dr_vector<T,Alloc,L,Access> > V2 >
@@ -119,6 +119,16 @@ class fs_matrix : public fs_tensor<T,L,A,R,C>
     /// @brief Default copy constructor
     /// @param fs_matrix to be copied
     fs_matrix( const fs_matrix& ) = default;
+    /// @brief Construct without initializing the elements. Requires trivially default constructible elements.
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    explicit fs_matrix( uninitialized_t ) noexcept
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Template copy constructor
     /// @tparam matrix to be copied
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -240,6 +250,25 @@ class fs_matrix : public fs_tensor<T,L,A,R,C>
 
 //- Destructor / Constructors / Assignments
 
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, ::std::size_t R, ::std::size_t C, class L, class A > requires ( ( R >= 0 ) && ( C >= 0 ) )
+fs_matrix<T,R,C,L,A>::
+#else
+template < class T, ::std::size_t R, ::std::size_t C, class L, class A , typename Dummy >
+template < class U, typename >
+fs_matrix<T,R,C,L,A,Dummy>::
+#endif
+fs_matrix( uninitialized_t ) noexcept
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_trivially_default_constructible_v<typename fs_matrix<T,R,C,L,A>::element_type> :
+  fs_matrix<T,R,C,L,A>::base_type( uninitialized )
+#else
+  :
+  fs_matrix<T,R,C,L,A,Dummy>::base_type( uninitialized )
+#endif
+{
+}
+
 #ifdef LINALG_ENABLE_CONCEPTS
 template < class T, ::std::size_t R, ::std::size_t C, class L, class A > requires ( ( R >= 0 ) && ( C >= 0 ) )
 template < concepts::tensor_may_be_constructible< fs_matrix<T,R,C,L,A> > M2 >
@@ -10,6 +10,12 @@
 
 #include <experimental/linear_algebra.hpp>
 
+// Largest fixed-size tensor, in elements, whose elements are initialized directly in storage order
+// by pack expansion when constructed from a view, another tensor or a lambda.
+#ifndef LINALG_DIRECT_INIT_LIMIT
+#  define LINALG_DIRECT_INIT_LIMIT 1024
+#endif
+
 namespace std
 {
 namespace experimental
@@ -17,10 +23,6 @@ namespace experimental
 namespace math
 {
 
-// TODO: There doesn't seem to be a good way to map multidimensional
-//       view or indices back into one dimensional order. Several
-//       constructors would benefit from mapping into an initializer
-//       list and avoiding the default construction of the array.
 // TODO: Lacking support for P0478 (rejected), syntax is awkward
 //       and doesn't support natural defaults.
 //       Could capture indices in an extent, but this isn't as natural.
@@ -108,6 +110,16 @@ class fs_tensor
     /// @brief Default copy constructor
     /// @param fs_tensor to be copied
     constexpr fs_tensor( const fs_tensor& ) noexcept( ::std::is_nothrow_copy_constructible_v<element_type> );
+    /// @brief Construct without initializing the elements. Requires trivially default constructible elements.
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    explicit fs_tensor( uninitialized_t ) noexcept
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     // TODO: Define noexcept specification
     /// @brief Template copy constructor
     /// @tparam tensor to be copied
@@ -274,10 +286,41 @@ class fs_tensor
   private:
     //- Data
 
-    /// @brief Number of elements in array
-    static const size_type nelems_ = detail::product( Ds ... );
+    /// @brief Number of elements in array, which includes the padding of layouts which are not exhaustive
+    static const size_type nelems_ = static_cast<size_type>( typename layout_type::template mapping<extents_type>( extents_type() ).required_span_size() );
+    static_assert( detail::is_acceptable_span<layout_type>( extents_type() ), "Extents would span too many elements in the layout." );
+    /// @brief True iff elements may be initialized directly in storage order
+    static constexpr bool direct_init_ = detail::is_unravelable_layout_v<layout_type> &&
+                                         ::std::is_same_v< accessor_type, ::std::experimental::default_accessor<element_type> > &&
+                                         ( nelems_ <= LINALG_DIRECT_INIT_LIMIT );
     /// @brief Array of elements
     ::std::array<element_type,nelems_> elems_;
+
+    //- Initialization
+
+    /// @brief Tag selecting direct initialization of every element
+    struct direct_init_t { };
+    /// @brief Tag selecting default initialization of every element, to be assigned afterwards
+    struct deferred_init_t { };
+    /// @brief Selects direct initialization when possible for a source with extents E
+    template < class E >
+    using init_tag_t = ::std::conditional_t< direct_init_ && detail::extents_are_equal_v<E,extents_type>, direct_init_t, deferred_init_t >;
+
+    /// @brief Initializes each element, in storage order, with the result of f(indices...)
+    /// @tparam F function of the indices of an element
+    template < class F >
+    constexpr fs_tensor( direct_init_t, F&& f ) noexcept( noexcept( make_elements( f, ::std::make_index_sequence<nelems_>() ) ) );
+    /// @brief Default initializes each element. The delegating constructor assigns them.
+    template < class F >
+    constexpr fs_tensor( deferred_init_t, F&& ) noexcept( ::std::is_nothrow_default_constructible_v<element_type> );
+    /// @brief Returns the array initialized with f(indices...) for each element
+    template < class F, ::std::size_t ... Is >
+    [[nodiscard]] static constexpr ::std::array<element_type,nelems_> make_elements( F& f, ::std::index_sequence< Is ... > )
+      noexcept( noexcept( static_cast<element_type>( f( Ds ... ) ) ) );
+    /// @brief Returns f(indices...) for the element at storage position I
+    template < ::std::size_t I, class F, ::std::size_t ... Dims >
+    [[nodiscard]] static constexpr element_type make_element( F& f, ::std::index_sequence< Dims ... > )
+      noexcept( noexcept( static_cast<element_type>( f( Ds ... ) ) ) );
 };
 
 //----------------------------------------------
@@ -316,6 +359,20 @@ constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( const fs_tensor& rhs )
 {
 }
 
+template < class T, class L, class A, ::std::size_t ... Ds >
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( ( Ds >= 0 ) && ... )
+#endif
+#ifndef LINALG_ENABLE_CONCEPTS
+template < class U, typename >
+#endif
+fs_tensor<T,L,A,Ds...>::fs_tensor( uninitialized_t ) noexcept
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_trivially_default_constructible_v<typename fs_tensor<T,L,A,Ds...>::element_type>
+#endif
+{
+}
+
 template < class T, class L, class A, ::std::size_t ... Ds >
 #ifdef LINALG_ENABLE_CONCEPTS
   requires ( ( Ds >= 0 ) && ... )
@@ -325,10 +382,21 @@ template < concepts::tensor_may_be_constructible< fs_tensor<T,L,A,Ds...> > T2 >
 #else
 template < class T2, typename >
 #endif
-constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( const T2& rhs )
+constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( const T2& rhs ) :
+  fs_tensor( init_tag_t<typename T2::extents_type>(), [ view = rhs.span() ]( auto ... indices ) constexpr
+  {
+    #if LINALG_USE_BRACKET_OPERATOR
+    return view[ indices ... ];
+    #else
+    return view( indices ... );
+    #endif
+  } )
 {
-  underlying_span_type this_view { this->underlying_span() };
-  static_cast<void>( detail::assign_view( this_view, rhs.span() ) );
+  if constexpr ( ::std::is_same_v< init_tag_t<typename T2::extents_type>, deferred_init_t > )
+  {
+    underlying_span_type this_view { this->underlying_span() };
+    static_cast<void>( detail::assign_view( this_view, rhs.span() ) );
+  }
 }
 
 template < class T, class L, class A, ::std::size_t ... Ds >
@@ -341,10 +409,21 @@ template < concepts::view_may_be_constructible_to_tensor< fs_tensor<T,L,A,Ds...>
 template < class MDS, typename, typename >
 #endif
 constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( const MDS& view )
-  noexcept( concepts::view_is_nothrow_constructible_to_tensor< MDS, fs_tensor<T,L,A,Ds...> > )
+  noexcept( concepts::view_is_nothrow_constructible_to_tensor< MDS, fs_tensor<T,L,A,Ds...> > ) :
+  fs_tensor( init_tag_t<typename MDS::extents_type>(), [&view]( auto ... indices ) constexpr
+  {
+    #if LINALG_USE_BRACKET_OPERATOR
+    return view[ indices ... ];
+    #else
+    return view( indices ... );
+    #endif
+  } )
 {
-  underlying_span_type this_view { this->underlying_span() };
-  static_cast<void>( detail::assign_view( this_view, view ) );
+  if constexpr ( ::std::is_same_v< init_tag_t<typename MDS::extents_type>, deferred_init_t > )
+  {
+    underlying_span_type this_view { this->underlying_span() };
+    static_cast<void>( detail::assign_view( this_view, view ) );
+  }
 }
 
 template < class T, class L, class A, ::std::size_t ... Ds >
@@ -360,19 +439,23 @@ constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( Lambda&& lambda ) noexcept( noexcep
 #ifdef LINALG_ENABLE_CONCEPTS
   requires requires { { ::std::declval<Lambda&&>().operator()( Ds ... ) } -> ::std::convertible_to<typename fs_tensor<T,L,A,Ds...>::element_type>; }
 #endif
+  : fs_tensor( init_tag_t<extents_type>(), lambda )
 {
-  // If expression is no except, then no need to capture last exception
-  constexpr bool lambda_is_noexcept = detail::is_nothrow_convertible_v< decltype( ::std::declval<Lambda&&>()( Ds ... ) ), element_type >;
-  // Construct all elements from lambda output
-  auto ctor = [this,&lambda]( auto ... indices ) constexpr noexcept( lambda_is_noexcept )
+  if constexpr ( ::std::is_same_v< init_tag_t<extents_type>, deferred_init_t > )
   {
-    #if LINALG_USE_BRACKET_OPERATOR
-    this->underlying_span()[ indices ... ] = lambda( indices ... );
-    #else
-    this->underlying_span()( indices ... ) = lambda( indices ... );
-    #endif
-  };
-  detail::apply_all( this->underlying_span(), ctor, LINALG_EXECUTION_UNSEQ );
+    // If expression is no except, then no need to capture last exception
+    constexpr bool lambda_is_noexcept = detail::is_nothrow_convertible_v< decltype( ::std::declval<Lambda&&>()( Ds ... ) ), element_type >;
+    // Assign all elements from lambda output
+    auto ctor = [this,&lambda]( auto ... indices ) constexpr noexcept( lambda_is_noexcept )
+    {
+      #if LINALG_USE_BRACKET_OPERATOR
+      this->underlying_span()[ indices ... ] = lambda( indices ... );
+      #else
+      this->underlying_span()( indices ... ) = lambda( indices ... );
+      #endif
+    };
+    detail::apply_all( this->underlying_span(), ctor, LINALG_EXECUTION_UNSEQ );
+  }
 }
 
 template < class T, class L, class A, ::std::size_t ... Ds >
@@ -407,6 +490,55 @@ constexpr fs_tensor<T,L,A,Ds...>& fs_tensor<T,L,A,Ds...>::operator = ( const MDS
   return *this;
 }
 
+//- Initialization
+
+template < class T, class L, class A, ::std::size_t ... Ds >
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( ( Ds >= 0 ) && ... )
+#endif
+template < class F >
+constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( direct_init_t, F&& f )
+  noexcept( noexcept( make_elements( f, ::std::make_index_sequence<nelems_>() ) ) ) :
+  elems_( make_elements( f, ::std::make_index_sequence<nelems_>() ) )
+{
+}
+
+template < class T, class L, class A, ::std::size_t ... Ds >
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( ( Ds >= 0 ) && ... )
+#endif
+template < class F >
+constexpr fs_tensor<T,L,A,Ds...>::fs_tensor( deferred_init_t, F&& )
+  noexcept( ::std::is_nothrow_default_constructible_v<element_type> )
+{
+}
+
+template < class T, class L, class A, ::std::size_t ... Ds >
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( ( Ds >= 0 ) && ... )
+#endif
+template < class F, ::std::size_t ... Is >
+[[nodiscard]] constexpr ::std::array<typename fs_tensor<T,L,A,Ds...>::element_type,fs_tensor<T,L,A,Ds...>::nelems_>
+fs_tensor<T,L,A,Ds...>::make_elements( F& f, ::std::index_sequence< Is ... > )
+  noexcept( noexcept( static_cast<element_type>( f( Ds ... ) ) ) )
+{
+  // Elements of a braced initializer list are initialized in order, one write each
+  return { { make_element<Is>( f, ::std::make_index_sequence< sizeof...(Ds) >() ) ... } };
+}
+
+template < class T, class L, class A, ::std::size_t ... Ds >
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( ( Ds >= 0 ) && ... )
+#endif
+template < ::std::size_t I, class F, ::std::size_t ... Dims >
+[[nodiscard]] constexpr typename fs_tensor<T,L,A,Ds...>::element_type
+fs_tensor<T,L,A,Ds...>::make_element( F& f, ::std::index_sequence< Dims ... > )
+  noexcept( noexcept( static_cast<element_type>( f( Ds ... ) ) ) )
+{
+  constexpr auto indices = detail::unravel_index< layout_type, Ds ... >( I );
+  return static_cast<element_type>( f( ::std::get<Dims>( indices ) ... ) );
+}
+
 //- Size / Capacity
 
 template < class T, class L, class A, ::std::size_t ... Ds >
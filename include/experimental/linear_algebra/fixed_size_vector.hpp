@@ -112,6 +112,16 @@ class fs_vector : public fs_tensor<T,L,A,N>
     /// @brief Default copy constructor
     /// @param fs_vector to be copied
     fs_vector( const fs_vector& ) = default;
+    /// @brief Construct without initializing the elements. Requires trivially default constructible elements.
+    #ifndef LINALG_ENABLE_CONCEPTS
+    template < class U = element_type, typename = ::std::enable_if_t< ::std::is_trivially_default_constructible_v<U> > >
+    #endif
+    explicit fs_vector( uninitialized_t ) noexcept
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ::std::is_trivially_default_constructible_v<element_type>;
+    #else
+      ;
+    #endif
     /// @brief Template copy constructor
     /// @tparam vector to be copied
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -214,6 +224,25 @@ class fs_vector : public fs_tensor<T,L,A,N>
 
 //- Destructor / Constructors / Assignments
 
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, ::std::size_t N, class L, class A > requires ( N >= 0 )
+fs_vector<T,N,L,A>::
+#else
+template < class T, ::std::size_t N, class L, class A, typename Dummy >
+template < class U, typename >
+fs_vector<T,N,L,A,Dummy>::
+#endif
+fs_vector( uninitialized_t ) noexcept
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ::std::is_trivially_default_constructible_v<typename fs_vector<T,N,L,A>::element_type> :
+  fs_vector<T,N,L,A>::base_type( uninitialized )
+#else
+  :
+  fs_vector<T,N,L,A,Dummy>::base_type( uninitialized )
+#endif
+{
+}
+
 #ifdef LINALG_ENABLE_CONCEPTS
 template < class T, ::std::size_t N, class L, class A > requires ( N >= 0 )
 template < concepts::tensor_may_be_constructible< fs_vector<T,N,L,A> > V2 >
@@ -19,24 +19,63 @@ namespace math
 // Default layout
 using default_layout = ::std::experimental::layout_right;
 
+// Default allocator
+#if LINALG_DEFAULT_POLYMORPHIC_ALLOCATOR
+template < class T >
+using default_allocator = ::std::pmr::polymorphic_allocator<T>;
+#else
+template < class T >
+using default_allocator = ::std::allocator<T>;
+#endif
+
+// Tag selecting construction which leaves trivially default constructible elements uninitialized
+struct uninitialized_t { explicit uninitialized_t() = default; };
+inline constexpr uninitialized_t uninitialized {};
+
+// Tags selecting the triangle of a packed matrix which is stored
+struct upper_triangle_t { explicit upper_triangle_t() = default; };
+inline constexpr upper_triangle_t upper_triangle {};
+struct lower_triangle_t { explicit lower_triangle_t() = default; };
+inline constexpr lower_triangle_t lower_triangle {};
+
+// Tags selecting the order in which the stored triangle of a packed matrix is laid out
+struct row_major_t { explicit row_major_t() = default; };
+inline constexpr row_major_t row_major {};
+struct column_major_t { explicit column_major_t() = default; };
+inline constexpr column_major_t column_major {};
+
+// Tags selecting how a packed matrix recovers the triangle which is not stored
+struct symmetric_t { explicit symmetric_t() = default; };
+struct hermitian_t { explicit hermitian_t() = default; };
+struct triangular_t { explicit triangular_t() = default; };
+
+// Tags selecting which diagonal values a diagonal matrix stores: all of them, none, or a single scalar
+struct general_diagonal_t { explicit general_diagonal_t() = default; };
+struct identity_t { explicit identity_t() = default; };
+struct scaled_identity_t { explicit scaled_identity_t() = default; };
+
 // Dynamic-size, dynamic-capacity tensor
 template < class  T,
            size_t R,
-           class  Alloc  = ::std::allocator<T>,
+           class  Alloc  = default_allocator<T>,
            class  L      = default_layout,
            class  Access = ::std::experimental::default_accessor<T> >
 class dr_tensor;
 
+// Traits defining how the capacity of a dynamic tensor grows
+template < class Tensor >
+struct growth_traits;
+
 // Dynamic-size, dynamic-capacity matrix
 template < class T,
-           class Alloc  = ::std::allocator<T>,
+           class Alloc  = default_allocator<T>,
            class L      = default_layout,
            class Access = ::std::experimental::default_accessor<T> >
 class dr_matrix;
 
 // Dynamic-size, dynamic-capacity vector
 template < class T,
-           class Alloc  = ::std::allocator<T>,
+           class Alloc  = default_allocator<T>,
            class L      = default_layout,
            class Access = ::std::experimental::default_accessor<T> >
 class dr_vector;
@@ -108,6 +147,117 @@ template < class MDS
 #endif
 class vector_view;
 
+// Compressed sparse row matrix
+template < class T,
+           class Index = ::std::ptrdiff_t,
+           class Alloc = default_allocator<T> >
+class csr_matrix;
+
+// Square matrix storing one triangle in n(n+1)/2 elements
+template < class T,
+           class Structure,
+           class Triangle = upper_triangle_t,
+           class Alloc    = default_allocator<T> >
+class packed_matrix;
+
+// Packed symmetric matrix
+template < class T,
+           class Triangle = upper_triangle_t,
+           class Alloc    = default_allocator<T> >
+using sym_matrix = packed_matrix< T, symmetric_t, Triangle, Alloc >;
+
+// Packed Hermitian matrix
+template < class T,
+           class Triangle = upper_triangle_t,
+           class Alloc    = default_allocator<T> >
+using herm_matrix = packed_matrix< T, hermitian_t, Triangle, Alloc >;
+
+// Packed triangular matrix
+template < class T,
+           class Triangle = upper_triangle_t,
+           class Alloc    = default_allocator<T> >
+using tri_matrix = packed_matrix< T, triangular_t, Triangle, Alloc >;
+
+// Banded matrix in the LAPACK band layout
+template < class T,
+           class Alloc = default_allocator<T> >
+class band_matrix;
+
+// Diagonal matrix
+template < class T,
+           class Structure = general_diagonal_t,
+           class Alloc     = default_allocator<T> >
+class diagonal_matrix;
+
+// Identity matrix
+template < class T,
+           class Alloc = default_allocator<T> >
+using identity_matrix = diagonal_matrix< T, identity_t, Alloc >;
+
+// Scaled identity matrix
+template < class T,
+           class Alloc = default_allocator<T> >
+using scaled_identity_matrix = diagonal_matrix< T, scaled_identity_t, Alloc >;
+
+// Builder assembling a sparse matrix from (row, column, value) contributions
+template < class T,
+           class Index = ::std::ptrdiff_t,
+           class Alloc = default_allocator<T> >
+class coo_builder;
+
+namespace pmr
+{
+
+// Dynamic-size, dynamic-capacity tensor using a polymorphic allocator
+template < class  T,
+           size_t R,
+           class  L      = default_layout,
+           class  Access = ::std::experimental::default_accessor<T> >
+using dr_tensor = ::std::experimental::math::dr_tensor< T, R, ::std::pmr::polymorphic_allocator<T>, L, Access >;
+
+// Dynamic-size, dynamic-capacity matrix using a polymorphic allocator
+template < class T,
+           class L      = default_layout,
+           class Access = ::std::experimental::default_accessor<T> >
+using dr_matrix = ::std::experimental::math::dr_matrix< T, ::std::pmr::polymorphic_allocator<T>, L, Access >;
+
+// Dynamic-size, dynamic-capacity vector using a polymorphic allocator
+template < class T,
+           class L      = default_layout,
+           class Access = ::std::experimental::default_accessor<T> >
+using dr_vector = ::std::experimental::math::dr_vector< T, ::std::pmr::polymorphic_allocator<T>, L, Access >;
+
+// Compressed sparse row matrix using a polymorphic allocator
+template < class T,
+           class Index = ::std::ptrdiff_t >
+using csr_matrix = ::std::experimental::math::csr_matrix< T, Index, ::std::pmr::polymorphic_allocator<T> >;
+
+// Packed symmetric matrix using a polymorphic allocator
+template < class T,
+           class Triangle = upper_triangle_t >
+using sym_matrix = ::std::experimental::math::sym_matrix< T, Triangle, ::std::pmr::polymorphic_allocator<T> >;
+
+// Packed Hermitian matrix using a polymorphic allocator
+template < class T,
+           class Triangle = upper_triangle_t >
+using herm_matrix = ::std::experimental::math::herm_matrix< T, Triangle, ::std::pmr::polymorphic_allocator<T> >;
+
+// Packed triangular matrix using a polymorphic allocator
+template < class T,
+           class Triangle = upper_triangle_t >
+using tri_matrix = ::std::experimental::math::tri_matrix< T, Triangle, ::std::pmr::polymorphic_allocator<T> >;
+
+// Banded matrix using a polymorphic allocator
+template < class T >
+using band_matrix = ::std::experimental::math::band_matrix< T, ::std::pmr::polymorphic_allocator<T> >;
+
+// Diagonal matrix using a polymorphic allocator
+template < class T,
+           class Structure = general_diagonal_t >
+using diagonal_matrix = ::std::experimental::math::diagonal_matrix< T, Structure, ::std::pmr::polymorphic_allocator<T> >;
+
+}       //- pmr namespace
+
 }       //- math namespace
 }       //- experimental namespace
 }       //- std namespace
@@ -0,0 +1,216 @@
+//==================================================================================================
+//  File:       huge_page_allocator.hpp
+//
+//  Summary:    This header defines an allocator which backs large allocations with transparent
+//              huge pages. Each large allocation is a huge page aligned mapping the kernel is
+//              advised to back with huge pages, so traversals which stride across many pages
+//              (e.g. column walks of row major matrices) incur far fewer TLB misses.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+#if defined( __linux__ )
+#  include <sys/mman.h>
+#endif
+
+// Define if transparent huge pages may be requested.
+#ifndef LINALG_HUGE_PAGES
+#  if defined( __linux__ ) && defined( MADV_HUGEPAGE )
+#    define LINALG_HUGE_PAGES 1
+#  else
+#    define LINALG_HUGE_PAGES 0
+#  endif
+#endif
+
+// Size in bytes of a huge page.
+#ifndef LINALG_HUGE_PAGE_SIZE
+#  define LINALG_HUGE_PAGE_SIZE ( ::std::size_t( 1 ) << 21 )
+#endif
+
+// Allocations smaller than this many bytes use normal pages from the global heap.
+#ifndef LINALG_HUGE_PAGE_THRESHOLD
+#  define LINALG_HUGE_PAGE_THRESHOLD LINALG_HUGE_PAGE_SIZE
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Allocator which backs allocations of at least LINALG_HUGE_PAGE_THRESHOLD bytes with
+///        huge page aligned mappings advised to use transparent huge pages. If huge pages are
+///        unsupported by the platform or unavailable, then the mapping uses normal pages.
+/// @tparam T element type
+template < class T >
+class huge_page_allocator
+{
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Allocator is stateless and therefore always propagates on move
+    using propagate_on_container_move_assignment = ::std::true_type;
+    /// @brief All instances of the allocator are equal
+    using is_always_equal                        = ::std::true_type;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = huge_page_allocator<U>; };
+
+    /// @brief Size in bytes of a huge page
+    static constexpr size_type page_size = LINALG_HUGE_PAGE_SIZE;
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr huge_page_allocator() noexcept = default;
+    /// @brief Converting constructor
+    template < class U >
+    constexpr huge_page_allocator( [[maybe_unused]] const huge_page_allocator<U>& rhs ) noexcept { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n );
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, size_type n ) noexcept;
+    /// @brief Resizes storage previously returned from allocate, preserving its contents. Huge page
+    ///        mappings are extended in place where the address space allows.
+    /// @param p pointer to the storage
+    /// @param old_n number of elements currently allocated
+    /// @param new_n number of elements requested
+    /// @return pointer to the resized storage
+    [[nodiscard]] T* reallocate( T* p, size_type old_n, size_type new_n );
+
+  private:
+    // True if an allocation of n elements is mapped with huge pages
+    [[nodiscard]] static constexpr bool is_huge( size_type n ) noexcept
+    {
+      return LINALG_HUGE_PAGES && ( n * sizeof(T) >= LINALG_HUGE_PAGE_THRESHOLD );
+    }
+    // Returns the size in bytes of the mapping holding n elements
+    [[nodiscard]] static constexpr size_type mapping_size( size_type n ) noexcept
+    {
+      return ( ( n * sizeof(T) + page_size - 1 ) / page_size ) * page_size;
+    }
+};
+
+/// @brief All huge page allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator == ( const huge_page_allocator<T>&, const huge_page_allocator<U>& ) noexcept { return true; }
+/// @brief All huge page allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator != ( const huge_page_allocator<T>&, const huge_page_allocator<U>& ) noexcept { return false; }
+
+//------------------------------------------
+// Implementation of huge_page_allocator<T>
+//------------------------------------------
+
+template < class T >
+[[nodiscard]] T* huge_page_allocator<T>::allocate( size_type n )
+{
+  if ( n > ( ::std::numeric_limits<size_type>::max() - page_size ) / sizeof(T) ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_array_new_length();
+  }
+  if ( n == 0 )
+  {
+    return nullptr;
+  }
+  if ( !is_huge( n ) )
+  {
+    return static_cast<T*>( ::operator new( n * sizeof(T), ::std::align_val_t( alignof(T) ) ) );
+  }
+  #if LINALG_HUGE_PAGES
+  // Over-map by one huge page, then trim the unaligned head and the tail
+  const size_type bytes  = mapping_size( n );
+  void*           mapped = ::mmap( nullptr, bytes + page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+  if ( mapped == MAP_FAILED ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_alloc();
+  }
+  auto* begin = static_cast<::std::byte*>( mapped );
+  auto* p     = reinterpret_cast<::std::byte*>( ( reinterpret_cast<::std::uintptr_t>( begin ) + page_size - 1 ) & ~( page_size - 1 ) );
+  if ( p != begin )
+  {
+    static_cast<void>( ::munmap( begin, static_cast<size_type>( p - begin ) ) );
+  }
+  if ( p + bytes != begin + bytes + page_size )
+  {
+    static_cast<void>( ::munmap( p + bytes, static_cast<size_type>( ( begin + bytes + page_size ) - ( p + bytes ) ) ) );
+  }
+  // Advice must precede the first touch. Failure (e.g. THP disabled) leaves normal pages.
+  static_cast<void>( ::madvise( p, bytes, MADV_HUGEPAGE ) );
+  return reinterpret_cast<T*>( p );
+  #else
+  return static_cast<T*>( ::operator new( n * sizeof(T), ::std::align_val_t( alignof(T) ) ) );
+  #endif
+}
+
+template < class T >
+void huge_page_allocator<T>::deallocate( T* p, size_type n ) noexcept
+{
+  if ( p == nullptr )
+  {
+    return;
+  }
+  if ( !is_huge( n ) )
+  {
+    ::operator delete( p, ::std::align_val_t( alignof(T) ) );
+    return;
+  }
+  #if LINALG_HUGE_PAGES
+  static_cast<void>( ::munmap( p, mapping_size( n ) ) );
+  #endif
+}
+
+template < class T >
+[[nodiscard]] T* huge_page_allocator<T>::reallocate( T* p, size_type old_n, size_type new_n )
+{
+  #if LINALG_HUGE_PAGES && defined( MREMAP_MAYMOVE )
+  // Extend or shrink the mapping without moving it, so it stays huge page aligned
+  if ( ( p != nullptr ) && is_huge( old_n ) && is_huge( new_n ) )
+  {
+    if ( new_n > ( ::std::numeric_limits<size_type>::max() - page_size ) / sizeof(T) ) LINALG_UNLIKELY
+    {
+      throw ::std::bad_array_new_length();
+    }
+    const size_type old_bytes = mapping_size( old_n );
+    const size_type new_bytes = mapping_size( new_n );
+    if ( ::mremap( p, old_bytes, new_bytes, 0 ) != MAP_FAILED )
+    {
+      if ( new_bytes > old_bytes )
+      {
+        static_cast<void>( ::madvise( reinterpret_cast<::std::byte*>( p ) + old_bytes, new_bytes - old_bytes, MADV_HUGEPAGE ) );
+      }
+      return p;
+    }
+  }
+  #endif
+  // Otherwise, allocate and copy
+  T* q = this->allocate( new_n );
+  if ( p != nullptr )
+  {
+    ::std::memcpy( q, p, ::std::min( old_n, new_n ) * sizeof(T) );
+  }
+  this->deallocate( p, old_n );
+  return q;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_HUGE_PAGE_ALLOCATOR_HPP
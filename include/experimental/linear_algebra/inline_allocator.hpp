@@ -0,0 +1,119 @@
+//==================================================================================================
+//  File:       inline_allocator.hpp
+//
+//  Summary:    This header defines an allocator which requests small-buffer storage from dynamic
+//              tensors. A dynamic tensor whose allocator advertises an inline capacity embeds a
+//              buffer of that many elements and keeps its elements there whenever its capacity
+//              fits, never touching the heap. Larger capacities spill to an upstream allocator.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_INLINE_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_INLINE_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Allocator which forwards every allocation to an upstream allocator and advertises an
+///        inline capacity of N elements. Dynamic tensors using it store up to N elements in a
+///        buffer within the tensor itself; the allocator holds no buffer, so copies are
+///        interchangeable and compare equal whenever their upstream allocators do. Other
+///        containers simply allocate from the upstream allocator.
+/// @tparam T     element type
+/// @tparam N     number of elements which dynamic tensors may store inline
+/// @tparam Alloc upstream allocator used for allocations which do not fit inline
+template < class T, size_t N, class Alloc = ::std::allocator<T> >
+class inline_allocator
+{
+  static_assert( N > 0, "Inline capacity must be positive." );
+
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Type of the upstream allocator
+    using upstream_allocator_type                = typename ::std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    /// @brief Copy assignment of containers follows the upstream allocator
+    using propagate_on_container_copy_assignment = typename ::std::allocator_traits<upstream_allocator_type>::propagate_on_container_copy_assignment;
+    /// @brief Move assignment of containers follows the upstream allocator
+    using propagate_on_container_move_assignment = typename ::std::allocator_traits<upstream_allocator_type>::propagate_on_container_move_assignment;
+    /// @brief Swapping of containers follows the upstream allocator
+    using propagate_on_container_swap            = typename ::std::allocator_traits<upstream_allocator_type>::propagate_on_container_swap;
+    /// @brief Allocators are equal whenever their upstream allocators are
+    using is_always_equal                        = typename ::std::allocator_traits<upstream_allocator_type>::is_always_equal;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = inline_allocator< U, N, typename ::std::allocator_traits<Alloc>::template rebind_alloc<U> >; };
+
+    /// @brief Number of elements which dynamic tensors may store inline
+    static constexpr size_type inline_capacity = N;
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr inline_allocator() noexcept( ::std::is_nothrow_default_constructible_v<upstream_allocator_type> ) = default;
+    /// @brief Constructs from an upstream allocator
+    /// @param upstream allocator used for allocations which do not fit inline
+    explicit constexpr inline_allocator( const upstream_allocator_type& upstream ) noexcept :
+      upstream_( upstream ) { }
+    /// @brief Converting constructor
+    template < class U, class Alloc2 >
+    constexpr inline_allocator( const inline_allocator<U,N,Alloc2>& rhs ) noexcept :
+      upstream_( rhs.upstream_allocator() ) { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements from the upstream allocator
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n )
+    {
+      return ::std::allocator_traits<upstream_allocator_type>::allocate( this->upstream_, n );
+    }
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, size_type n ) noexcept
+    {
+      ::std::allocator_traits<upstream_allocator_type>::deallocate( this->upstream_, p, n );
+    }
+
+    //- Observers
+
+    /// @brief Returns the upstream allocator
+    [[nodiscard]] constexpr const upstream_allocator_type& upstream_allocator() const noexcept { return this->upstream_; }
+
+  private:
+    //- Data
+
+    /// @brief Allocator used for allocations which do not fit inline
+    [[no_unique_address]] upstream_allocator_type upstream_ {};
+};
+
+/// @brief Allocators compare equal if their upstream allocators do
+template < class T, size_t N, class A, class U, size_t M, class B >
+[[nodiscard]] bool operator == ( const inline_allocator<T,N,A>& lhs, const inline_allocator<U,M,B>& rhs ) noexcept
+{
+  return lhs.upstream_allocator() == rhs.upstream_allocator();
+}
+/// @brief Allocators compare equal if their upstream allocators do
+template < class T, size_t N, class A, class U, size_t M, class B >
+[[nodiscard]] bool operator != ( const inline_allocator<T,N,A>& lhs, const inline_allocator<U,M,B>& rhs ) noexcept
+{
+  return !( lhs == rhs );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_INLINE_ALLOCATOR_HPP
@@ -25,7 +25,7 @@ struct default_dynamic< tensor_view< MDS >, ValueType >
 {
   using type = dr_tensor< ValueType,
                           MDS::extents_type::rank(),
-                          ::std::allocator< ValueType >,
+                          default_allocator< ValueType >,
                           default_layout,
                           typename detail::rebind_accessor_t<typename MDS::accessor_type,ValueType> >;
 };
@@ -33,7 +33,7 @@ template < class MDS, class ValueType >
 struct default_dynamic< matrix_view< MDS >, ValueType >
 {
   using type = dr_matrix< ValueType,
-                          ::std::allocator< ValueType >,
+                          default_allocator< ValueType >,
                           default_layout,
                           typename detail::rebind_accessor_t<typename MDS::accessor_type,ValueType> >;
 };
@@ -41,13 +41,82 @@ template < class MDS, class ValueType >
 struct default_dynamic< vector_view< MDS >, ValueType >
 {
   using type = dr_vector< ValueType,
-                          ::std::allocator< ValueType >,
+                          default_allocator< ValueType >,
                           default_layout,
                           typename detail::rebind_accessor_t<typename MDS::accessor_type,ValueType> >;
 };
 template < class T, class V >
 using default_dynamic_t = typename default_dynamic<T,V>::type;
 
+// Allocator owned by an operand (void if the operand does not own one)
+template < class T, typename = void >
+struct operand_allocator
+{
+  using type = void;
+  static constexpr bool is_stateful = false;
+};
+template < class T >
+struct operand_allocator< T, ::std::void_t< typename T::allocator_type > >
+{
+  using type = typename T::allocator_type;
+  static constexpr bool is_stateful = !::std::allocator_traits< type >::is_always_equal::value;
+};
+
+// Allocator type of the result of an operation. Operands owning a stateful allocator (e.g. one bound
+// to a memory resource) are preferred over operands owning a stateless allocator. If no operand owns
+// an allocator, then the default allocator is used.
+template < class ValueType, class ... Ts >
+struct result_allocator { using type = default_allocator< ValueType >; };
+template < class ValueType, class T, class ... Ts >
+struct result_allocator< ValueType, T, Ts ... >
+{
+  private:
+    static constexpr bool use_first = operand_allocator<T>::is_stateful ||
+                                      ( !::std::is_void_v< typename operand_allocator<T>::type > && !( operand_allocator<Ts>::is_stateful || ... ) );
+    template < bool UseFirst, typename = void >
+    struct select { using type = typename result_allocator< ValueType, Ts ... >::type; };
+    template < typename Dummy >
+    struct select< true, Dummy > { using type = typename ::std::allocator_traits< typename operand_allocator<T>::type >::template rebind_alloc< ValueType >; };
+  public:
+    using type = typename select< use_first >::type;
+};
+template < class ValueType, class ... Ts >
+using result_allocator_t = typename result_allocator< ValueType, Ts ... >::type;
+
+// True if the result of an operation on both tensors should be rebound from the second tensor in
+// order to propagate its allocator
+template < class T1, class T2 >
+inline constexpr bool prefers_second_allocator_v = operand_allocator<T2>::is_stateful && !operand_allocator<T1>::is_stateful;
+
+// Returns the allocator of the result of an operation. The allocator is copied from the first
+// operand whose allocator rebinds to Alloc, so memory resources propagate into results.
+// If no operand owns such an allocator, then the allocator is default constructed.
+template < class Alloc >
+[[nodiscard]] inline constexpr Alloc propagate_allocator() noexcept
+{
+  return Alloc();
+}
+template < class Alloc, class T, class ... Ts >
+[[nodiscard]] inline constexpr Alloc propagate_allocator( [[maybe_unused]] const T& t, [[maybe_unused]] const Ts& ... ts ) noexcept
+{
+  using operand_alloc_type = typename operand_allocator<T>::type;
+  if constexpr ( !::std::is_void_v< operand_alloc_type > )
+  {
+    if constexpr ( ::std::is_same_v< typename ::std::allocator_traits< operand_alloc_type >::template rebind_alloc< typename ::std::allocator_traits< Alloc >::value_type >, Alloc > )
+    {
+      return Alloc( t.get_allocator() );
+    }
+    else
+    {
+      return propagate_allocator< Alloc >( ts ... );
+    }
+  }
+  else
+  {
+    return propagate_allocator< Alloc >( ts ... );
+  }
+}
+
 
 /// @brief Defines negation operation on a tensor
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -124,8 +193,8 @@ class negation
       }
       else
       {
-        using result_alloc_type = typename ::std::allocator_traits<typename tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t.get_allocator() ) );
+        using result_alloc_type = typename result_tensor_type::allocator_type;
+        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t ) );
       }
     }
   public:
@@ -195,19 +264,21 @@ class addition
     #endif
     { using type = typename U2::template rebind_t<result_value_type>; };
     #ifdef LINALG_ENABLE_CONCEPTS
-    template < concepts::dynamic_tensor_data U1, class U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> ) )
+    template < concepts::dynamic_tensor_data U1, class U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> ) &&
+                                                                       !( concepts::dynamic_tensor_data<U2> && prefers_second_allocator_v<U1,U2> ) )
     struct Result_tensor
     #else
     template < class U1, class U2 >
-    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U1> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> ) > >
+    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U1> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> ) &&
+                                                      !( concepts::dynamic_tensor_data_v<U2> && prefers_second_allocator_v<U1,U2> ) > >
     #endif
     { using type = typename U1::template rebind_t<result_value_type>; };
     #ifdef LINALG_ENABLE_CONCEPTS
-    template < class U1, concepts::dynamic_tensor_data U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> || concepts::dynamic_tensor_data<U1> ) )
+    template < class U1, concepts::dynamic_tensor_data U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> || ( concepts::dynamic_tensor_data<U1> && !prefers_second_allocator_v<U1,U2> ) ) )
     struct Result_tensor
     #else
     template < class U1, class U2  >
-    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U2> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> || concepts::dynamic_tensor_data_v<U1> ) > >
+    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U2> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> || ( concepts::dynamic_tensor_data_v<U1> && !prefers_second_allocator_v<U1,U2> ) ) > >
     #endif
     { using type = typename U2::template rebind_t<result_value_type>; };
     using result_tensor_type = typename Result_tensor< first_tensor_type, second_tensor_type >::type;
@@ -255,15 +326,14 @@ class addition
       }
       else
       {
+        using result_alloc_type = typename result_tensor_type::allocator_type;
         if constexpr ( ::std::is_same_v<first_tensor_type,result_tensor_type> )
         {
-          using result_alloc_type = typename ::std::allocator_traits<typename first_tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-          return ::std::tuple( t1.size(), t1.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t1.get_allocator() ) );
+          return ::std::tuple( t1.size(), t1.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t1, t2 ) );
         }
         else
         {
-          using result_alloc_type = typename ::std::allocator_traits<typename second_tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-          return ::std::tuple( t2.size(), t2.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t2.get_allocator() ) );
+          return ::std::tuple( t2.size(), t2.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t1, t2 ) );
         }
       }
     }
@@ -308,10 +378,10 @@ class addition
       // Cannot assume the constructor is noexcept. Just leave with no exception specification declared.
       #endif
     {
-      auto add_lambda = [&t1,&t2]( auto ... indices ) constexpr noexcept
-        { static_cast<void>( detail::access( t1, indices ... ) += detail::access( t2, indices ... ) ); };
+      auto add_lambda = []( auto&& lhs, auto&& rhs ) constexpr noexcept
+        { static_cast<void>( lhs += rhs ); };
       // Apply lamda
-      detail::apply_all( t1.underlying_span(), add_lambda, LINALG_EXECUTION_UNSEQ );
+      detail::apply_all_elementwise( add_lambda, LINALG_EXECUTION_UNSEQ, t1.underlying_span(), t2.span() );
       // Return updated tensor
       return t1;
     }
@@ -360,19 +430,21 @@ class subtraction
     #endif
     { using type = typename U2::template rebind_t<result_value_type>; };
     #ifdef LINALG_ENABLE_CONCEPTS
-    template < concepts::dynamic_tensor_data U1, class U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> ) )
+    template < concepts::dynamic_tensor_data U1, class U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> ) &&
+                                                                       !( concepts::dynamic_tensor_data<U2> && prefers_second_allocator_v<U1,U2> ) )
     struct Result_tensor
     #else
     template < class U1, class U2 >
-    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U1> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> ) > >
+    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U1> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> ) &&
+                                                      !( concepts::dynamic_tensor_data_v<U2> && prefers_second_allocator_v<U1,U2> ) > >
     #endif
     { using type = typename U1::template rebind_t<result_value_type>; };
     #ifdef LINALG_ENABLE_CONCEPTS
-    template < class U1, concepts::dynamic_tensor_data U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> || concepts::dynamic_tensor_data<U1> ) )
+    template < class U1, concepts::dynamic_tensor_data U2 > requires ( !( concepts::fixed_size_tensor_data<U1> || concepts::fixed_size_tensor_data<U2> || ( concepts::dynamic_tensor_data<U1> && !prefers_second_allocator_v<U1,U2> ) ) )
     struct Result_tensor
     #else
     template < class U1, class U2  >
-    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U2> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> || concepts::dynamic_tensor_data_v<U1> ) > >
+    struct Result_tensor< U1, U2, ::std::enable_if_t< concepts::dynamic_tensor_data_v<U2> && !( concepts::fixed_size_tensor_data_v<U1> || concepts::fixed_size_tensor_data_v<U2> || ( concepts::dynamic_tensor_data_v<U1> && !prefers_second_allocator_v<U1,U2> ) ) > >
     #endif
     { using type = typename U2::template rebind_t<result_value_type>; };
     using result_tensor_type = typename Result_tensor< first_tensor_type, second_tensor_type >::type;
@@ -420,15 +492,14 @@ class subtraction
       }
       else
       {
+        using result_alloc_type = typename result_tensor_type::allocator_type;
         if constexpr ( ::std::is_same_v<first_tensor_type,result_tensor_type> )
         {
-          using result_alloc_type = typename ::std::allocator_traits<typename first_tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-          return ::std::tuple( t1.size(), t1.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t1.get_allocator() ) );
+          return ::std::tuple( t1.size(), t1.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t1, t2 ) );
         }
         else
         {
-          using result_alloc_type = typename ::std::allocator_traits<typename second_tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-          return ::std::tuple( t2.size(), t2.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t2.get_allocator() ) );
+          return ::std::tuple( t2.size(), t2.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t1, t2 ) );
         }
       }
     }
@@ -473,10 +544,10 @@ class subtraction
       // Cannot assume the constructor is noexcept. Just leave with no exception specification declared.
       #endif
     {
-      auto subtract_lambda = [&t1,&t2]( auto ... indices ) constexpr noexcept
-        { static_cast<void>( detail::access( t1, indices ... ) -= detail::access( t2, indices ... ) ); };
+      auto subtract_lambda = []( auto&& lhs, auto&& rhs ) constexpr noexcept
+        { static_cast<void>( lhs -= rhs ); };
       // Apply lamda
-      detail::apply_all( t1.underlying_span(), subtract_lambda, LINALG_EXECUTION_UNSEQ );
+      detail::apply_all_elementwise( subtract_lambda, LINALG_EXECUTION_UNSEQ, t1.underlying_span(), t2.span() );
       // Return updated tensor
       return t1;
     }
@@ -560,8 +631,8 @@ class scalar_product
       }
       else
       {
-        using result_alloc_type = typename ::std::allocator_traits<typename tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t.get_allocator() ) );
+        using result_alloc_type = typename result_tensor_type::allocator_type;
+        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t ) );
       }
     }
   public:
@@ -628,10 +699,10 @@ class scalar_product
       #endif
     {
       // Define product operation on each element
-      auto prod_lambda = [&s,&t]( auto ... indices ) constexpr noexcept
-        { static_cast<void>( detail::access( t, indices ... ) *= s ); };
+      auto prod_lambda = [&s]( auto&& elem ) constexpr noexcept
+        { static_cast<void>( elem *= s ); };
       // Apply lamda
-      detail::apply_all( t.underlying_span(), prod_lambda, LINALG_EXECUTION_UNSEQ );
+      detail::apply_all_elementwise( prod_lambda, LINALG_EXECUTION_UNSEQ, t.underlying_span() );
       // Return updated tensor
       return t;
     }
@@ -715,8 +786,8 @@ struct scalar_division
       }
       else
       {
-        using result_alloc_type = typename ::std::allocator_traits<typename tensor_type::allocator_type>::template rebind_alloc<result_value_type>;
-        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( t.get_allocator() ) );
+        using result_alloc_type = typename result_tensor_type::allocator_type;
+        return ::std::tuple( t.size(), t.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( t ) );
       }
     }
   public:
@@ -761,10 +832,10 @@ struct scalar_division
       #endif
     {
       // Define product operation on each element
-      auto divide_lambda = [&s,&t]( auto ... indices ) constexpr noexcept
-        { static_cast<void>( detail::access( t, indices ... ) /= s ); };
+      auto divide_lambda = [&s]( auto&& elem ) constexpr noexcept
+        { static_cast<void>( elem /= s ); };
       // Apply lamda
-      detail::apply_all( t.underlying_span(), divide_lambda, LINALG_EXECUTION_UNSEQ );
+      detail::apply_all_elementwise( divide_lambda, LINALG_EXECUTION_UNSEQ, t.underlying_span() );
       // Return updated tensor
       return t;
     }
@@ -793,7 +864,7 @@ class transpose_matrix
     #endif
     struct Result_matrix
     { using type = dr_matrix< typename U::value_type,
-                              ::std::allocator< typename U::value_type >,
+                              default_allocator< typename U::value_type >,
                               default_layout,
                               typename detail::rebind_accessor_t<typename U::accessor_type,typename U::value_type> >; };
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -817,31 +888,6 @@ class transpose_matrix
     #endif
     { using type = U; };
     using result_matrix_type = typename Result_matrix< matrix_type >::type;
-    // Returns the allocator of matrix_type
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< concepts::dynamic_matrix_data_v< Mat > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( concepts::dynamic_matrix_data< matrix_type > )
-    #endif
-    {
-      return m.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_matrix_data_v< Mat > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_matrix_data< matrix_type > )
-    #endif
-    {
-      return ::std::allocator< ::std::remove_cv_t<typename matrix_type::element_type> >();
-    }
     // Gets necessary arguments for constrution
     // If matrix type is fixed size, then the lambda expression is the only argument needed
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -877,7 +923,7 @@ class transpose_matrix
                      ::std::allocator_traits<typename result_matrix_type::allocator_type>::is_always_equal::value )
       {
         return ::std::tuple( result_extents_type( m.size().extent(1), m.size().extent(0) ),
-                             result_extents_type( m.capacity().extent(0), m.capacity().extent(0) ),
+                             result_extents_type( m.capacity().extent(1), m.capacity().extent(0) ),
                              ::std::forward<Lambda>( lambda ) );
       }
       else
@@ -886,7 +932,7 @@ class transpose_matrix
         return ::std::tuple( result_extents_type( m.size().extent(1), m.size().extent(0) ),
                              result_extents_type( m.capacity().extent(1), m.capacity().extent(0) ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( get_allocator( m ) ) );
+                             propagate_allocator<result_alloc_type>( m ) );
       }
     }
   public:
@@ -969,7 +1015,7 @@ class conjugate_matrix
     #endif
     struct Result_matrix
     { using type = dr_matrix< result_element_type,
-                              ::std::allocator< result_element_type >,
+                              default_allocator< result_element_type >,
                               default_layout,
                               typename detail::rebind_accessor_t<typename U::accessor_type,result_element_type> >; };
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -992,35 +1038,10 @@ class conjugate_matrix
     struct Result_matrix< U, ::std::enable_if_t< concepts::dynamic_matrix_data_v<U> > >
     #endif
     { using type = dr_matrix< result_element_type,
-                              ::std::allocator< result_element_type >,
+                              default_allocator< result_element_type >,
                               typename U::layout_type,
                               typename detail::rebind_accessor_t<typename U::accessor_type,result_element_type> >; };
     using result_matrix_type = typename Result_matrix< matrix_type >::type;
-    // Returns the allocator of matrix_type
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< concepts::dynamic_matrix_data_v< Mat > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( concepts::dynamic_matrix_data< matrix_type > )
-    #endif
-    {
-      return m.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_matrix_data_v< Mat > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_matrix_data< matrix_type > )
-    #endif
-    {
-      return ::std::allocator<result_element_type>();
-    }
     // Gets necessary arguments for construction
     // If matrix type is fixed size, then the lambda expression is the only argument needed
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -1065,7 +1086,7 @@ class conjugate_matrix
         return ::std::tuple( result_extents_type( m.size().extent(1), m.size().extent(0) ),
                              result_extents_type( m.capacity().extent(1), m.capacity().extent(0) ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( get_allocator( m ) ) );
+                             propagate_allocator<result_alloc_type>( m ) );
       }
     }
   public:
@@ -1121,7 +1142,7 @@ class conjugate_vector
     #endif
     struct Result_vector
     { using type = dr_vector< result_element_type,
-                              ::std::allocator< result_element_type >,
+                              default_allocator< result_element_type >,
                               default_layout,
                               typename detail::rebind_accessor_t<typename U::accessor_type,result_element_type> >; };
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -1141,31 +1162,6 @@ class conjugate_vector
     #endif
     { using type = typename U::template rebind_t<result_element_type>; };
     using result_vector_type = typename Result_vector< vector_type >::type;
-    // Returns the allocator of vector_type
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Vec = vector_type,
-               typename = ::std::enable_if_t< concepts::dynamic_vector_data_v< Vec > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const vector_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( concepts::dynamic_vector_data< vector_type > )
-    #endif
-    {
-      return m.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Vec = vector_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_vector_data_v< Vec > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const vector_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_vector_data< vector_type > )
-    #endif
-    {
-      return ::std::allocator<result_element_type>();
-    }
     // Gets necessary arguments for constrution
     // If vector type is fixed size, then the lambda expression is the only argument needed
     #ifdef LINALG_ENABLE_CONCEPTS
@@ -1203,8 +1199,8 @@ class conjugate_vector
       }
       else
       {
-        using result_alloc_type = typename ::std::allocator_traits<typename vector_type::allocator_type>::template rebind_alloc<result_element_type>;
-        return ::std::tuple( v.size(), v.capacity(), ::std::forward<Lambda>( lambda ), result_alloc_type( get_allocator( v ) ) );
+        using result_alloc_type = typename result_vector_type::allocator_type;
+        return ::std::tuple( v.size(), v.capacity(), ::std::forward<Lambda>( lambda ), propagate_allocator<result_alloc_type>( v ) );
       }
     }
   public:
@@ -1257,31 +1253,6 @@ class vector_matrix_product
     /// @brief Input matrix type
     using matrix_type = M;
   private:
-    // Return the allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< concepts::dynamic_matrix_data_v< Mat > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires concepts::dynamic_matrix_data< matrix_type >
-    #endif
-    {
-      return m.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = matrix_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_matrix_data_v< Mat > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const matrix_type& m ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_matrix_data< matrix_type > )
-    #endif
-    {
-      return ::std::allocator<result_value_type>();
-    }
     // Defines the result layout type
     #ifdef LINALG_ENABLE_CONCEPTS
     template < class Vec, class Mat, size_t Dim >
@@ -1326,7 +1297,7 @@ class vector_matrix_product
                                                                      typename Result_layout<vector_type,matrix_type,1>::type,
                                                                      detail::rebind_accessor_t<typename vector_type::accessor_type,result_value_type> >,
                                                           dr_vector< result_value_type,
-                                                                     typename ::std::allocator_traits< ::std::decay_t< decltype( get_allocator( declval<matrix_type>() ) ) > >::template rebind_alloc<result_value_type>,
+                                                                     result_allocator_t< result_value_type, vector_type, matrix_type >,
                                                                      typename Result_layout<vector_type,matrix_type,1>::type,
                                                                      detail::rebind_accessor_t<typename vector_type::accessor_type,result_value_type> > >;
     using post_result_vector_type = ::std::conditional_t< 
@@ -1340,7 +1311,7 @@ class vector_matrix_product
                                                                      typename Result_layout<vector_type,matrix_type,0>::type,
                                                                      detail::rebind_accessor_t<typename vector_type::accessor_type,result_value_type> >,
                                                           dr_vector< result_value_type,
-                                                                     typename ::std::allocator_traits< decay_t< decltype( get_allocator( declval<matrix_type>() ) ) > >::template rebind_alloc<result_value_type>,
+                                                                     result_allocator_t< result_value_type, matrix_type, vector_type >,
                                                                      typename Result_layout<vector_type,matrix_type,0>::type,
                                                                      detail::rebind_accessor_t<typename vector_type::accessor_type,result_value_type> > >;
     // Gets necessary arguments for construction
@@ -1368,7 +1339,7 @@ class vector_matrix_product
                typename = ::std::enable_if_t< concepts::dynamic_vector_data_v<Result_vector> >,
                typename = ::std::enable_if_t<true> >
     #endif
-    [[nodiscard]] static inline constexpr decltype(auto) collect_ctor_args( [[maybe_unused]] const vector_type&, const matrix_type& m, Lambda&& lambda ) noexcept
+    [[nodiscard]] static inline constexpr decltype(auto) collect_ctor_args( [[maybe_unused]] const vector_type& v, const matrix_type& m, Lambda&& lambda ) noexcept
     #ifdef LINALG_ENABLE_CONCEPTS
       requires concepts::dynamic_vector_data<pre_result_vector_type>
     #endif
@@ -1389,7 +1360,7 @@ class vector_matrix_product
         return ::std::tuple( result_extents_type( m.size().extent(1) ),
                              result_extents_type( m.capacity().extent(1) ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( m.get_allocator() ) );
+                             propagate_allocator<result_alloc_type>( v, m ) );
       }
     }
     // Gets necessary arguments for constrution
@@ -1417,7 +1388,7 @@ class vector_matrix_product
                typename = ::std::enable_if_t< concepts::dynamic_vector_data_v<Result_vector> >,
                typename = ::std::enable_if_t<true> >
     #endif
-    [[nodiscard]] static inline constexpr decltype(auto) collect_ctor_args( const matrix_type& m, [[maybe_unused]] const vector_type&, Lambda&& lambda ) noexcept
+    [[nodiscard]] static inline constexpr decltype(auto) collect_ctor_args( const matrix_type& m, [[maybe_unused]] const vector_type& v, Lambda&& lambda ) noexcept
     #ifdef LINALG_ENABLE_CONCEPTS
       requires concepts::dynamic_vector_data<post_result_vector_type>
     #endif
@@ -1438,7 +1409,7 @@ class vector_matrix_product
         return ::std::tuple( result_extents_type( m.size().extent(0) ),
                              result_extents_type( m.capacity().extent(0) ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( m.get_allocator() ) );
+                             propagate_allocator<result_alloc_type>( m, v ) );
       }
     }
   public:
@@ -1460,14 +1431,7 @@ class vector_matrix_product
                              m,
                              #ifndef LINALG_COMPILER_CLANG
                              [&v,&m]( auto index ) constexpr noexcept
-                             {
-                               result_value_type result = 0;
-                               detail::for_each( LINALG_EXECUTION_UNSEQ,
-                                                 detail::faux_index_iterator<typename vector_type::index_type>( 0 ),
-                                                 detail::faux_index_iterator<typename vector_type::index_type>( v.size().extent(0) ),
-                                                 [ &v, &m, &index, &result ] ( typename vector_type::index_type index2 ) constexpr noexcept
-                                                   { result += detail::access( v, index2 ) * detail::access( m, index2, index ); } );
-                               return result; }
+                               { return detail::vector_matrix_product_element<result_value_type>( v, m, index ); }
                              #else // Clang does not allow use of input variables in lambda expression inside noexcept specification
                              []( auto index ) constexpr noexcept
                              { return result_value_type(); }
@@ -1496,15 +1460,7 @@ class vector_matrix_product
       }
       // Define product operation on each element pair
       auto lambda = [&v,&m]( auto index ) constexpr noexcept
-      {
-        result_value_type result = 0;
-        detail::for_each( LINALG_EXECUTION_UNSEQ,
-                          detail::faux_index_iterator<typename vector_type::index_type>( 0 ),
-                          detail::faux_index_iterator<typename vector_type::index_type>( v.size().extent(0) ),
-                          [ &v, &m, &index, &result ] ( typename vector_type::index_type index2 ) constexpr noexcept
-                            { result += detail::access( v, index2 ) * detail::access( m, index2, index ); } );
-        return result;
-      };
+        { return detail::vector_matrix_product_element<result_value_type>( v, m, index ); };
       // Construct multiplication vector
       return detail::make_from_tuple<pre_result_vector_type>( collect_ctor_args( v, m, lambda ) );
     }
@@ -1542,14 +1498,7 @@ class vector_matrix_product
                              ::std::declval<const matrix_type&>(),
                              #ifndef LINALG_COMPILER_CLANG
                              [&v,&m]( auto index ) constexpr noexcept
-                             {
-                               result_value_type result = 0;
-                               detail::for_each( LINALG_EXECUTION_UNSEQ,
-                                                 detail::faux_index_iterator<typename vector_type::index_type>( 0 ),
-                                                 detail::faux_index_iterator<typename vector_type::index_type>( v.size().extent(0) ),
-                                                 [ &v, &m, &index, &result ] ( typename vector_type::index_type index2 ) constexpr noexcept
-                                                   { result += detail::access( m, index, index2 ) * detail::access( v, index2 ); } );
-                               return result; }
+                               { return detail::matrix_vector_product_element<result_value_type>( m, v, index ); }
                              #else // Clang does not allow use of input variables in lambda expression inside noexcept specification
                              []( auto index ) constexpr noexcept
                              { return result_value_type(); }
@@ -1578,15 +1527,7 @@ class vector_matrix_product
       }
       // Define product operation on each element pair
       auto lambda = [&v,&m]( auto index ) constexpr noexcept
-      {
-        result_value_type result = 0;
-        detail::for_each( LINALG_EXECUTION_UNSEQ,
-                          detail::faux_index_iterator<typename vector_type::index_type>( 0 ),
-                          detail::faux_index_iterator<typename vector_type::index_type>( v.size().extent(0) ),
-                          [ &v, &m, &index, &result ] ( typename vector_type::index_type index2 ) constexpr noexcept
-                            { result += detail::access( m, index, index2 ) * detail::access( v, index2 ); } );
-        return result;
-      };
+        { return detail::matrix_vector_product_element<result_value_type>( m, v, index ); };
       // Construct multiplication vector
       return detail::make_from_tuple<post_result_vector_type>( collect_ctor_args( m, v, lambda ) );
     }
@@ -1610,47 +1551,6 @@ class matrix_matrix_product
     /// @brief Second input matrix type
     using second_matrix_type = M2;
   private:
-    // Return the allocator of m1
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename Mat = first_matrix_type,
-               typename = ::std::enable_if_t< concepts::dynamic_matrix_data_v< Mat > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const first_matrix_type& m1, [[maybe_unused]] const second_matrix_type& m2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires concepts::dynamic_matrix_data< first_matrix_type >
-    #endif
-    {
-      return m1.get_allocator();
-    }
-    // Returns the allocator of m2
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename First_mat = first_matrix_type,
-               typename Second_mat = second_matrix_type,
-               typename = ::std::enable_if_t< concepts::dynamic_matrix_data_v< Second_mat > && !concepts::dynamic_matrix_data_v< First_mat > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const first_matrix_type& m1, const second_matrix_type& m2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( concepts::dynamic_matrix_data< second_matrix_type > && !concepts::dynamic_matrix_data< first_matrix_type > )
-    #endif
-    {
-      return m2.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename First_mat = first_matrix_type,
-               typename Second_mat = second_matrix_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_matrix_data_v< First_mat > && !concepts::dynamic_matrix_data_v< Second_mat > >,
-               typename = ::std::enable_if_t<true>,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const first_matrix_type& m1, [[maybe_unused]] const second_matrix_type& m2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_matrix_data< first_matrix_type > && !concepts::dynamic_matrix_data< second_matrix_type > )
-    #endif
-    {
-      return ::std::allocator<result_value_type>();
-    }
     // Defines the result layout type
     #ifdef LINALG_ENABLE_CONCEPTS
     template < class Mat1, class Mat2, auto Ext1, auto Ext2 >
@@ -1698,7 +1598,7 @@ class matrix_matrix_product
                                                                 typename Result_layout< first_matrix_type, second_matrix_type, first_matrix_type::extents_type::static_extent(0), second_matrix_type::extents_type::static_extent(1) >::type,
                                                                detail::rebind_accessor_t< typename first_matrix_type::accessor_type,result_value_type > >,
                                                      dr_matrix< result_value_type,
-                                                                typename ::std::allocator_traits< ::std::decay_t< decltype( get_allocator( ::std::declval<first_matrix_type>(), ::std::declval<second_matrix_type>() ) ) > >::template rebind_alloc<result_value_type>,
+                                                                result_allocator_t< result_value_type, first_matrix_type, second_matrix_type >,
                                                                 typename Result_layout< first_matrix_type, second_matrix_type, ::std::experimental::dynamic_extent, ::std::experimental::dynamic_extent >::type,
                                                                 detail::rebind_accessor_t< typename first_matrix_type::accessor_type,result_value_type > > >;
     // Gets necessary arguments for constrution
@@ -1746,7 +1646,7 @@ class matrix_matrix_product
         return ::std::tuple( result_extents_type( m1.size().extent(0), m2.size().extent(1) ),
                              result_extents_type( m1.capacity().extent(0), m2.capacity().extent(1) ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( get_allocator( m1, m2 ) ) );
+                             propagate_allocator<result_alloc_type>( m1, m2 ) );
       }
     }
   public:
@@ -1767,14 +1667,7 @@ class matrix_matrix_product
                            ::std::declval<const second_matrix_type&>(),
                            #ifndef LINALG_COMPILER_CLANG
                            [&m1,&m2]( auto index1, auto index2 ) constexpr noexcept
-                           {
-                             result_value_type result = 0;
-                             detail::for_each( LINALG_EXECUTION_UNSEQ,
-                                               detail::faux_index_iterator<typename first_matrix_type::index_type>( 0 ),
-                                               detail::faux_index_iterator<typename first_matrix_type::index_type>( m1.size().extent(1) ),
-                                               [ &m1, &m2, &index1, &index2, &result ] ( typename first_matrix_type::index_type index ) constexpr noexcept
-                                                 { result += detail::access( m1, index1, index ) * detail::access( m2, index, index2 ); } );
-                             return result; }
+                             { return detail::matrix_product_element<result_value_type>( m1, m2, index1, index2 ); }
                           #else // Clang does not allow use of input variables in lambda expression inside noexcept specification
                            []( auto index1, auto index2 ) constexpr noexcept
                            { return result_value_type(); }
@@ -1801,19 +1694,23 @@ class matrix_matrix_product
           throw length_error( "Matrix sizes are incompatable." );
         }
       }
-      // Define product operation on each element pair
-      auto lambda = [&m1,&m2]( auto index1, auto index2 ) constexpr noexcept
+      if constexpr ( detail::is_recursive_layout_v< typename result_matrix_type::layout_type > ||
+                     detail::is_tiled_layout_v< typename result_matrix_type::layout_type > )
       {
-        result_value_type result = 0;
-        detail::for_each( LINALG_EXECUTION_UNSEQ,
-                          detail::faux_index_iterator<typename first_matrix_type::index_type>( 0 ),
-                          detail::faux_index_iterator<typename first_matrix_type::index_type>( m1.size().extent(1) ),
-                          [ &m1, &m2, &index1, &index2, &result ] ( typename first_matrix_type::index_type index ) constexpr noexcept
-                            { result += detail::access( m1, index1, index ) * detail::access( m2, index, index2 ); } );
+        // Recursive and tiled layouts are blocked, so are written into a constructed result
+        auto zero = []( auto, auto ) constexpr noexcept { return result_value_type( 0 ); };
+        result_matrix_type result = detail::make_from_tuple<result_matrix_type>( collect_ctor_args( m1, m2, zero ) );
+        detail::matrix_product_into( result, m1, m2, LINALG_EXECUTION_UNSEQ );
         return result;
-      };
-      // Construct multiplication matrix
-      return detail::make_from_tuple<result_matrix_type>( collect_ctor_args( m1, m2, lambda ) );
+      }
+      else
+      {
+        // Define product operation on each element pair
+        auto lambda = [&m1,&m2]( auto index1, auto index2 ) constexpr noexcept
+          { return detail::matrix_product_element<result_value_type>( m1, m2, index1, index2 ); };
+        // Construct multiplication matrix
+        return detail::make_from_tuple<result_matrix_type>( collect_ctor_args( m1, m2, lambda ) );
+      }
     }
     /// @brief Returns m1 *= m2
     #ifndef LINALG_ENABLE_CONCEPTS
@@ -1908,47 +1805,6 @@ class outer_product
     /// @brief Second input vector type
     using second_vector_type = V2;
   private:
-    // Return the allocator of v1
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename First_vector = first_vector_type,
-               typename = ::std::enable_if_t< concepts::dynamic_vector_data_v< First_vector > > >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( const first_vector_type& v1, [[maybe_unused]] const second_vector_type& v2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires concepts::dynamic_vector_data< first_vector_type >
-    #endif
-    {
-      return v1.get_allocator();
-    }
-    // Returns the allocator of v2
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename First_vector  = first_vector_type,
-               typename Second_vector = second_vector_type,
-               typename = ::std::enable_if_t< concepts::dynamic_vector_data_v< Second_vector > && !concepts::dynamic_vector_data_v< First_vector > >,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const first_vector_type& v1, const second_vector_type& v2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( concepts::dynamic_vector_data< second_vector_type > && !concepts::dynamic_vector_data< first_vector_type > )
-    #endif
-    {
-      return v2.get_allocator();
-    }
-    // Returns the std allocator
-    #ifndef LINALG_ENABLE_CONCEPTS
-    template < typename First_vector  = first_vector_type,
-               typename Second_vector = second_vector_type,
-               typename = ::std::enable_if_t< !concepts::dynamic_vector_data_v< First_vector > && !concepts::dynamic_vector_data_v< Second_vector > >,
-               typename = ::std::enable_if_t<true>,
-               typename = ::std::enable_if_t<true> >
-    #endif
-    [[nodiscard]] static inline constexpr decltype(auto) get_allocator( [[maybe_unused]] const first_vector_type& v1, [[maybe_unused]] const second_vector_type& v2 ) noexcept
-    #ifdef LINALG_ENABLE_CONCEPTS
-      requires ( !concepts::dynamic_vector_data< first_vector_type > && !concepts::dynamic_vector_data< second_vector_type > )
-    #endif
-    {
-      return ::std::allocator<result_value_type>();
-    }
     // Defines the result layout type
     #ifdef LINALG_ENABLE_CONCEPTS
     template < class Vec1, class Vec2, auto Ext1, auto Ext2 >
@@ -1996,7 +1852,7 @@ class outer_product
                                                                 typename Result_layout< first_vector_type, second_vector_type, first_vector_type::extents_type::static_extent(0), second_vector_type::extents_type::static_extent(0) >::type,
                                                                 detail::rebind_accessor_t<typename first_vector_type::accessor_type,result_value_type> >,
                                                      dr_matrix< result_value_type,
-                                                                typename ::std::allocator_traits< ::std::decay_t< decltype( get_allocator( ::std::declval<first_vector_type>(), ::std::declval<second_vector_type>() ) ) > >::template rebind_alloc<result_value_type>,
+                                                                result_allocator_t< result_value_type, first_vector_type, second_vector_type >,
                                                                 typename Result_layout< first_vector_type, second_vector_type, ::std::experimental::dynamic_extent, ::std::experimental::dynamic_extent >::type,
                                                                 detail::rebind_accessor_t<typename first_vector_type::accessor_type,result_value_type> > >;
     // Gets necessary arguments for constrution
@@ -2044,7 +1900,7 @@ class outer_product
         return ::std::tuple( result_extents_type( v1.size(), v2.size() ),
                              result_extents_type( v1.capacity(), v2.capacity() ),
                              ::std::forward<Lambda>( lambda ),
-                             result_alloc_type( get_allocator(v1,v2) ) );
+                             propagate_allocator<result_alloc_type>( v1, v2 ) );
       }
     }
   public:
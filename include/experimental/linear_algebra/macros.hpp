@@ -36,6 +36,55 @@
 #  endif
 #endif
 
+// Define a parallel execution policy.
+// Uses the library thread pool so parallel execution is available on every toolchain.
+#ifndef LINALG_EXECUTION_PAR
+#  define LINALG_EXECUTION_PAR ::std::experimental::math::thread_pool_policy()
+#endif
+
+// Edge length of the tiles used when traversing views whose stride orders disagree.
+#ifndef LINALG_TRAVERSAL_TILE_SIZE
+#  define LINALG_TRAVERSAL_TILE_SIZE 32
+#endif
+
+// Edge length below which recursive kernels stop subdividing and loop directly. A power of two,
+// so the blocks visited are aligned to the blocks of recursive layouts.
+#ifndef LINALG_RECURSIVE_BASE_SIZE
+#  define LINALG_RECURSIVE_BASE_SIZE 32
+#endif
+
+// Largest ratio of the storage spanned by a recursive layout to the number of elements it holds.
+// Morton order spans the code of the last element, which far exceeds the element count when the
+// extents differ greatly, so larger ratios are rejected unless the span is at most one base block.
+#ifndef LINALG_RECURSIVE_SPAN_LIMIT
+#  define LINALG_RECURSIVE_SPAN_LIMIT 4
+#endif
+
+// Granularity in bytes at which the parallel constructors of dynamic tensors first touch their
+// storage. Should match the page size of the system so that each page is touched by one worker.
+#ifndef LINALG_FIRST_TOUCH_PAGE_SIZE
+#  define LINALG_FIRST_TOUCH_PAGE_SIZE 4096
+#endif
+
+// Default factor of growth_traits, by which a dimension of the capacity of a dynamic tensor grows
+// when a resize exceeds it. Growing geometrically makes repeated incremental growth amortized O(1)
+// per element.
+#ifndef LINALG_GROWTH_FACTOR
+#  define LINALG_GROWTH_FACTOR 2
+#endif
+
+// Default slack of growth_traits, the minimum number of elements of slack added to a dimension of
+// the capacity of a dynamic tensor when a resize exceeds it.
+#ifndef LINALG_GROWTH_SLACK
+#  define LINALG_GROWTH_SLACK 0
+#endif
+
+// Define to use polymorphic allocators by default.
+// Results of operations on views then allocate from std::pmr::get_default_resource().
+#ifndef LINALG_DEFAULT_POLYMORPHIC_ALLOCATOR
+#  define LINALG_DEFAULT_POLYMORPHIC_ALLOCATOR 0
+#endif
+
 // Force compiler to inline function
 #ifndef LINALG_FORCE_INLINE_FUNCTION
 #  ifdef LINALG_COMPILER_MSVC
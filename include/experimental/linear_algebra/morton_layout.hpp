@@ -0,0 +1,350 @@
+//==================================================================================================
+//  File:       morton_layout.hpp
+//
+//  Summary:    This header defines a Morton (Z-order) layout policy for matrices and tensors of up
+//              to three dimensions. The offset of an element interleaves the bits of its indices,
+//              so every aligned power of two block is contiguous at every scale. Recursive kernels
+//              which split views in halves thus touch contiguous memory without knowing the cache
+//              sizes. Views into a Morton tensor remain Morton ordered.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_MORTON_LAYOUT_HPP
+#define LINEAR_ALGEBRA_MORTON_LAYOUT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Define if bits may be interleaved with the BMI2 parallel bit deposit instruction. Define as 0 on
+// processors which microcode the instruction (AMD before Zen 3) to use the table instead.
+#ifndef LINALG_MORTON_PDEP
+#  if defined( __BMI2__ ) && ( defined( __x86_64__ ) || defined( _M_X64 ) ) && \
+      ( defined( __cpp_lib_is_constant_evaluated ) || defined( __GNUC__ ) )
+#    define LINALG_MORTON_PDEP 1
+#  else
+#    define LINALG_MORTON_PDEP 0
+#  endif
+#endif
+
+#if LINALG_MORTON_PDEP
+#  include <immintrin.h>
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Morton Spread inserts Rank - 1 zero bits between consecutive bits of an index. The parallel bit
+//  deposit instruction is used where available; otherwise the index is spread a byte at a time
+//  through a lookup table.
+//==================================================================================================
+template < ::std::size_t Rank >
+[[nodiscard]] constexpr ::std::uint64_t morton_spread_byte( ::std::uint64_t byte ) noexcept
+{
+  ::std::uint64_t spread = 0;
+  for ( ::std::size_t bit = 0; bit < 8; ++bit )
+  {
+    spread |= ( ( byte >> bit ) & 1u ) << ( bit * Rank );
+  }
+  return spread;
+}
+
+template < ::std::size_t Rank >
+[[nodiscard]] constexpr ::std::array< ::std::uint64_t, 256 > make_morton_table() noexcept
+{
+  ::std::array< ::std::uint64_t, 256 > table {};
+  for ( ::std::size_t byte = 0; byte < 256; ++byte )
+  {
+    table[byte] = morton_spread_byte<Rank>( byte );
+  }
+  return table;
+}
+
+template < ::std::size_t Rank >
+inline constexpr ::std::array< ::std::uint64_t, 256 > morton_table = make_morton_table<Rank>();
+
+/// @brief Bits of a Morton code occupied by the least significant dimension
+template < ::std::size_t Rank >
+inline constexpr ::std::uint64_t morton_mask = ( Rank == 2 ) ? 0x5555555555555555ull : 0x1249249249249249ull;
+
+template < ::std::size_t Rank >
+[[nodiscard]] constexpr ::std::uint64_t morton_spread( ::std::uint64_t index ) noexcept
+{
+  static_assert( ( Rank == 2 ) || ( Rank == 3 ), "Morton codes are defined for two or three dimensions." );
+  #if LINALG_MORTON_PDEP
+  #  if defined( __cpp_lib_is_constant_evaluated )
+  if ( !::std::is_constant_evaluated() )
+  #  else
+  if ( !__builtin_is_constant_evaluated() )
+  #  endif
+  {
+    return _pdep_u64( index, morton_mask<Rank> );
+  }
+  #endif
+  ::std::uint64_t spread = 0;
+  for ( ::std::size_t byte = 0; ( byte * 8 * Rank < 64 ) && ( index != 0 ); ++byte, index >>= 8 )
+  {
+    spread |= morton_table<Rank>[ index & 0xFFu ] << ( byte * 8 * Rank );
+  }
+  return spread;
+}
+
+/// @brief Returns the Morton code of a position in a space of the given rank. The last dimension
+///        occupies the least significant bit, so neighbouring columns are adjacent as in layout_right.
+template < class IndexType >
+[[nodiscard]] constexpr IndexType morton_encode( const ::std::array<IndexType,3>& position, ::std::size_t rank ) noexcept
+{
+  switch ( rank )
+  {
+    case 3:
+      return static_cast<IndexType>( ( morton_spread<3>( position[0] ) << 2 ) |
+                                     ( morton_spread<3>( position[1] ) << 1 ) |
+                                       morton_spread<3>( position[2] ) );
+    case 2:
+      return static_cast<IndexType>( ( morton_spread<2>( position[0] ) << 1 ) | morton_spread<2>( position[1] ) );
+    default:
+      return position[0];
+  }
+}
+
+}       //- detail namespace
+
+/// @brief Layout policy storing a matrix or tensor of up to three dimensions in Morton (Z) order.
+///        The offset of an element interleaves the bits of its indices, with the last index in the
+///        least significant bit. The storage of a tensor is contiguous when each extent is the same
+///        power of two; otherwise it spans the Morton code of the last element, which grows with the
+///        square (or cube) of the largest extent. A 1000 x 2 matrix thus spans about 700000 elements,
+///        so tensors reject capacities spanning more than LINALG_RECURSIVE_SPAN_LIMIT times the
+///        elements they hold; such shapes are better stored in a tiled or strided layout.
+///        Mappings of lower rank describe views (subtensors, rows, columns, ...) of a Morton tensor;
+///        they record which dimensions of the tensor they run along and where they start.
+struct layout_morton
+{
+  /// @brief Maps indices of a (sub)view of a Morton tensor to offsets
+  /// @tparam Extents extents of the view
+  template < class Extents >
+  class mapping
+  {
+    static_assert( Extents::rank() <= 3, "Morton layouts describe tensors of up to three dimensions and their subviews." );
+
+    public:
+      //- Types
+
+      /// @brief Type used to express the extents of the view
+      using extents_type = Extents;
+      /// @brief Type used for indices and offsets
+      using index_type   = typename extents_type::index_type;
+      /// @brief Type used for sizes
+      using size_type    = typename extents_type::size_type;
+      /// @brief Type used for ranks
+      using rank_type    = typename extents_type::rank_type;
+      /// @brief Layout policy of the mapping
+      using layout_type  = layout_morton;
+
+      //- Constructors
+
+      /// @brief Default constructor
+      constexpr mapping() noexcept;
+      /// @brief Constructs the mapping of a whole Morton tensor of the given extents
+      /// @param extents extents of the tensor
+      constexpr mapping( const extents_type& extents ) noexcept;
+      /// @brief Constructs the mapping of a view into a Morton tensor
+      /// @param extents     extents of the view
+      /// @param origin      position in the tensor of the first element of the view
+      /// @param axes        dimension of the tensor along which each dimension of the view runs
+      /// @param source_rank rank of the tensor
+      constexpr mapping( const extents_type& extents, const ::std::array<index_type,3>& origin, const ::std::array<rank_type,3>& axes, rank_type source_rank ) noexcept;
+      /// @brief Converting constructor from a mapping with compatible extents
+      template < class OtherExtents, typename = ::std::enable_if_t< ::std::is_constructible_v< extents_type, OtherExtents > > >
+      constexpr mapping( const mapping<OtherExtents>& rhs ) noexcept;
+
+      //- Observers
+
+      /// @brief Returns the extents of the view
+      [[nodiscard]] constexpr const extents_type& extents() const noexcept { return this->extents_; }
+      /// @brief Returns the position in the tensor of the first element of the view
+      [[nodiscard]] constexpr const ::std::array<index_type,3>& origin() const noexcept { return this->origin_; }
+      /// @brief Returns the dimension of the tensor along which each dimension of the view runs
+      [[nodiscard]] constexpr const ::std::array<rank_type,3>& axes() const noexcept { return this->axes_; }
+      /// @brief Returns the rank of the tensor
+      [[nodiscard]] constexpr rank_type source_rank() const noexcept { return this->source_rank_; }
+      /// @brief Returns one past the largest offset of any element of the view, the Morton code of
+      ///        its last element. This may far exceed the number of elements when extents differ.
+      [[nodiscard]] constexpr index_type required_span_size() const noexcept;
+
+      //- Mapping
+
+      /// @brief Returns the offset of the element at the given indices
+      template < class ... Indices >
+      [[nodiscard]] constexpr index_type operator()( Indices ... indices ) const noexcept;
+
+      //- Properties
+
+      [[nodiscard]] static constexpr bool is_always_unique() noexcept     { return true; }
+      [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept { return false; }
+      [[nodiscard]] static constexpr bool is_always_strided() noexcept    { return false; }
+      [[nodiscard]] static constexpr bool is_unique() noexcept            { return true; }
+      [[nodiscard]] static constexpr bool is_exhaustive() noexcept        { return false; }
+      [[nodiscard]] static constexpr bool is_strided() noexcept           { return false; }
+
+      /// @brief Mappings are equal if they map every index to the same offset
+      [[nodiscard]] friend constexpr bool operator == ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return ( lhs.extents() == rhs.extents() ) && ( lhs.origin() == rhs.origin() ) &&
+               ( lhs.axes() == rhs.axes() ) && ( lhs.source_rank() == rhs.source_rank() );
+      }
+      [[nodiscard]] friend constexpr bool operator != ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return !( lhs == rhs );
+      }
+
+      /// @brief Returns the mapping and offset of a subview; found by submdspan through ADL
+      template < class ... Slices >
+      [[nodiscard]] friend constexpr auto submdspan_mapping( const mapping& src, Slices ... slices )
+      {
+        return src.submapping( slices ... );
+      }
+
+    private:
+      //- Implementation
+
+      /// @brief Returns the position in the tensor of the element at the given indices
+      template < class ... Indices >
+      [[nodiscard]] constexpr ::std::array<index_type,3> position( Indices ... indices ) const noexcept;
+      /// @brief Returns the mapping and offset of a subview
+      template < class ... Slices >
+      [[nodiscard]] constexpr auto submapping( Slices ... slices ) const;
+
+      //- Data
+
+      /// @brief Extents of the view
+      extents_type               extents_ {};
+      /// @brief Position in the tensor of the first element of the view
+      ::std::array<index_type,3> origin_ {};
+      /// @brief Dimension of the tensor along which each dimension of the view runs
+      ::std::array<rank_type,3>  axes_ {};
+      /// @brief Rank of the tensor
+      rank_type                  source_rank_ = 0;
+
+      template < class > friend class mapping;
+  };
+};
+
+namespace detail
+{
+
+//==================================================================================================
+//  Morton Layout traits
+//==================================================================================================
+template <>
+struct is_recursive_layout< layout_morton > : public ::std::true_type { };
+
+}       //- detail namespace
+
+//----------------------------------------------
+// Implementation of layout_morton::mapping<Extents>
+//----------------------------------------------
+
+template < class Extents >
+constexpr layout_morton::mapping<Extents>::mapping() noexcept :
+  axes_{ 0, 1, 2 },
+  source_rank_( Extents::rank() )
+{
+}
+
+template < class Extents >
+constexpr layout_morton::mapping<Extents>::mapping( const extents_type& extents ) noexcept :
+  extents_( extents ),
+  origin_{},
+  axes_{ 0, 1, 2 },
+  source_rank_( Extents::rank() )
+{
+}
+
+template < class Extents >
+constexpr layout_morton::mapping<Extents>::mapping( const extents_type& extents, const ::std::array<index_type,3>& origin, const ::std::array<rank_type,3>& axes, rank_type source_rank ) noexcept :
+  extents_( extents ),
+  origin_( origin ),
+  axes_( axes ),
+  source_rank_( source_rank )
+{
+}
+
+template < class Extents >
+template < class OtherExtents, typename >
+constexpr layout_morton::mapping<Extents>::mapping( const mapping<OtherExtents>& rhs ) noexcept :
+  extents_( rhs.extents_ ),
+  origin_{ static_cast<index_type>( rhs.origin_[0] ), static_cast<index_type>( rhs.origin_[1] ), static_cast<index_type>( rhs.origin_[2] ) },
+  axes_( rhs.axes_ ),
+  source_rank_( rhs.source_rank_ )
+{
+}
+
+template < class Extents >
+[[nodiscard]] constexpr typename layout_morton::mapping<Extents>::index_type layout_morton::mapping<Extents>::required_span_size() const noexcept
+{
+  // Morton codes increase with each index, so the last element has the largest offset
+  ::std::array<index_type,3> last = this->origin_;
+  for ( rank_type dim = 0; dim < Extents::rank(); ++dim )
+  {
+    if ( this->extents_.extent( dim ) == 0 )
+    {
+      return 0;
+    }
+    last[ this->axes_[dim] ] += this->extents_.extent( dim ) - 1;
+  }
+  return detail::morton_encode( last, this->source_rank_ ) + 1;
+}
+
+template < class Extents >
+template < class ... Indices >
+[[nodiscard]] constexpr typename layout_morton::mapping<Extents>::index_type layout_morton::mapping<Extents>::operator()( Indices ... indices ) const noexcept
+{
+  return detail::morton_encode( this->position( indices ... ), this->source_rank_ );
+}
+
+template < class Extents >
+template < class ... Indices >
+[[nodiscard]] constexpr ::std::array< typename layout_morton::mapping<Extents>::index_type, 3 >
+layout_morton::mapping<Extents>::position( Indices ... indices ) const noexcept
+{
+  static_assert( sizeof...(Indices) == Extents::rank(), "One index is required per dimension." );
+  ::std::array<index_type,3> pos = this->origin_;
+  rank_type                  dim = 0;
+  static_cast<void>( ( ( pos[ this->axes_[dim++] ] += static_cast<index_type>( indices ) ), ... ) );
+  return pos;
+}
+
+template < class Extents >
+template < class ... Slices >
+[[nodiscard]] constexpr auto layout_morton::mapping<Extents>::submapping( Slices ... slices ) const
+{
+  static_assert( sizeof...(Slices) == Extents::rank(), "One slice specifier is required per dimension." );
+  using sub_extents_type = decltype( ::std::experimental::submdspan_extents( this->extents_, slices ... ) );
+  using sub_mapping_type = typename layout_morton::template mapping<sub_extents_type>;
+  // The subview starts at the position of its first element and runs along the dimensions kept
+  const ::std::array<index_type,3> origin = this->position( static_cast<index_type>( ::std::experimental::detail::first_of( slices ) ) ... );
+  constexpr bool                   keeps[ sizeof...(Slices) + 1 ] = { !::std::is_convertible_v< Slices, index_type > ..., false };
+  ::std::array<rank_type,3>        axes {};
+  rank_type                        sub_dim = 0;
+  for ( rank_type dim = 0; dim < Extents::rank(); ++dim )
+  {
+    if ( keeps[dim] )
+    {
+      axes[sub_dim++] = this->axes_[dim];
+    }
+  }
+  // Offsets are computed from the position in the tensor, so the data handle is unchanged
+  return ::std::experimental::mapping_offset<sub_mapping_type> {
+    sub_mapping_type( ::std::experimental::submdspan_extents( this->extents_, slices ... ), origin, axes, this->source_rank_ ),
+    ::std::size_t( 0 ) };
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_MORTON_LAYOUT_HPP
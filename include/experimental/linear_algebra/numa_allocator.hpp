@@ -0,0 +1,248 @@
+//==================================================================================================
+//  File:       numa_allocator.hpp
+//
+//  Summary:    This header defines an allocator which interleaves pages across all NUMA nodes.
+//              Interleaving suits shared read-mostly tensors which are accessed by every thread,
+//              as opposed to first-touch placement which suits tensors partitioned among threads.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP
+#define LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+#if defined( __linux__ )
+#  include <fstream>
+#  include <string>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+// Define if pages may be interleaved across NUMA nodes.
+#ifndef LINALG_NUMA_INTERLEAVE
+#  if defined( __linux__ ) && defined( SYS_mbind )
+#    define LINALG_NUMA_INTERLEAVE 1
+#  else
+#    define LINALG_NUMA_INTERLEAVE 0
+#  endif
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Allocator which interleaves the pages of each allocation across all online NUMA nodes.
+///        Memory is mapped directly from the operating system. If interleaving is unsupported by
+///        the platform or rejected by the kernel, then the allocation proceeds with default placement.
+/// @tparam T element type
+template < class T >
+class numa_interleave_allocator
+{
+  public:
+    //- Types
+
+    /// @brief Type of element allocated
+    using value_type                             = T;
+    /// @brief Type used to express allocation size
+    using size_type                              = ::std::size_t;
+    /// @brief Type used to express pointer differences
+    using difference_type                        = ::std::ptrdiff_t;
+    /// @brief Allocator is stateless and therefore always propagates on move
+    using propagate_on_container_move_assignment = ::std::true_type;
+    /// @brief All instances of the allocator are equal
+    using is_always_equal                        = ::std::true_type;
+    /// @brief Rebinds the allocator to another element type
+    template < class U >
+    struct rebind { using other = numa_interleave_allocator<U>; };
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr numa_interleave_allocator() noexcept = default;
+    /// @brief Converting constructor
+    template < class U >
+    constexpr numa_interleave_allocator( [[maybe_unused]] const numa_interleave_allocator<U>& rhs ) noexcept { }
+
+    //- Allocation
+
+    /// @brief Allocates storage for n elements interleaved across the NUMA nodes
+    /// @param n number of elements
+    /// @return pointer to the allocated storage
+    [[nodiscard]] T* allocate( size_type n );
+    /// @brief Deallocates storage previously returned from allocate
+    /// @param p pointer to the storage
+    /// @param n number of elements
+    void deallocate( T* p, size_type n ) noexcept;
+    /// @brief Resizes storage previously returned from allocate, preserving its contents. Pages are
+    ///        remapped rather than copied where the platform allows.
+    /// @param p pointer to the storage
+    /// @param old_n number of elements currently allocated
+    /// @param new_n number of elements requested
+    /// @return pointer to the resized storage
+    [[nodiscard]] T* reallocate( T* p, size_type old_n, size_type new_n );
+
+    //- Properties
+
+    /// @brief Returns the number of online NUMA nodes pages are interleaved across
+    /// @return number of NUMA nodes; one if NUMA is unsupported
+    [[nodiscard]] static size_type node_count() noexcept;
+
+  private:
+    /// @brief Bit mask of online NUMA nodes
+    [[nodiscard]] static const ::std::array<unsigned long,16>& node_mask() noexcept;
+};
+
+/// @brief All NUMA interleave allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator == ( const numa_interleave_allocator<T>&, const numa_interleave_allocator<U>& ) noexcept { return true; }
+/// @brief All NUMA interleave allocators compare equal
+template < class T, class U >
+[[nodiscard]] constexpr bool operator != ( const numa_interleave_allocator<T>&, const numa_interleave_allocator<U>& ) noexcept { return false; }
+
+//------------------------------------------
+// Implementation of numa_interleave_allocator<T>
+//------------------------------------------
+
+template < class T >
+[[nodiscard]] T* numa_interleave_allocator<T>::allocate( size_type n )
+{
+  if ( n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_array_new_length();
+  }
+  if ( n == 0 )
+  {
+    return nullptr;
+  }
+  #if LINALG_NUMA_INTERLEAVE
+  const size_type bytes = n * sizeof(T);
+  void* p = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+  if ( p == MAP_FAILED ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_alloc();
+  }
+  // Interleave policy must be set before the pages are first touched. Failure leaves default placement.
+  constexpr int mpol_interleave = 3;
+  const auto&   mask            = node_mask();
+  static_cast<void>( ::syscall( SYS_mbind, p, bytes, mpol_interleave, mask.data(), mask.size() * sizeof(unsigned long) * 8, 0 ) );
+  return static_cast<T*>( p );
+  #else
+  return static_cast<T*>( ::operator new( n * sizeof(T), ::std::align_val_t( alignof(T) ) ) );
+  #endif
+}
+
+template < class T >
+void numa_interleave_allocator<T>::deallocate( T* p, [[maybe_unused]] size_type n ) noexcept
+{
+  if ( p == nullptr )
+  {
+    return;
+  }
+  #if LINALG_NUMA_INTERLEAVE
+  static_cast<void>( ::munmap( p, n * sizeof(T) ) );
+  #else
+  ::operator delete( p, ::std::align_val_t( alignof(T) ) );
+  #endif
+}
+
+template < class T >
+[[nodiscard]] T* numa_interleave_allocator<T>::reallocate( T* p, size_type old_n, size_type new_n )
+{
+  if ( ( p == nullptr ) || ( old_n == 0 ) || ( new_n == 0 ) )
+  {
+    T* q = this->allocate( new_n );
+    this->deallocate( p, old_n );
+    return q;
+  }
+  if ( new_n > ::std::numeric_limits<size_type>::max() / sizeof(T) ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_array_new_length();
+  }
+  #if LINALG_NUMA_INTERLEAVE && defined( MREMAP_MAYMOVE )
+  // The interleave policy of the mapping carries over to the remapped pages
+  void* q = ::mremap( p, old_n * sizeof(T), new_n * sizeof(T), MREMAP_MAYMOVE );
+  if ( q == MAP_FAILED ) LINALG_UNLIKELY
+  {
+    throw ::std::bad_alloc();
+  }
+  return static_cast<T*>( q );
+  #else
+  T* q = this->allocate( new_n );
+  ::std::memcpy( q, p, ::std::min( old_n, new_n ) * sizeof(T) );
+  this->deallocate( p, old_n );
+  return q;
+  #endif
+}
+
+template < class T >
+[[nodiscard]] typename numa_interleave_allocator<T>::size_type numa_interleave_allocator<T>::node_count() noexcept
+{
+  size_type count = 0;
+  for ( unsigned long word : node_mask() )
+  {
+    for ( ; word != 0; word &= ( word - 1 ) )
+    {
+      ++count;
+    }
+  }
+  return ::std::max< size_type >( count, 1 );
+}
+
+template < class T >
+[[nodiscard]] const ::std::array<unsigned long,16>& numa_interleave_allocator<T>::node_mask() noexcept
+{
+  static const ::std::array<unsigned long,16> mask = []() noexcept
+  {
+    ::std::array<unsigned long,16> nodes {};
+    constexpr size_type bits = sizeof(unsigned long) * 8;
+    #if LINALG_NUMA_INTERLEAVE
+    // Parse the list of online nodes (e.g. "0-1,4")
+    try
+    {
+      ::std::ifstream file( "/sys/devices/system/node/online" );
+      ::std::string   ranges;
+      if ( file >> ranges )
+      {
+        size_type position = 0;
+        while ( position < ranges.size() )
+        {
+          size_type next  = 0;
+          size_type first = ::std::stoul( ranges.substr( position ), &next );
+          size_type last  = first;
+          position += next;
+          if ( ( position < ranges.size() ) && ( ranges[position] == '-' ) )
+          {
+            last = ::std::stoul( ranges.substr( position + 1 ), &next );
+            position += next + 1;
+          }
+          for ( size_type node = first; ( node <= last ) && ( node < nodes.size() * bits ); ++node )
+          {
+            nodes[ node / bits ] |= ( 1UL << ( node % bits ) );
+          }
+          // Skip separator
+          ++position;
+        }
+      }
+    }
+    catch ( ... )
+    {
+    }
+    #endif
+    // Assume a single node if the node list is unavailable
+    if ( ::std::all_of( nodes.begin(), nodes.end(), []( unsigned long word ) { return word == 0; } ) )
+    {
+      nodes[0] = 1UL;
+    }
+    return nodes;
+  }();
+  return mask;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_NUMA_ALLOCATOR_HPP
@@ -0,0 +1,171 @@
+//==================================================================================================
+//  File:       packed_layout.hpp
+//
+//  Summary:    This header defines the BLAS packed layout policy for square matrices. Only one
+//              triangle, including the diagonal, is stored, so an n by n matrix occupies n(n+1)/2
+//              elements. Indices in the other triangle map to the element mirrored across the
+//              diagonal, which is how symmetric and Hermitian matrices recover their full extent.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_PACKED_LAYOUT_HPP
+#define LINEAR_ALGEBRA_PACKED_LAYOUT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Layout policy storing one triangle of a square matrix contiguously.
+///        The stored triangle is laid out row by row (row_major_t) or column by column
+///        (column_major_t). Indices outside the stored triangle map to the offset of the element
+///        mirrored across the diagonal, so the mapping is not unique for matrices larger than 1x1.
+/// @tparam Triangle     upper_triangle_t or lower_triangle_t
+/// @tparam StorageOrder row_major_t or column_major_t
+template < class Triangle, class StorageOrder >
+struct layout_blas_packed
+{
+  static_assert( ::std::is_same_v< Triangle, upper_triangle_t > || ::std::is_same_v< Triangle, lower_triangle_t >,
+                 "The stored triangle must be upper_triangle_t or lower_triangle_t." );
+  static_assert( ::std::is_same_v< StorageOrder, row_major_t > || ::std::is_same_v< StorageOrder, column_major_t >,
+                 "The storage order must be row_major_t or column_major_t." );
+
+  /// @brief Triangle which is stored
+  using triangle_type      = Triangle;
+  /// @brief Order in which the stored triangle is laid out
+  using storage_order_type = StorageOrder;
+
+  /// @brief Maps indices of a packed square matrix to offsets
+  /// @tparam Extents extents of the matrix
+  template < class Extents >
+  class mapping
+  {
+    static_assert( Extents::rank() == 2, "Packed layouts describe matrices." );
+
+    public:
+      //- Types
+
+      /// @brief Type used to express the extents of the matrix
+      using extents_type = Extents;
+      /// @brief Type used for indices and offsets
+      using index_type   = typename extents_type::index_type;
+      /// @brief Type used for sizes
+      using size_type    = typename extents_type::size_type;
+      /// @brief Type used for ranks
+      using rank_type    = typename extents_type::rank_type;
+      /// @brief Layout policy of the mapping
+      using layout_type  = layout_blas_packed;
+
+      //- Constructors
+
+      /// @brief Default constructor
+      constexpr mapping() noexcept = default;
+      /// @brief Constructs the mapping of a matrix of the given extents, which must be square
+      /// @param extents extents of the matrix
+      constexpr mapping( const extents_type& extents ) noexcept : extents_( extents ) { }
+      /// @brief Converting constructor from a mapping with compatible extents
+      template < class OtherExtents, typename = ::std::enable_if_t< ::std::is_constructible_v< extents_type, OtherExtents > > >
+      constexpr mapping( const mapping<OtherExtents>& rhs ) noexcept : extents_( rhs.extents() ) { }
+
+      //- Observers
+
+      /// @brief Returns the extents of the matrix
+      [[nodiscard]] constexpr const extents_type& extents() const noexcept { return this->extents_; }
+      /// @brief Returns the number of stored elements, n(n+1)/2
+      [[nodiscard]] constexpr index_type required_span_size() const noexcept;
+
+      //- Mapping
+
+      /// @brief Returns the offset of the element at (i, j), or of (j, i) if (i, j) is not stored
+      template < class I, class J >
+      [[nodiscard]] constexpr index_type operator()( I i, J j ) const noexcept;
+
+      //- Properties
+
+      [[nodiscard]] static constexpr bool is_always_unique() noexcept     { return false; }
+      [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept { return true; }
+      [[nodiscard]] static constexpr bool is_always_strided() noexcept    { return false; }
+      [[nodiscard]] constexpr bool        is_unique() const noexcept      { return this->extents_.extent(0) < 2; }
+      [[nodiscard]] static constexpr bool is_exhaustive() noexcept        { return true; }
+      [[nodiscard]] constexpr bool        is_strided() const noexcept     { return this->extents_.extent(0) < 2; }
+
+      /// @brief Mappings are equal if their extents are equal
+      [[nodiscard]] friend constexpr bool operator == ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return lhs.extents() == rhs.extents();
+      }
+      [[nodiscard]] friend constexpr bool operator != ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return !( lhs == rhs );
+      }
+
+    private:
+      //- Data
+
+      /// @brief Extents of the matrix
+      extents_type extents_ {};
+  };
+};
+
+//----------------------------------------------
+// Implementation of layout_blas_packed<Triangle,StorageOrder>::mapping<Extents>
+//----------------------------------------------
+
+template < class Triangle, class StorageOrder >
+template < class Extents >
+[[nodiscard]] constexpr typename layout_blas_packed<Triangle,StorageOrder>::template mapping<Extents>::index_type
+layout_blas_packed<Triangle,StorageOrder>::mapping<Extents>::required_span_size() const noexcept
+{
+  const index_type n = static_cast<index_type>( this->extents_.extent(0) );
+  return n * ( n + 1 ) / 2;
+}
+
+template < class Triangle, class StorageOrder >
+template < class Extents >
+template < class I, class J >
+[[nodiscard]] constexpr typename layout_blas_packed<Triangle,StorageOrder>::template mapping<Extents>::index_type
+layout_blas_packed<Triangle,StorageOrder>::mapping<Extents>::operator()( I i, J j ) const noexcept
+{
+  const index_type n   = static_cast<index_type>( this->extents_.extent(0) );
+  index_type       row = static_cast<index_type>( i );
+  index_type       col = static_cast<index_type>( j );
+  // Mirror indices outside the stored triangle across the diagonal
+  if ( ::std::is_same_v< Triangle, upper_triangle_t > ? ( row > col ) : ( row < col ) )
+  {
+    ::std::swap( row, col );
+  }
+  if constexpr ( ::std::is_same_v< Triangle, upper_triangle_t > )
+  {
+    if constexpr ( ::std::is_same_v< StorageOrder, row_major_t > )
+    {
+      // Row r holds columns r through n - 1, preceded by rows of n, n - 1, ..., n - r + 1 elements
+      return row * ( 2 * n - row + 1 ) / 2 + ( col - row );
+    }
+    else
+    {
+      // Column c holds rows 0 through c
+      return col * ( col + 1 ) / 2 + row;
+    }
+  }
+  else
+  {
+    if constexpr ( ::std::is_same_v< StorageOrder, row_major_t > )
+    {
+      // Row r holds columns 0 through r
+      return row * ( row + 1 ) / 2 + col;
+    }
+    else
+    {
+      // Column c holds rows c through n - 1, preceded by columns of n, n - 1, ..., n - c + 1 elements
+      return col * ( 2 * n - col + 1 ) / 2 + ( row - col );
+    }
+  }
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_PACKED_LAYOUT_HPP
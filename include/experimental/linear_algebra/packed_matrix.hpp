@@ -0,0 +1,797 @@
+//==================================================================================================
+//  File:       packed_matrix.hpp
+//
+//  Summary:    This header defines packed symmetric, Hermitian, and triangular matrices. Each stores
+//              one triangle of a square matrix in n(n+1)/2 elements through layout_blas_packed, and
+//              recovers the other triangle by mirroring, conjugate mirroring, or as zeros. Products
+//              and solves visit only the stored triangle, reading each stored element once.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_PACKED_MATRIX_HPP
+#define LINEAR_ALGEBRA_PACKED_MATRIX_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Conjugate returns the complex conjugate of complex values and real values unchanged
+//==================================================================================================
+template < class T >
+[[nodiscard]] constexpr T conjugate( const T& t ) noexcept
+{
+  if constexpr ( is_complex_v<T> )
+  {
+    return ::std::conj( t );
+  }
+  else
+  {
+    return t;
+  }
+}
+
+//==================================================================================================
+//  Is Packed Matrix returns true if the type is a packed matrix
+//==================================================================================================
+template < class M >
+struct is_packed_matrix : public ::std::false_type { };
+template < class T, class Structure, class Triangle, class Alloc >
+struct is_packed_matrix< packed_matrix<T,Structure,Triangle,Alloc> > : public ::std::true_type { };
+template < class M >
+inline constexpr bool is_packed_matrix_v = is_packed_matrix<M>::value;
+
+//==================================================================================================
+//  For Each Stored applies the lambda expression lambda( i, j, value ) to the stored triangle of a
+//  packed matrix, in storage order
+//==================================================================================================
+template < class M, class Lambda >
+constexpr void for_each_stored( const M& m, Lambda&& lambda )
+{
+  const auto*         data = m.underlying_span().data_handle();
+  const ::std::size_t n    = m.rows();
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    if constexpr ( ::std::is_same_v< typename M::triangle_type, upper_triangle_t > )
+    {
+      for ( ::std::size_t j = i; j < n; ++j )
+      {
+        lambda( i, j, *data++ );
+      }
+    }
+    else
+    {
+      for ( ::std::size_t j = 0; j <= i; ++j )
+      {
+        lambda( i, j, *data++ );
+      }
+    }
+  }
+}
+
+//==================================================================================================
+//  Packed solves overwrite the n by width right hand side, accessed through at( i, l ), with the
+//  solution. Stored rows are contiguous, so each row of the triangle is read once, in order.
+//==================================================================================================
+
+// Solves L X = B where L is lower triangular, packed by rows
+template < class T, class At >
+constexpr void packed_lower_solve( const T* data, ::std::size_t n, ::std::size_t width, At&& at )
+{
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    const T* row = data + i * ( i + 1 ) / 2;
+    if ( row[i] == T {} )
+    {
+      throw domain_error( "Matrix is singular." );
+    }
+    for ( ::std::size_t j = 0; j < i; ++j )
+    {
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        at( i, l ) -= row[j] * at( j, l );
+      }
+    }
+    for ( ::std::size_t l = 0; l < width; ++l )
+    {
+      at( i, l ) /= row[i];
+    }
+  }
+}
+
+// Solves U X = B where U is upper triangular, packed by rows
+template < class T, class At >
+constexpr void packed_upper_solve( const T* data, ::std::size_t n, ::std::size_t width, At&& at )
+{
+  for ( ::std::size_t i = n; i-- > 0; )
+  {
+    // Row i holds columns i through n - 1
+    const T* row = data + i * ( 2 * n - i + 1 ) / 2;
+    if ( row[0] == T {} )
+    {
+      throw domain_error( "Matrix is singular." );
+    }
+    for ( ::std::size_t j = i + 1; j < n; ++j )
+    {
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        at( i, l ) -= row[j-i] * at( j, l );
+      }
+    }
+    for ( ::std::size_t l = 0; l < width; ++l )
+    {
+      at( i, l ) /= row[0];
+    }
+  }
+}
+
+// Solves L^H X = B where L is lower triangular, packed by rows. Rows of L are columns of L^H, so
+// each solved row of X is eliminated from the rows above it.
+template < class T, class At >
+constexpr void packed_lower_adjoint_solve( const T* data, ::std::size_t n, ::std::size_t width, At&& at )
+{
+  for ( ::std::size_t i = n; i-- > 0; )
+  {
+    const T* row = data + i * ( i + 1 ) / 2;
+    if ( row[i] == T {} )
+    {
+      throw domain_error( "Matrix is singular." );
+    }
+    const T diagonal = conjugate( row[i] );
+    for ( ::std::size_t l = 0; l < width; ++l )
+    {
+      at( i, l ) /= diagonal;
+    }
+    for ( ::std::size_t j = 0; j < i; ++j )
+    {
+      const T value = conjugate( row[j] );
+      for ( ::std::size_t l = 0; l < width; ++l )
+      {
+        at( j, l ) -= value * at( i, l );
+      }
+    }
+  }
+}
+
+}       //- detail namespace
+
+/// @brief Square matrix storing one triangle, including the diagonal, in n(n+1)/2 elements.
+///        Symmetric matrices mirror the stored triangle, Hermitian matrices mirror its complex
+///        conjugate, and triangular matrices are zero outside of it. The stored triangle is laid
+///        out row by row, as described by layout_blas_packed<Triangle,row_major_t>.
+//         Implementation satisfies the following concepts:
+//         concepts::matrix_data
+//         Element access returns values; stored elements are written through underlying_span().
+//         Row, column, and submatrix views are not provided as the packed mapping is not unique.
+/// @tparam T         element_type
+/// @tparam Structure symmetric_t, hermitian_t, or triangular_t
+/// @tparam Triangle  upper_triangle_t or lower_triangle_t
+/// @tparam Alloc     allocator_type
+template < class T,
+           class Structure,
+           class Triangle,
+           class Alloc >
+class packed_matrix
+{
+  static_assert( ::std::is_same_v< Structure, symmetric_t > || ::std::is_same_v< Structure, hermitian_t > || ::std::is_same_v< Structure, triangular_t >,
+                 "The structure must be symmetric_t, hermitian_t, or triangular_t." );
+
+  public:
+    //- Types
+
+    /// @brief Structure recovering the triangle which is not stored
+    using structure_type             = Structure;
+    /// @brief Triangle which is stored
+    using triangle_type              = Triangle;
+    /// @brief Type used to define memory layout
+    using layout_type                = layout_blas_packed< Triangle, row_major_t >;
+    /// @brief Type of elements
+    using element_type               = T;
+    /// @brief Type returned by const index access
+    using value_type                 = ::std::remove_cv_t<element_type>;
+    /// @brief Type of allocator used to get memory
+    using allocator_type             = Alloc;
+    /// @brief Type used for indexing
+    using index_type                 = ::std::ptrdiff_t;
+    /// @brief Type used for size along any dimension
+    using size_type                  = ::std::size_t;
+    /// @brief Type used to express size of matrix
+    using extents_type               = ::std::experimental::extents<size_type,dynamic_extent,dynamic_extent>;
+    /// @brief Type used to represent a node in the matrix
+    using tuple_type                 = ::std::tuple<index_type,index_type>;
+    /// @brief Type used to view the stored triangle; indices outside it alias the mirrored element
+    using underlying_span_type       = ::std::experimental::mdspan<element_type,extents_type,layout_type>;
+    /// @brief Type used to const view the stored triangle; indices outside it alias the mirrored element
+    using const_underlying_span_type = ::std::experimental::mdspan<const element_type,extents_type,layout_type>;
+    /// @brief Type of a reference to a stored element
+    using reference                  = element_type&;
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Default destructor
+    ~packed_matrix()                              = default;
+    /// @brief Default constructor
+    packed_matrix()                               = default;
+    /// @brief Default move constructor
+    packed_matrix( packed_matrix&& )              = default;
+    /// @brief Default copy constructor
+    packed_matrix( const packed_matrix& )         = default;
+    /// @brief Constructs a zero matrix of the specified size
+    /// @param s number of rows and columns
+    /// @throws length_error if s is not square
+    explicit packed_matrix( extents_type s );
+    /// @brief Constructs a zero matrix of the specified size
+    /// @param s     number of rows and columns
+    /// @param alloc allocator used to construct with
+    /// @throws length_error if s is not square
+    packed_matrix( extents_type s, const allocator_type& alloc );
+    /// @brief Constructs by applying lambda to every element of the stored triangle
+    /// @tparam Lambda lambda expression with an operator()( index1, index2 ) defined
+    /// @param s      number of rows and columns
+    /// @param lambda lambda expression to be performed on each stored element
+    /// @throws length_error if s is not square
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    packed_matrix( extents_type s, Lambda&& lambda )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs by applying lambda to every element of the stored triangle
+    /// @tparam Lambda lambda expression with an operator()( index1, index2 ) defined
+    /// @param s      number of rows and columns
+    /// @param lambda lambda expression to be performed on each stored element
+    /// @param alloc  allocator used to construct with
+    /// @throws length_error if s is not square
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Lambda >
+    #else
+    template < class Lambda,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< decltype( ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) ), element_type > > >
+    #endif
+    packed_matrix( extents_type s, Lambda&& lambda, const allocator_type& alloc )
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires requires { { ::std::declval<Lambda&&>()( ::std::declval<index_type>(), ::std::declval<index_type>() ) } -> ::std::convertible_to<element_type>; };
+    #else
+      ;
+    #endif
+    /// @brief Constructs from the stored triangle of a dense matrix; the other triangle is not read
+    /// @tparam M dense matrix type
+    /// @param m square matrix to be packed
+    /// @throws length_error if m is not square
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class M >
+      requires detail::is_dense_matrix_v<M> && ( !detail::is_packed_matrix_v<M> )
+    #else
+    template < class M, typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> && !detail::is_packed_matrix_v<M> > >
+    #endif
+    explicit packed_matrix( const M& m );
+    /// @brief Default move assignment
+    packed_matrix& operator = ( packed_matrix&& )      = default;
+    /// @brief Default copy assignment
+    packed_matrix& operator = ( const packed_matrix& ) = default;
+
+    //- Size / Capacity
+
+    /// @brief Returns the current number of (rows, columns)
+    [[nodiscard]] constexpr extents_type size() const noexcept;
+    /// @brief Returns the current capacity of (rows, columns), which is always the size
+    [[nodiscard]] constexpr extents_type capacity() const noexcept;
+    /// @brief Returns the current number of columns
+    [[nodiscard]] constexpr size_type columns() const noexcept;
+    /// @brief Returns the current number of rows
+    [[nodiscard]] constexpr size_type rows() const noexcept;
+    /// @brief Returns the current column capacity
+    [[nodiscard]] constexpr size_type column_capacity() const noexcept;
+    /// @brief Returns the current row capacity
+    [[nodiscard]] constexpr size_type row_capacity() const noexcept;
+
+    //- Const views
+
+    /// @brief Returns the value at (i, j) without index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j
+    #if LINALG_USE_BRACKET_OPERATOR
+    [[nodiscard]] value_type operator[]( index_type i, index_type j ) const noexcept;
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    [[nodiscard]] value_type operator()( index_type i, index_type j ) const noexcept;
+    #endif
+    /// @brief Returns the value at (i, j) with index bounds checking
+    /// @param i row index
+    /// @param j column index
+    /// @returns value at row i, column j
+    /// @throws out_of_range if (i, j) is outside the matrix
+    [[nodiscard]] value_type at( index_type i, index_type j ) const;
+    /// @brief Returns a const view of the stored triangle
+    [[nodiscard]] const_underlying_span_type underlying_span() const noexcept;
+
+    //- Mutable views
+
+    /// @brief Returns a mutable view of the stored triangle
+    [[nodiscard]] underlying_span_type underlying_span() noexcept;
+
+    //- Allocator
+
+    /// @brief Returns a copy of the allocator used to get memory
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+  private:
+    //- Private functions
+
+    // Returns the value at (i, j) recovered from the stored triangle
+    [[nodiscard]] value_type element( index_type i, index_type j ) const noexcept;
+
+    //- Data
+
+    // Number of rows and columns
+    extents_type                            size_;
+    // Stored triangle
+    ::std::vector<element_type,allocator_type> elems_;
+};
+
+//==================================================================================================
+//                                  I M P L E M E N T A T I O N
+//==================================================================================================
+
+//- Destructor / Constructors / Assignments
+
+template < class T, class Structure, class Triangle, class Alloc >
+packed_matrix<T,Structure,Triangle,Alloc>::packed_matrix( extents_type s ) :
+  packed_matrix( s, allocator_type() )
+{
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+packed_matrix<T,Structure,Triangle,Alloc>::packed_matrix( extents_type s, const allocator_type& alloc ) :
+  size_( s ),
+  elems_( alloc )
+{
+  if ( s.extent(0) != s.extent(1) )
+  {
+    throw length_error( "Packed matrices must be square." );
+  }
+  this->elems_.assign( s.extent(0) * ( s.extent(0) + 1 ) / 2, value_type {} );
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+packed_matrix<T,Structure,Triangle,Alloc>::packed_matrix( extents_type s, Lambda&& lambda )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename packed_matrix<T,Structure,Triangle,Alloc>::index_type>(),
+                                                    ::std::declval<typename packed_matrix<T,Structure,Triangle,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename packed_matrix<T,Structure,Triangle,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  packed_matrix( s, ::std::forward<Lambda>( lambda ), allocator_type() )
+{
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Lambda >
+#else
+template < class Lambda, typename >
+#endif
+packed_matrix<T,Structure,Triangle,Alloc>::packed_matrix( extents_type s, Lambda&& lambda, const allocator_type& alloc )
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires requires { { ::std::declval<Lambda&&>()( ::std::declval<typename packed_matrix<T,Structure,Triangle,Alloc>::index_type>(),
+                                                    ::std::declval<typename packed_matrix<T,Structure,Triangle,Alloc>::index_type>() ) }
+                        -> ::std::convertible_to<typename packed_matrix<T,Structure,Triangle,Alloc>::element_type>; } :
+#else
+  :
+#endif
+  packed_matrix( s, alloc )
+{
+  element_type* data = this->elems_.data();
+  detail::for_each_stored( *this, [&lambda,&data]( size_type i, size_type j, const element_type& )
+  {
+    *data++ = lambda( static_cast<index_type>( i ), static_cast<index_type>( j ) );
+  } );
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires detail::is_dense_matrix_v<M> && ( !detail::is_packed_matrix_v<M> )
+#else
+template < class M, typename >
+#endif
+packed_matrix<T,Structure,Triangle,Alloc>::packed_matrix( const M& m ) :
+  packed_matrix( extents_type( m.rows(), m.columns() ), [&m]( index_type i, index_type j ) { return static_cast<element_type>( detail::access( m, i, j ) ); } )
+{
+}
+
+//- Size / Capacity
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::extents_type
+packed_matrix<T,Structure,Triangle,Alloc>::size() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::extents_type
+packed_matrix<T,Structure,Triangle,Alloc>::capacity() const noexcept
+{
+  return this->size_;
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::size_type
+packed_matrix<T,Structure,Triangle,Alloc>::columns() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::size_type
+packed_matrix<T,Structure,Triangle,Alloc>::rows() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::size_type
+packed_matrix<T,Structure,Triangle,Alloc>::column_capacity() const noexcept
+{
+  return this->size_.extent(1);
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] constexpr typename packed_matrix<T,Structure,Triangle,Alloc>::size_type
+packed_matrix<T,Structure,Triangle,Alloc>::row_capacity() const noexcept
+{
+  return this->size_.extent(0);
+}
+
+//- Const views
+
+#if LINALG_USE_BRACKET_OPERATOR
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::value_type
+packed_matrix<T,Structure,Triangle,Alloc>::operator[]( index_type i, index_type j ) const noexcept
+{
+  return this->element( i, j );
+}
+#endif
+
+#if LINALG_USE_PAREN_OPERATOR
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::value_type
+packed_matrix<T,Structure,Triangle,Alloc>::operator()( index_type i, index_type j ) const noexcept
+{
+  return this->element( i, j );
+}
+#endif
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::value_type
+packed_matrix<T,Structure,Triangle,Alloc>::at( index_type i, index_type j ) const
+{
+  // Negative indices convert to sizes beyond any extent
+  if ( ( static_cast<size_type>( i ) >= this->rows() ) || ( static_cast<size_type>( j ) >= this->columns() ) )
+  {
+    throw out_of_range( "Index is outside of the matrix." );
+  }
+  return this->element( i, j );
+}
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::const_underlying_span_type
+packed_matrix<T,Structure,Triangle,Alloc>::underlying_span() const noexcept
+{
+  return const_underlying_span_type( this->elems_.data(), this->size_ );
+}
+
+//- Mutable views
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::underlying_span_type
+packed_matrix<T,Structure,Triangle,Alloc>::underlying_span() noexcept
+{
+  return underlying_span_type( this->elems_.data(), this->size_ );
+}
+
+//- Allocator
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::allocator_type
+packed_matrix<T,Structure,Triangle,Alloc>::get_allocator() const noexcept
+{
+  return this->elems_.get_allocator();
+}
+
+//- Private functions
+
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] typename packed_matrix<T,Structure,Triangle,Alloc>::value_type
+packed_matrix<T,Structure,Triangle,Alloc>::element( index_type i, index_type j ) const noexcept
+{
+  const bool       is_stored = ::std::is_same_v< Triangle, upper_triangle_t > ? ( i <= j ) : ( i >= j );
+  const value_type value     = this->elems_[ static_cast<size_type>( typename layout_type::template mapping<extents_type>( this->size_ )( i, j ) ) ];
+  if constexpr ( ::std::is_same_v< Structure, symmetric_t > )
+  {
+    return value;
+  }
+  else if constexpr ( ::std::is_same_v< Structure, hermitian_t > )
+  {
+    return is_stored ? value : detail::conjugate( value );
+  }
+  else
+  {
+    return is_stored ? value : value_type {};
+  }
+}
+
+//==================================================================================================
+//  Packed matrix arithmetic
+//==================================================================================================
+
+/// @brief Returns the product m x, reading each stored element of m once
+/// @throws length_error if the sizes of m and x are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Triangle, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Structure, class Triangle, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto
+operator * ( const packed_matrix<T,Structure,Triangle,Alloc>& m, const V& x )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename V::value_type>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( x.size().extent(0) != m.columns() )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  result_type y( typename result_type::extents_type( m.rows() ), []( auto ) { return result_value_type {}; },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  detail::for_each_stored( m, [&x,&y]( ::std::size_t i, ::std::size_t j, const T& value )
+  {
+    detail::access( y, i ) += value * detail::access( x, j );
+    if constexpr ( !::std::is_same_v< Structure, triangular_t > )
+    {
+      if ( i != j )
+      {
+        detail::access( y, j ) += ( ::std::is_same_v< Structure, hermitian_t > ? detail::conjugate( value ) : value ) * detail::access( x, i );
+      }
+    }
+  } );
+  return y;
+}
+
+/// @brief Returns the product m b of a packed and a dense matrix, reading each stored element of m once
+/// @throws length_error if the sizes of m and b are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Triangle, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Triangle, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto
+operator * ( const packed_matrix<T,Structure,Triangle,Alloc>& m, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<T>() * ::std::declval<typename M::value_type>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.rows() != m.columns() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  const ::std::size_t width = b.columns();
+  result_type c( typename result_type::extents_type( m.rows(), width ), []( auto, auto ) { return result_value_type {}; },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  // Each stored element scales a row of b into a row of c, and its mirror scales another
+  detail::for_each_stored( m, [&b,&c,width]( ::std::size_t i, ::std::size_t j, const T& value )
+  {
+    for ( ::std::size_t l = 0; l < width; ++l )
+    {
+      detail::access( c, i, l ) += value * detail::access( b, j, l );
+    }
+    if constexpr ( !::std::is_same_v< Structure, triangular_t > )
+    {
+      if ( i != j )
+      {
+        const T mirror = ::std::is_same_v< Structure, hermitian_t > ? detail::conjugate( value ) : value;
+        for ( ::std::size_t l = 0; l < width; ++l )
+        {
+          detail::access( c, j, l ) += mirror * detail::access( b, i, l );
+        }
+      }
+    }
+  } );
+  return c;
+}
+
+/// @brief Returns the product a m of a dense and a packed matrix, reading each stored element of m once
+/// @throws length_error if the sizes of a and m are incompatible
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class T, class Structure, class Triangle, class Alloc >
+  requires detail::is_dense_matrix_v<M> && ( !detail::is_packed_matrix_v<M> )
+#else
+template < class M, class T, class Structure, class Triangle, class Alloc,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> && !detail::is_packed_matrix_v<M> > >
+#endif
+[[nodiscard]] inline auto
+operator * ( const M& a, const packed_matrix<T,Structure,Triangle,Alloc>& m )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() * ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( a.columns() != m.rows() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  const ::std::size_t height = a.rows();
+  result_type c( typename result_type::extents_type( height, m.columns() ), []( auto, auto ) { return result_value_type {}; },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  // Each stored element scales a column of a into a column of c, and its mirror scales another
+  detail::for_each_stored( m, [&a,&c,height]( ::std::size_t i, ::std::size_t j, const T& value )
+  {
+    for ( ::std::size_t r = 0; r < height; ++r )
+    {
+      detail::access( c, r, j ) += detail::access( a, r, i ) * value;
+    }
+    if constexpr ( !::std::is_same_v< Structure, triangular_t > )
+    {
+      if ( i != j )
+      {
+        const T mirror = ::std::is_same_v< Structure, hermitian_t > ? detail::conjugate( value ) : value;
+        for ( ::std::size_t r = 0; r < height; ++r )
+        {
+          detail::access( c, r, i ) += detail::access( a, r, j ) * mirror;
+        }
+      }
+    }
+  } );
+  return c;
+}
+
+/// @brief Returns the Cholesky factor L of a symmetric or Hermitian positive definite matrix,
+///        such that m = L L^H. Only the stored triangle of m is read.
+/// @throws domain_error if m is not positive definite
+template < class T, class Structure, class Triangle, class Alloc >
+[[nodiscard]] inline tri_matrix<T,lower_triangle_t,Alloc> cholesky( const packed_matrix<T,Structure,Triangle,Alloc>& m )
+{
+  static_assert( ::std::is_same_v< Structure, hermitian_t > || ( ::std::is_same_v< Structure, symmetric_t > && !detail::is_complex_v<T> ),
+                 "Cholesky factorization requires a real symmetric or a Hermitian matrix." );
+  using index_type = typename packed_matrix<T,Structure,Triangle,Alloc>::index_type;
+  const ::std::size_t                    n = m.rows();
+  tri_matrix<T,lower_triangle_t,Alloc> l( m.size(), m.get_allocator() );
+  T* data = l.underlying_span().data_handle();
+  // Rows of the lower factor are contiguous, so each inner product runs along two stored rows
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    T* row_i = data + i * ( i + 1 ) / 2;
+    for ( ::std::size_t j = 0; j <= i; ++j )
+    {
+      const T* row_j = data + j * ( j + 1 ) / 2;
+      T        sum   = detail::access( m, static_cast<index_type>( i ), static_cast<index_type>( j ) );
+      for ( ::std::size_t k = 0; k < j; ++k )
+      {
+        sum -= row_i[k] * detail::conjugate( row_j[k] );
+      }
+      if ( i == j )
+      {
+        const auto diagonal = ::std::real( sum );
+        if ( !( diagonal > 0 ) )
+        {
+          throw domain_error( "Matrix is not positive definite." );
+        }
+        row_i[i] = T( ::std::sqrt( diagonal ) );
+      }
+      else
+      {
+        row_i[j] = sum / row_j[j];
+      }
+    }
+  }
+  return l;
+}
+
+/// @brief Returns x solving m x = b. Triangular matrices are solved by substitution; symmetric and
+///        Hermitian matrices are solved through their Cholesky factor and must be positive definite.
+/// @throws length_error if the sizes of m and b are incompatible
+/// @throws domain_error if m is singular, or is not positive definite
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Triangle, class Alloc, concepts::vector_data V >
+#else
+template < class T, class Structure, class Triangle, class Alloc, class V,
+           typename = ::std::enable_if_t< concepts::vector_data_v<V> > >
+#endif
+[[nodiscard]] inline auto solve( const packed_matrix<T,Structure,Triangle,Alloc>& m, const V& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename V::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_vector< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.size().extent(0) != m.rows() )
+  {
+    throw length_error( "Matrix and vector sizes are incompatable." );
+  }
+  result_type x( typename result_type::extents_type( m.rows() ), [&b]( auto i ) { return result_value_type( detail::access( b, i ) ); },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  auto at = [&x]( ::std::size_t i, ::std::size_t ) -> result_value_type& { return detail::access( x, i ); };
+  if constexpr ( ::std::is_same_v< Structure, triangular_t > )
+  {
+    if constexpr ( ::std::is_same_v< Triangle, upper_triangle_t > )
+    {
+      detail::packed_upper_solve( m.underlying_span().data_handle(), m.rows(), 1, at );
+    }
+    else
+    {
+      detail::packed_lower_solve( m.underlying_span().data_handle(), m.rows(), 1, at );
+    }
+  }
+  else
+  {
+    const auto l = cholesky( m );
+    detail::packed_lower_solve( l.underlying_span().data_handle(), m.rows(), 1, at );
+    detail::packed_lower_adjoint_solve( l.underlying_span().data_handle(), m.rows(), 1, at );
+  }
+  return x;
+}
+
+/// @brief Returns x solving m x = b for every column of the dense matrix b
+/// @throws length_error if the sizes of m and b are incompatible
+/// @throws domain_error if m is singular, or is not positive definite
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class Structure, class Triangle, class Alloc, class M >
+  requires detail::is_dense_matrix_v<M>
+#else
+template < class T, class Structure, class Triangle, class Alloc, class M,
+           typename = ::std::enable_if_t< detail::is_dense_matrix_v<M> >,
+           typename = ::std::enable_if_t<true> >
+#endif
+[[nodiscard]] inline auto solve( const packed_matrix<T,Structure,Triangle,Alloc>& m, const M& b )
+{
+  using result_value_type = ::std::decay_t< decltype( ::std::declval<typename M::value_type>() / ::std::declval<T>() ) >;
+  using result_type       = dr_matrix< result_value_type, typename ::std::allocator_traits<Alloc>::template rebind_alloc<result_value_type> >;
+  if ( b.rows() != m.rows() )
+  {
+    throw length_error( "Matrix sizes are incompatable." );
+  }
+  result_type x( typename result_type::extents_type( b.rows(), b.columns() ), [&b]( auto i, auto j ) { return result_value_type( detail::access( b, i, j ) ); },
+                 typename result_type::allocator_type( m.get_allocator() ) );
+  auto at = [&x]( ::std::size_t i, ::std::size_t l ) -> result_value_type& { return detail::access( x, i, l ); };
+  if constexpr ( ::std::is_same_v< Structure, triangular_t > )
+  {
+    if constexpr ( ::std::is_same_v< Triangle, upper_triangle_t > )
+    {
+      detail::packed_upper_solve( m.underlying_span().data_handle(), m.rows(), b.columns(), at );
+    }
+    else
+    {
+      detail::packed_lower_solve( m.underlying_span().data_handle(), m.rows(), b.columns(), at );
+    }
+  }
+  else
+  {
+    const auto l = cholesky( m );
+    detail::packed_lower_solve( l.underlying_span().data_handle(), m.rows(), b.columns(), at );
+    detail::packed_lower_adjoint_solve( l.underlying_span().data_handle(), m.rows(), b.columns(), at );
+  }
+  return x;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_PACKED_MATRIX_HPP
@@ -40,7 +40,8 @@ template < class MultiDimOperClass, class ... IndexType >
 }
 
 //==================================================================================================
-// Forwards to std for_each with or without execution policy depending on configuration
+// Forwards to std for_each with or without execution policy depending on configuration.
+// The library thread pool policy is always honored regardless of configuration.
 //==================================================================================================
 template< class ExecutionPolicy, class ForwardIt, class UnaryFunction2 >
 constexpr LINALG_FORCE_INLINE_FUNCTION void
@@ -49,11 +50,25 @@ for_each( [[maybe_unused]] ExecutionPolicy&& policy,
           ForwardIt                          last,
           UnaryFunction2                     f )
 {
-  #if LINALG_EXECTUION_POLICY
-  ::std::for_each( policy, first, last, f );
-  #else
-  ::std::for_each( first, last, f );
-  #endif
+  if constexpr ( is_thread_pool_policy_v<ExecutionPolicy> )
+  {
+    if ( policy.is_static() )
+    {
+      policy.pool().parallel_for_static( first, last, f );
+    }
+    else
+    {
+      policy.pool().parallel_for( first, last, f, policy.grain_size() );
+    }
+  }
+  else
+  {
+    #if LINALG_EXECTUION_POLICY
+    ::std::for_each( policy, first, last, f );
+    #else
+    ::std::for_each( first, last, f );
+    #endif
+  }
 }
 
 //==================================================================================================
@@ -215,6 +230,85 @@ template < class T, class ... Ts >
     return t * product( ts ... );
   }
 }
+
+//==================================================================================================
+//  Unravel Index maps a linear storage index back into the indices of a static extents layout
+//==================================================================================================
+/// @brief True iff the storage order of the layout is fully determined by its static extents
+template < class Layout >
+inline constexpr bool is_unravelable_layout_v = ::std::is_same_v< Layout, ::std::experimental::layout_right > ||
+                                                ::std::is_same_v< Layout, ::std::experimental::layout_left >;
+
+/// @brief Returns the indices of the element stored at position index of a layout over extents Ds...
+template < class Layout, ::std::size_t ... Ds >
+[[nodiscard]] constexpr ::std::array< ::std::size_t, sizeof...(Ds) > unravel_index( ::std::size_t index ) noexcept
+{
+  constexpr ::std::array< ::std::size_t, sizeof...(Ds) > extents { Ds ... };
+  ::std::array< ::std::size_t, sizeof...(Ds) >           indices {};
+  if constexpr ( ::std::is_same_v< Layout, ::std::experimental::layout_left > )
+  {
+    // First index varies fastest
+    for ( ::std::size_t dim = 0; dim < sizeof...(Ds); ++dim )
+    {
+      indices[dim] = index % extents[dim];
+      index       /= extents[dim];
+    }
+  }
+  else
+  {
+    // Last index varies fastest
+    for ( ::std::size_t dim = sizeof...(Ds); dim-- > 0; )
+    {
+      indices[dim] = index % extents[dim];
+      index       /= extents[dim];
+    }
+  }
+  return indices;
+}
+
+//==================================================================================================
+//  Is Tiled Layout is true for layouts which store elements in fixed size tiles
+//==================================================================================================
+template < class Layout >
+struct is_tiled_layout : public ::std::false_type {};
+template < class Layout >
+inline constexpr bool is_tiled_layout_v = is_tiled_layout<Layout>::value;
+
+//==================================================================================================
+//  Is Recursive Layout is true for layouts whose aligned power of two blocks are contiguous, which
+//  recursive kernels exploit by splitting views at power of two boundaries
+//==================================================================================================
+template < class Layout >
+struct is_recursive_layout : public ::std::false_type {};
+template < class Layout >
+inline constexpr bool is_recursive_layout_v = is_recursive_layout<Layout>::value;
+
+//==================================================================================================
+//  Is Acceptable Span is false when a recursive layout of the given extents would span more than
+//  LINALG_RECURSIVE_SPAN_LIMIT times as many elements as it holds, and more than one base block.
+//  Other layouts are always acceptable.
+//==================================================================================================
+template < class Layout, class Extents >
+[[nodiscard]] constexpr bool is_acceptable_span( const Extents& extents ) noexcept
+{
+  if constexpr ( is_recursive_layout_v<Layout> )
+  {
+    ::std::size_t count = 1;
+    for ( ::std::size_t dim = 0; dim < Extents::rank(); ++dim )
+    {
+      count *= static_cast<::std::size_t>( extents.extent(dim) );
+    }
+    const auto span = static_cast<::std::size_t>( typename Layout::template mapping<Extents>( extents ).required_span_size() );
+    return ( span <= LINALG_RECURSIVE_SPAN_LIMIT * count ) ||
+           ( span <= LINALG_RECURSIVE_BASE_SIZE * LINALG_RECURSIVE_BASE_SIZE );
+  }
+  else
+  {
+    static_cast<void>( extents );
+    return true;
+  }
+}
+
 //==================================================================================================
 //  Faux Index Iterator allows indices to be used in std algorithms which take iterators
 //==================================================================================================
@@ -343,27 +437,48 @@ struct stride_order< ::std::experimental::mdspan< ElementType, Extents, ::std::e
   }
 };
 
-// DOESN'T WORK. ORDER MUST BE DETERMINED AT COMPILE TIME
-//
-// template < class ElementType, class Extents, class AccessorPolicy >
-// struct stride_order< ::std::experimental::mdspan< ElementType, Extents, ::std::experimental::layout_stride, AccessorPolicy > >
-// {
-//   constexpr stride_order( const ::std::experimental::layout_stride::mapping<Extents>& layout ) noexcept :
-//     order_( layout.strides() )
-//   {
-//     sort( this->order_.begin(),
-//           this->order_.end(),
-//           [layout]( auto index1, auto index2 ) { return layout.stride(index1) <= layout.stride(index2); } );
-//   }
-
-//   template < class IndexType >
-//   [[nodiscard]] constexpr auto get_nth_largest_stride_index( IndexType index ) noexcept
-//   {
-//     return this->order_[index];
-//   }
-// private :
-//   decltype( declval< ::std::experimental::layout_stride::mapping<Extents> >().strides() ) order_;
-// };
+// Stride order for mappings whose strides are only known at run time (e.g. layout_stride).
+// Dimensions are ordered from largest to smallest stride. Dimensions of extent one do not affect
+// the traversal and are placed outermost.
+template < class Mapping >
+struct runtime_stride_order
+{
+  using rank_type = ::std::size_t;
+
+  constexpr runtime_stride_order( const Mapping& mapping ) noexcept :
+    order_()
+  {
+    for ( rank_type dim = 0; dim < Mapping::extents_type::rank(); ++dim )
+    {
+      this->order_[dim] = dim;
+    }
+    // Stable insertion sort; the rank is small and std::stable_sort may allocate a temporary buffer
+    auto precedes = [&mapping]( rank_type dim1, rank_type dim2 )
+                    {
+                      const bool unit1 = ( mapping.extents().extent(dim1) == 1 );
+                      const bool unit2 = ( mapping.extents().extent(dim2) == 1 );
+                      return ( unit1 != unit2 ) ? unit1 : ( mapping.stride(dim1) > mapping.stride(dim2) );
+                    };
+    for ( rank_type i = 1; i < Mapping::extents_type::rank(); ++i )
+    {
+      const rank_type dim = this->order_[i];
+      rank_type       j   = i;
+      for ( ; ( j > 0 ) && precedes( dim, this->order_[j-1] ); --j )
+      {
+        this->order_[j] = this->order_[j-1];
+      }
+      this->order_[j] = dim;
+    }
+  }
+
+  [[nodiscard]] constexpr rank_type get_nth_largest_stride_index( rank_type index ) const noexcept
+  {
+    return this->order_[index];
+  }
+
+private :
+  ::std::array< rank_type, Mapping::extents_type::rank() > order_;
+};
 
 template < class         View,
            class         Lambda,
@@ -380,17 +495,18 @@ inline void apply_all_strided3_except( View&&                 view,
                                        tuple<IndicesType...>& indices )
 {
   constexpr IndexType index = sizeof...(BeforeIndices);
-  // Cache the last exception to be thrown
+  // Cache the last exception to be thrown (guarded since the policy may be parallel)
   ::std::exception_ptr eptr;
+  ::std::mutex         eptr_mutex;
   // Attempt lambda expression on each element
   ::std::experimental::math::detail::
   for_each( execution_policy,
             faux_index_iterator<::std::decay_t<decltype( ::std::get<index>(indices) )> >(0),
             faux_index_iterator<::std::decay_t<decltype( ::std::get<index>(indices) )> >(view.extent(index)),
-            [&lambda,&indices,&eptr] ( ::std::decay_t<decltype( ::std::get<index>(indices) )> curr_index ) noexcept
+            [&lambda,&indices,&eptr,&eptr_mutex] ( ::std::decay_t<decltype( ::std::get<index>(indices) )> curr_index ) noexcept
               {
                 try { lambda( ::std::get<BeforeIndices>(indices) ..., curr_index, ::std::get<AfterIndices+index>(indices) ... ); }
-                catch ( ... ) { eptr = ::std::current_exception(); }
+                catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); }
               } );
   // If exceptions were thrown, rethrow the last
   if ( eptr ) LINALG_UNLIKELY
@@ -483,18 +599,19 @@ inline void apply_all_strided2_except( View&&                      view,
                                        ::std::tuple<IndexType...>& indices )
 {
   constexpr ::std::size_t index_stride = stride_order< ::std::decay_t<View> >::get_nth_largest_stride_index( Index );
-  // Cache the last exception to be thrown
+  // Cache the last exception to be thrown (guarded since the policy may be parallel)
   ::std::exception_ptr eptr;
+  ::std::mutex         eptr_mutex;
   // Attempt lambda expression on each element
   ::std::experimental::math::detail::
   for_each( execution_policy,
             faux_index_iterator<::std::decay_t<decltype( ::std::get<index_stride>(indices) )> >(0),
             faux_index_iterator<::std::decay_t<decltype( ::std::get<index_stride>(indices) )> >(view.extent(index_stride)),
-            [&view,&lambda,&execution_policy,&indices,&eptr,index_stride] ( ::std::decay_t<decltype( ::std::get<index_stride>(indices) )> index ) noexcept
+            [&view,&lambda,&execution_policy,&indices,&eptr,&eptr_mutex,index_stride] ( ::std::decay_t<decltype( ::std::get<index_stride>(indices) )> index ) noexcept
               {
                 ::std::get<index_stride>(indices) = index;
                 try { apply_all_strided2<Index+1>( view, lambda, execution_policy, indices ); }
-                catch ( ... ) { eptr = ::std::current_exception(); }
+                catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); }
               } );
   // If exceptions were thrown, rethrow the last
   if ( eptr ) LINALG_UNLIKELY
@@ -585,15 +702,16 @@ inline void apply_all_impl2_except( View&&              view,
                                     ExtentType          dim,
                                     BeforeIndexType ... before_indices )
 {
-  // Cache the last exception to be thrown
+  // Cache the last exception to be thrown (guarded since the policy may be parallel)
   ::std::exception_ptr eptr;
+  ::std::mutex         eptr_mutex;
   // Attempt lambda expression on each element
   ::std::experimental::math::detail::
   for_each( execution_policy,
             faux_index_iterator<typename ::std::decay_t<View>::size_type>( 0 ),
             faux_index_iterator<typename ::std::decay_t<View>::size_type>( view.extent(dim) ),
-            [ &lambda, &before_indices..., &eptr ]( typename ::std::decay_t<View>::size_type index ) noexcept
-              { try { lambda( before_indices ..., index ); } catch ( ... ) { eptr = ::std::current_exception(); } } );
+            [ &lambda, &before_indices..., &eptr, &eptr_mutex ]( typename ::std::decay_t<View>::size_type index ) noexcept
+              { try { lambda( before_indices ..., index ); } catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); } } );
   // If exceptions were thrown, rethrow the last
   if ( eptr ) LINALG_UNLIKELY
   {
@@ -686,15 +804,16 @@ inline void apply_all_impl_except( View&&            view,
                     ::std::forward<Lambda>( lambda ),
                     ::std::forward<ExecutionPolicy>( execution_policy ),
                     ::std::integer_sequence<ExtentsType,Extents...>{}, indices ..., index ); };
-  // Cache the last exception to be thrown
+  // Cache the last exception to be thrown (guarded since the policy may be parallel)
   ::std::exception_ptr eptr;
+  ::std::mutex         eptr_mutex;
   // Attempt lambda expression
   ::std::experimental::math::detail::
   for_each( execution_policy,
             faux_index_iterator<typename ::std::decay_t<View>::size_type>( 0 ),
             faux_index_iterator<typename ::std::decay_t<View>::size_type>( view.extent(FirstExtents) ),
-            [ &for_each_lambda, &eptr ] ( typename ::std::decay_t<View>::size_type index ) noexcept
-              { try { for_each_lambda(index); } catch ( ... ) { eptr = ::std::current_exception(); } } );
+            [ &for_each_lambda, &eptr, &eptr_mutex ] ( typename ::std::decay_t<View>::size_type index ) noexcept
+              { try { for_each_lambda(index); } catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); } } );
   // If exceptions were thrown, rethrow the last
   if ( eptr ) LINALG_UNLIKELY
   {
@@ -789,6 +908,225 @@ struct apply_all_maybe_strided_helper< false >
   }
 };
 
+// Traverses views with run time strides such that the innermost loop runs over the smallest stride.
+// Leading dimensions which are contiguous with one another are collapsed into a single outer loop
+// which is distributed according to the execution policy.
+template < class View >
+inline constexpr bool is_runtime_strided_v = ( ::std::decay_t<View>::rank() > 1 ) &&
+                                             ::std::decay_t<View>::is_always_strided();
+
+template < class Lambda, class IndexType, ::std::size_t Rank, ::std::size_t ... Indices >
+LINALG_FORCE_INLINE_FUNCTION constexpr void apply_all_runtime_strided_invoke( Lambda&&                                          lambda,
+                                                                              const ::std::array<IndexType,Rank>&               indices,
+                                                                              [[maybe_unused]] ::std::index_sequence<Indices...> )
+  noexcept( noexcept( lambda( indices[Indices] ... ) ) )
+{
+  lambda( indices[Indices] ... );
+}
+
+template < class View,
+           class Lambda,
+           class ExecutionPolicy >
+inline void apply_all_runtime_strided( View&&            view,
+                                       Lambda&&          lambda,
+                                       ExecutionPolicy&& execution_policy )
+  noexcept( noexcept( apply_all_runtime_strided_invoke( lambda,
+                                                        ::std::declval< const ::std::array< typename ::std::decay_t<View>::size_type, ::std::decay_t<View>::rank() >& >(),
+                                                        ::std::make_index_sequence< ::std::decay_t<View>::rank() >{} ) ) )
+{
+  using size_type = typename ::std::decay_t<View>::size_type;
+  constexpr ::std::size_t rank        = ::std::decay_t<View>::rank();
+  constexpr bool          is_noexcept = noexcept( apply_all_runtime_strided_invoke( lambda,
+                                                                                    ::std::declval< const ::std::array<size_type,rank>& >(),
+                                                                                    ::std::make_index_sequence<rank>{} ) );
+  // Nothing to do for an empty view
+  for ( ::std::size_t dim = 0; dim < rank; ++dim )
+  {
+    if ( view.extent( dim ) == 0 ) LINALG_UNLIKELY
+    {
+      return;
+    }
+  }
+  // Order dimensions from largest to smallest stride
+  const runtime_stride_order< typename ::std::decay_t<View>::mapping_type > order( view.mapping() );
+  // Collapse leading dimensions which are contiguous with one another into the outer loop.
+  // The innermost dimension is never collapsed so it always runs as a simple loop.
+  ::std::size_t outer_rank = 1;
+  size_type     outer_size = view.extent( order.get_nth_largest_stride_index( 0 ) );
+  while ( outer_rank < rank - 1 )
+  {
+    const auto prev = order.get_nth_largest_stride_index( outer_rank - 1 );
+    const auto next = order.get_nth_largest_stride_index( outer_rank );
+    if ( ( view.extent( prev ) != 1 ) &&
+         ( static_cast<size_type>( view.stride( prev ) ) != static_cast<size_type>( view.stride( next ) ) * view.extent( next ) ) )
+    {
+      break;
+    }
+    outer_size *= view.extent( next );
+    ++outer_rank;
+  }
+  // Applies lambda to every element with the given outer linear index
+  auto outer_lambda = [&view,&lambda,&order,outer_rank]( size_type outer_index ) noexcept( is_noexcept )
+  {
+    ::std::array<size_type,rank> indices {};
+    // Decompose the outer index into the collapsed dimensions
+    for ( ::std::size_t n = outer_rank; n > 0; --n )
+    {
+      const auto dim = order.get_nth_largest_stride_index( n - 1 );
+      indices[dim]  = outer_index % view.extent( dim );
+      outer_index  /= view.extent( dim );
+    }
+    // Iterate the remaining dimensions with the smallest stride innermost
+    const auto      inner_dim  = order.get_nth_largest_stride_index( rank - 1 );
+    const size_type inner_size = view.extent( inner_dim );
+    while ( true )
+    {
+      for ( size_type index = 0; index < inner_size; ++index )
+      {
+        indices[inner_dim] = index;
+        apply_all_runtime_strided_invoke( lambda, indices, ::std::make_index_sequence<rank>{} );
+      }
+      // Carry into the next dimension
+      ::std::size_t n = rank - 1;
+      for ( ; n > outer_rank; --n )
+      {
+        const auto dim = order.get_nth_largest_stride_index( n - 1 );
+        if ( ++indices[dim] < view.extent( dim ) )
+        {
+          break;
+        }
+        indices[dim] = 0;
+      }
+      if ( n == outer_rank )
+      {
+        return;
+      }
+    }
+  };
+  if constexpr ( is_noexcept )
+  {
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( outer_size ),
+              outer_lambda );
+  }
+  else
+  {
+    // Cache the last exception to be thrown (guarded since the policy may be parallel)
+    ::std::exception_ptr eptr;
+    ::std::mutex         eptr_mutex;
+    // Attempt lambda expression
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( outer_size ),
+              [ &outer_lambda, &eptr, &eptr_mutex ] ( size_type index ) noexcept
+                { try { outer_lambda( index ); } catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); } } );
+    // If exceptions were thrown, rethrow the last
+    if ( eptr ) LINALG_UNLIKELY
+    {
+      ::std::rethrow_exception( eptr );
+    }
+  }
+}
+
+// Traverses matrix views of tiled layouts one storage tile at a time, so the elements of each tile
+// are visited consecutively. Tiles are distributed according to the execution policy.
+template < class View >
+inline constexpr bool is_tile_ordered_v = ( ::std::decay_t<View>::rank() == 2 ) &&
+                                          is_tiled_layout_v< typename ::std::decay_t<View>::layout_type >;
+
+template < class View,
+           class Lambda,
+           class ExecutionPolicy >
+inline void apply_all_tile_ordered( View&&            view,
+                                    Lambda&&          lambda,
+                                    ExecutionPolicy&& execution_policy )
+  noexcept( noexcept( lambda( ::std::declval< const typename ::std::decay_t<View>::size_type& >(),
+                              ::std::declval< const typename ::std::decay_t<View>::size_type& >() ) ) )
+{
+  using size_type   = typename ::std::decay_t<View>::size_type;
+  using layout_type = typename ::std::decay_t<View>::layout_type;
+  constexpr size_type row_tile    = static_cast<size_type>( layout_type::row_tile );
+  constexpr size_type col_tile    = static_cast<size_type>( layout_type::col_tile );
+  constexpr bool      is_noexcept = noexcept( lambda( ::std::declval<const size_type&>(), ::std::declval<const size_type&>() ) );
+  const size_type rows    = view.extent( 0 );
+  const size_type columns = view.extent( 1 );
+  if ( ( rows == 0 ) || ( columns == 0 ) ) LINALG_UNLIKELY
+  {
+    return;
+  }
+  // The view may start inside a tile, in which case the first tile along each dimension is partial
+  const size_type row_origin = static_cast<size_type>( view.mapping().tile_origin( 0 ) );
+  const size_type col_origin = static_cast<size_type>( view.mapping().tile_origin( 1 ) );
+  const size_type row_tiles  = ( row_origin + rows + row_tile - 1 ) / row_tile;
+  const size_type col_tiles  = ( col_origin + columns + col_tile - 1 ) / col_tile;
+  // Applies lambda to every element of a single tile
+  auto tile_lambda = [&lambda,rows,columns,row_origin,col_origin,col_tiles]( size_type tile_index ) noexcept( is_noexcept )
+  {
+    const size_type tile_row  = tile_index / col_tiles;
+    const size_type tile_col  = tile_index % col_tiles;
+    const size_type row_first = ( tile_row == 0 ) ? size_type( 0 ) : tile_row * row_tile - row_origin;
+    const size_type col_first = ( tile_col == 0 ) ? size_type( 0 ) : tile_col * col_tile - col_origin;
+    const size_type row_last  = ::std::min( ( tile_row + 1 ) * row_tile - row_origin, rows );
+    const size_type col_last  = ::std::min( ( tile_col + 1 ) * col_tile - col_origin, columns );
+    for ( size_type row = row_first; row < row_last; ++row )
+    {
+      for ( size_type col = col_first; col < col_last; ++col )
+      {
+        lambda( static_cast<const size_type&>( row ), static_cast<const size_type&>( col ) );
+      }
+    }
+  };
+  const size_type tile_count = row_tiles * col_tiles;
+  if constexpr ( is_noexcept )
+  {
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( tile_count ),
+              tile_lambda );
+  }
+  else
+  {
+    // Cache the last exception to be thrown (guarded since the policy may be parallel)
+    ::std::exception_ptr eptr;
+    ::std::mutex         eptr_mutex;
+    // Attempt lambda expression
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( tile_count ),
+              [ &tile_lambda, &eptr, &eptr_mutex ] ( size_type index ) noexcept
+                { try { tile_lambda( index ); } catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); } } );
+    // If exceptions were thrown, rethrow the last
+    if ( eptr ) LINALG_UNLIKELY
+    {
+      ::std::rethrow_exception( eptr );
+    }
+  }
+}
+
+// Traverses views of recursive layouts in square blocks of the recursion base size, which are
+// contiguous whenever the view is aligned to them
+template < class View >
+inline constexpr bool is_recursive_ordered_v = ( ::std::decay_t<View>::rank() > 1 ) &&
+                                               is_recursive_layout_v< typename ::std::decay_t<View>::layout_type >;
+
+template < class View,
+           class Lambda,
+           class ExecutionPolicy >
+inline void apply_all_tiled( View&&            view,
+                             Lambda&&          lambda,
+                             ExecutionPolicy&& execution_policy,
+                             ::std::size_t     tile_outer_dim,
+                             ::std::size_t     tile_inner_dim,
+                             ::std::size_t     tile_size = LINALG_TRAVERSAL_TILE_SIZE )
+  noexcept( noexcept( apply_all_runtime_strided_invoke( lambda,
+                                                        ::std::declval< const ::std::array< typename ::std::decay_t<View>::size_type, ::std::decay_t<View>::rank() >& >(),
+                                                        ::std::make_index_sequence< ::std::decay_t<View>::rank() >{} ) ) );
+
 template < class View,
            class Lambda,
            class ExecutionPolicy >
@@ -800,9 +1138,536 @@ constexpr void apply_all( View&&            view,
                                       ::std::forward<ExecutionPolicy>( ::std::declval<ExecutionPolicy&&>() ),
                                       ::std::make_integer_sequence<typename ::std::decay_t<View>::extents_type::rank_type,::std::decay_t<View>::extents_type::rank()>{} ) ) )
 {
-  return apply_all_maybe_strided_helper< is_defined_v< stride_order< decay_t< View > > > &&
-                                         is_unsequenced_v< decay_t< ExecutionPolicy > > >::
-    apply_all( view, lambda, execution_policy );
+  constexpr bool is_compile_time_strided = is_defined_v< stride_order< decay_t< View > > > &&
+                                           is_unsequenced_v< decay_t< ExecutionPolicy > >;
+  if constexpr ( is_tile_ordered_v< View > )
+  {
+    apply_all_tile_ordered( view, lambda, execution_policy );
+  }
+  else if constexpr ( is_recursive_ordered_v< View > )
+  {
+    apply_all_tiled( view, lambda, execution_policy, ::std::decay_t<View>::rank() - 2, ::std::decay_t<View>::rank() - 1, LINALG_RECURSIVE_BASE_SIZE );
+  }
+  else if constexpr ( !is_compile_time_strided && is_runtime_strided_v< View > )
+  {
+    apply_all_runtime_strided( view, lambda, execution_policy );
+  }
+  else
+  {
+    apply_all_maybe_strided_helper< is_compile_time_strided >::apply_all( view, lambda, execution_policy );
+  }
+}
+
+//==================================================================================================
+//  Apply All Tiled applies the lambda expression to all elements in the view, walking the plane
+//  spanned by two dimensions in square tiles. Used when operands disagree on which dimension is
+//  contiguous, so both operands keep a tile's worth of cache lines resident. Tiles (and the
+//  remaining dimensions) are distributed according to the execution policy.
+//==================================================================================================
+template < class View,
+           class Lambda,
+           class ExecutionPolicy >
+inline void apply_all_tiled( View&&            view,
+                             Lambda&&          lambda,
+                             ExecutionPolicy&& execution_policy,
+                             ::std::size_t     tile_outer_dim,
+                             ::std::size_t     tile_inner_dim,
+                             ::std::size_t     tile_size )
+  noexcept( noexcept( apply_all_runtime_strided_invoke( lambda,
+                                                        ::std::declval< const ::std::array< typename ::std::decay_t<View>::size_type, ::std::decay_t<View>::rank() >& >(),
+                                                        ::std::make_index_sequence< ::std::decay_t<View>::rank() >{} ) ) )
+{
+  using size_type = typename ::std::decay_t<View>::size_type;
+  constexpr ::std::size_t rank        = ::std::decay_t<View>::rank();
+  constexpr bool          is_noexcept = noexcept( apply_all_runtime_strided_invoke( lambda,
+                                                                                    ::std::declval< const ::std::array<size_type,rank>& >(),
+                                                                                    ::std::make_index_sequence<rank>{} ) );
+  static_assert( rank > 1, "Tiled traversal requires at least two dimensions." );
+  // Number of tiles along each tiled dimension and the number of combinations of the other dimensions
+  const size_type outer_extent = view.extent( tile_outer_dim );
+  const size_type inner_extent = view.extent( tile_inner_dim );
+  const size_type outer_tiles  = ( outer_extent + tile_size - 1 ) / tile_size;
+  const size_type inner_tiles  = ( inner_extent + tile_size - 1 ) / tile_size;
+  size_type       other_size   = 1;
+  for ( ::std::size_t dim = 0; dim < rank; ++dim )
+  {
+    if ( ( dim != tile_outer_dim ) && ( dim != tile_inner_dim ) )
+    {
+      other_size *= view.extent( dim );
+    }
+  }
+  // Applies lambda to every element of a single tile
+  auto tile_lambda = [&view,&lambda,tile_outer_dim,tile_inner_dim,tile_size,outer_extent,inner_extent,outer_tiles,inner_tiles]
+    ( size_type tile_index ) noexcept( is_noexcept )
+  {
+    ::std::array<size_type,rank> indices {};
+    // Decompose the tile index into the tile position and the other dimensions
+    const size_type inner_tile = tile_index % inner_tiles;
+    tile_index /= inner_tiles;
+    const size_type outer_tile = tile_index % outer_tiles;
+    tile_index /= outer_tiles;
+    for ( ::std::size_t n = rank; n > 0; --n )
+    {
+      if ( ( n - 1 != tile_outer_dim ) && ( n - 1 != tile_inner_dim ) )
+      {
+        indices[n-1] = tile_index % view.extent( n - 1 );
+        tile_index  /= view.extent( n - 1 );
+      }
+    }
+    // Walk the tile
+    const size_type outer_end = ::std::min( ( outer_tile + 1 ) * tile_size, outer_extent );
+    const size_type inner_end = ::std::min( ( inner_tile + 1 ) * tile_size, inner_extent );
+    for ( size_type outer = outer_tile * tile_size; outer < outer_end; ++outer )
+    {
+      indices[tile_outer_dim] = outer;
+      for ( size_type inner = inner_tile * tile_size; inner < inner_end; ++inner )
+      {
+        indices[tile_inner_dim] = inner;
+        apply_all_runtime_strided_invoke( lambda, indices, ::std::make_index_sequence<rank>{} );
+      }
+    }
+  };
+  const size_type tile_count = other_size * outer_tiles * inner_tiles;
+  if constexpr ( is_noexcept )
+  {
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( tile_count ),
+              tile_lambda );
+  }
+  else
+  {
+    // Cache the last exception to be thrown (guarded since the policy may be parallel)
+    ::std::exception_ptr eptr;
+    ::std::mutex         eptr_mutex;
+    // Attempt lambda expression
+    ::std::experimental::math::detail::
+    for_each( execution_policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( tile_count ),
+              [ &tile_lambda, &eptr, &eptr_mutex ] ( size_type index ) noexcept
+                { try { tile_lambda( index ); } catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); } } );
+    // If exceptions were thrown, rethrow the last
+    if ( eptr ) LINALG_UNLIKELY
+    {
+      ::std::rethrow_exception( eptr );
+    }
+  }
+}
+
+//==================================================================================================
+//  Multiply Add Recursive accumulates the product of two matrix views into a third by splitting the
+//  largest of the three dimensions in two until every dimension is at most the base size. Splits
+//  are placed at power of two boundaries, so blocks of recursive layouts stay contiguous and the
+//  working set of each level fits the fastest cache it can, whatever the cache sizes.
+//==================================================================================================
+/// @brief Returns the size of the first half of a dimension of the given extent
+template < class SizeType >
+[[nodiscard]] constexpr SizeType recursive_split( SizeType extent ) noexcept
+{
+  SizeType half = 1;
+  while ( half * 2 < extent )
+  {
+    half *= 2;
+  }
+  return half;
+}
+
+/// @brief Returns one of three per-thread buffers which each hold a base size block of T.
+///        Kept out of the stack frames of the recursion, which may be many levels deep.
+template < class T >
+[[nodiscard]] T* recursive_block_buffer( ::std::size_t slot ) noexcept
+{
+  constexpr ::std::size_t block = LINALG_RECURSIVE_BASE_SIZE;
+  alignas( T ) static thread_local ::std::byte storage[ 3 ][ block * block * sizeof( T ) ];
+  return reinterpret_cast<T*>( storage[ slot ] );
+}
+
+/// @brief Accumulates the product of two views of at most the base size into a third. Element
+///        types which are trivially destructible are packed into contiguous row major buffers, so
+///        the innermost loop runs over unit strides whatever the layouts; others are accumulated
+///        in place, so no element type needs to be default constructible.
+template < class C, class A, class B >
+void multiply_add_block( const C& c, const A& a, const B& b )
+{
+  using size_type    = ::std::size_t;
+  using c_value_type = ::std::remove_cv_t< typename C::element_type >;
+  using a_value_type = ::std::remove_cv_t< typename A::element_type >;
+  using b_value_type = ::std::remove_cv_t< typename B::element_type >;
+  const size_type m = static_cast<size_type>( c.extent(0) );
+  const size_type n = static_cast<size_type>( c.extent(1) );
+  const size_type k = static_cast<size_type>( a.extent(1) );
+  if constexpr ( ::std::is_trivially_destructible_v<c_value_type> &&
+                 ::std::is_trivially_destructible_v<a_value_type> &&
+                 ::std::is_trivially_destructible_v<b_value_type> )
+  {
+    constexpr size_type block   = LINALG_RECURSIVE_BASE_SIZE;
+    c_value_type*       c_block = recursive_block_buffer<c_value_type>( 0 );
+    a_value_type*       a_block = recursive_block_buffer<a_value_type>( 1 );
+    b_value_type*       b_block = recursive_block_buffer<b_value_type>( 2 );
+    for ( size_type i = 0; i < m; ++i )
+    {
+      for ( size_type p = 0; p < k; ++p )
+      {
+        ::new ( a_block + i * block + p ) a_value_type( access( a, i, p ) );
+      }
+      for ( size_type j = 0; j < n; ++j )
+      {
+        ::new ( c_block + i * block + j ) c_value_type( access( c, i, j ) );
+      }
+    }
+    for ( size_type p = 0; p < k; ++p )
+    {
+      for ( size_type j = 0; j < n; ++j )
+      {
+        ::new ( b_block + p * block + j ) b_value_type( access( b, p, j ) );
+      }
+    }
+    for ( size_type i = 0; i < m; ++i )
+    {
+      for ( size_type p = 0; p < k; ++p )
+      {
+        const a_value_type a_ip = a_block[ i * block + p ];
+        for ( size_type j = 0; j < n; ++j )
+        {
+          c_block[ i * block + j ] += a_ip * b_block[ p * block + j ];
+        }
+      }
+    }
+    for ( size_type i = 0; i < m; ++i )
+    {
+      for ( size_type j = 0; j < n; ++j )
+      {
+        access( c, i, j ) = c_block[ i * block + j ];
+      }
+    }
+  }
+  else
+  {
+    for ( size_type i = 0; i < m; ++i )
+    {
+      for ( size_type p = 0; p < k; ++p )
+      {
+        for ( size_type j = 0; j < n; ++j )
+        {
+          access( c, i, j ) += access( a, i, p ) * access( b, p, j );
+        }
+      }
+    }
+  }
+}
+
+template < class C, class A, class B >
+constexpr void multiply_add_recursive( const C& c, const A& a, const B& b )
+{
+  using size_type = ::std::size_t;
+  using range     = ::std::tuple<size_type,size_type>;
+  const size_type m = static_cast<size_type>( c.extent(0) );
+  const size_type n = static_cast<size_type>( c.extent(1) );
+  const size_type k = static_cast<size_type>( a.extent(1) );
+  if ( ( m <= LINALG_RECURSIVE_BASE_SIZE ) && ( n <= LINALG_RECURSIVE_BASE_SIZE ) && ( k <= LINALG_RECURSIVE_BASE_SIZE ) )
+  {
+    multiply_add_block( c, a, b );
+  }
+  else if ( ( m >= n ) && ( m >= k ) )
+  {
+    const size_type half = recursive_split( m );
+    multiply_add_recursive( ::std::experimental::submdspan( c, range( 0, half ), ::std::experimental::full_extent ),
+                            ::std::experimental::submdspan( a, range( 0, half ), ::std::experimental::full_extent ), b );
+    multiply_add_recursive( ::std::experimental::submdspan( c, range( half, m ), ::std::experimental::full_extent ),
+                            ::std::experimental::submdspan( a, range( half, m ), ::std::experimental::full_extent ), b );
+  }
+  else if ( n >= k )
+  {
+    const size_type half = recursive_split( n );
+    multiply_add_recursive( ::std::experimental::submdspan( c, ::std::experimental::full_extent, range( 0, half ) ), a,
+                            ::std::experimental::submdspan( b, ::std::experimental::full_extent, range( 0, half ) ) );
+    multiply_add_recursive( ::std::experimental::submdspan( c, ::std::experimental::full_extent, range( half, n ) ), a,
+                            ::std::experimental::submdspan( b, ::std::experimental::full_extent, range( half, n ) ) );
+  }
+  else
+  {
+    const size_type half = recursive_split( k );
+    multiply_add_recursive( c, ::std::experimental::submdspan( a, ::std::experimental::full_extent, range( 0, half ) ),
+                               ::std::experimental::submdspan( b, range( 0, half ), ::std::experimental::full_extent ) );
+    multiply_add_recursive( c, ::std::experimental::submdspan( a, ::std::experimental::full_extent, range( half, k ) ),
+                               ::std::experimental::submdspan( b, range( half, k ), ::std::experimental::full_extent ) );
+  }
+}
+
+//==================================================================================================
+//  Products compute the elements of matrix-matrix, matrix-vector and vector-matrix products. The
+//  element functions are shared by the operations constructing a new result and those writing into
+//  a given one. Matrix products into recursive layouts are computed by recursive subdivision, and
+//  into tiled layouts one result tile at a time, accumulating blocks of k which match the tiles of
+//  the operands, so each pair of operand blocks is reused from cache for a whole result tile.
+//==================================================================================================
+template < class T, class M1, class M2, class I, class J >
+[[nodiscard]] constexpr T matrix_product_element( const M1& m1, const M2& m2, I index1, J index2 ) noexcept
+{
+  T result = 0;
+  ::std::experimental::math::detail::
+  for_each( LINALG_EXECUTION_UNSEQ,
+            faux_index_iterator<typename M1::index_type>( 0 ),
+            faux_index_iterator<typename M1::index_type>( m1.size().extent(1) ),
+            [ &m1, &m2, &index1, &index2, &result ] ( typename M1::index_type index ) constexpr noexcept
+              { result += access( m1, index1, index ) * access( m2, index, index2 ); } );
+  return result;
+}
+
+template < class T, class M, class V, class I >
+[[nodiscard]] constexpr T matrix_vector_product_element( const M& m, const V& v, I index1 ) noexcept
+{
+  T result = 0;
+  ::std::experimental::math::detail::
+  for_each( LINALG_EXECUTION_UNSEQ,
+            faux_index_iterator<typename V::index_type>( 0 ),
+            faux_index_iterator<typename V::index_type>( v.size().extent(0) ),
+            [ &m, &v, &index1, &result ] ( typename V::index_type index ) constexpr noexcept
+              { result += access( m, index1, index ) * access( v, index ); } );
+  return result;
+}
+
+template < class T, class V, class M, class I >
+[[nodiscard]] constexpr T vector_matrix_product_element( const V& v, const M& m, I index2 ) noexcept
+{
+  T result = 0;
+  ::std::experimental::math::detail::
+  for_each( LINALG_EXECUTION_UNSEQ,
+            faux_index_iterator<typename V::index_type>( 0 ),
+            faux_index_iterator<typename V::index_type>( v.size().extent(0) ),
+            [ &v, &m, &index2, &result ] ( typename V::index_type index ) constexpr noexcept
+              { result += access( v, index ) * access( m, index, index2 ); } );
+  return result;
+}
+
+// Returns the extent of the blocks of k accumulated into each tile of a tiled result
+template < class M1, class M2 >
+[[nodiscard]] constexpr ::std::size_t product_k_block() noexcept
+{
+  if constexpr ( is_tiled_layout_v< typename M1::layout_type > )
+  {
+    return M1::layout_type::col_tile;
+  }
+  else if constexpr ( is_tiled_layout_v< typename M2::layout_type > )
+  {
+    return M2::layout_type::row_tile;
+  }
+  else
+  {
+    return LINALG_RECURSIVE_BASE_SIZE;
+  }
+}
+
+// Writes m1 * m2 into result, whose size must already match
+template < class R, class M1, class M2, class ExecutionPolicy >
+void matrix_product_into( R& result, const M1& m1, const M2& m2, ExecutionPolicy&& policy )
+{
+  using value_type = typename R::value_type;
+  if constexpr ( is_recursive_layout_v< typename R::layout_type > )
+  {
+    // Recursive layouts are multiplied by recursive subdivision into a zero matrix
+    apply_all( result.underlying_span(), [&result]( auto index1, auto index2 ) constexpr noexcept
+               { access( result, index1, index2 ) = value_type( 0 ); }, policy );
+    multiply_add_recursive( result.underlying_span(), m1.underlying_span(), m2.underlying_span() );
+  }
+  else if constexpr ( is_tiled_layout_v< typename R::layout_type > )
+  {
+    // Results are whole matrices, so their tiles start at the origin
+    using size_type = ::std::size_t;
+    using range     = ::std::tuple<size_type,size_type>;
+    constexpr size_type row_tile = R::layout_type::row_tile;
+    constexpr size_type col_tile = R::layout_type::col_tile;
+    constexpr size_type k_block  = product_k_block<M1,M2>();
+    const size_type rows      = static_cast<size_type>( result.size().extent(0) );
+    const size_type columns   = static_cast<size_type>( result.size().extent(1) );
+    const size_type k         = static_cast<size_type>( m1.size().extent(1) );
+    const size_type col_tiles = ( columns + col_tile - 1 ) / col_tile;
+    const size_type row_tiles = ( rows + row_tile - 1 ) / row_tile;
+    auto c = result.underlying_span();
+    auto a = m1.underlying_span();
+    auto b = m2.underlying_span();
+    auto tile_lambda = [&c,&a,&b,rows,columns,k,col_tiles]( size_type tile_index ) noexcept
+    {
+      const range tile_rows( ( tile_index / col_tiles ) * row_tile, ::std::min( ( tile_index / col_tiles + 1 ) * row_tile, rows ) );
+      const range tile_cols( ( tile_index % col_tiles ) * col_tile, ::std::min( ( tile_index % col_tiles + 1 ) * col_tile, columns ) );
+      auto c_tile = ::std::experimental::submdspan( c, tile_rows, tile_cols );
+      for ( size_type i = 0; i < c_tile.extent(0); ++i )
+      {
+        for ( size_type j = 0; j < c_tile.extent(1); ++j )
+        {
+          access( c_tile, i, j ) = value_type( 0 );
+        }
+      }
+      for ( size_type first = 0; first < k; first += k_block )
+      {
+        const range block( first, ::std::min( first + k_block, k ) );
+        multiply_add_recursive( c_tile,
+                                ::std::experimental::submdspan( a, tile_rows, block ),
+                                ::std::experimental::submdspan( b, block, tile_cols ) );
+      }
+    };
+    ::std::experimental::math::detail::
+    for_each( policy,
+              faux_index_iterator<size_type>( 0 ),
+              faux_index_iterator<size_type>( row_tiles * col_tiles ),
+              tile_lambda );
+  }
+  else
+  {
+    apply_all( result.underlying_span(), [&result,&m1,&m2]( auto index1, auto index2 ) constexpr noexcept
+               { access( result, index1, index2 ) = matrix_product_element<value_type>( m1, m2, index1, index2 ); }, policy );
+  }
+}
+
+// Writes m * v into result, whose size must already match
+template < class R, class M, class V, class ExecutionPolicy >
+void matrix_vector_product_into( R& result, const M& m, const V& v, ExecutionPolicy&& policy )
+{
+  using value_type = typename R::value_type;
+  apply_all( result.underlying_span(), [&result,&m,&v]( auto index1 ) constexpr noexcept
+             { access( result, index1 ) = matrix_vector_product_element<value_type>( m, v, index1 ); }, policy );
+}
+
+// Writes v * m into result, whose size must already match
+template < class R, class V, class M, class ExecutionPolicy >
+void vector_matrix_product_into( R& result, const V& v, const M& m, ExecutionPolicy&& policy )
+{
+  using value_type = typename R::value_type;
+  apply_all( result.underlying_span(), [&result,&v,&m]( auto index2 ) constexpr noexcept
+             { access( result, index2 ) = vector_matrix_product_element<value_type>( v, m, index2 ); }, policy );
+}
+
+//==================================================================================================
+//  Contiguous Dimension returns the dimension with the smallest stride of a strided view
+//==================================================================================================
+template < class View >
+[[nodiscard]] constexpr ::std::size_t contiguous_dimension( const View& view ) noexcept
+{
+  return runtime_stride_order< typename View::mapping_type >( view.mapping() ).get_nth_largest_stride_index( View::rank() - 1 );
+}
+
+//==================================================================================================
+//  Apply All Elementwise applies the lambda expression to corresponding elements of each view over
+//  the extents of the first view. If every view is exhaustive and maps indices to offsets
+//  identically, then the underlying data handles are traversed as a single flat range.
+//  Otherwise, falls back to the multi-index traversal of apply_all.
+//==================================================================================================
+template < class View, class OtherView >
+[[nodiscard]] constexpr bool is_same_linear_mapping( const View& view, const OtherView& other_view ) noexcept
+{
+  // Both views must cover the same multi-dimensional range
+  for ( ::std::size_t dim = 0; dim < View::rank(); ++dim )
+  {
+    if ( static_cast< ::std::size_t >( view.extent( dim ) ) != static_cast< ::std::size_t >( other_view.extent( dim ) ) )
+    {
+      return false;
+    }
+  }
+  if ( !other_view.is_exhaustive() )
+  {
+    return false;
+  }
+  if constexpr ( ::std::is_same_v< typename View::mapping_type, typename OtherView::mapping_type > )
+  {
+    return ( view.mapping() == other_view.mapping() );
+  }
+  else if constexpr ( View::is_always_strided() && OtherView::is_always_strided() )
+  {
+    for ( ::std::size_t dim = 0; dim < View::rank(); ++dim )
+    {
+      if ( static_cast< ::std::size_t >( view.stride( dim ) ) != static_cast< ::std::size_t >( other_view.stride( dim ) ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+template < class View, class ... Views >
+[[nodiscard]] constexpr bool is_linear_traversable( const View& view, const Views& ... views ) noexcept
+{
+  return ( View::rank() == 0 ) || ( view.is_exhaustive() && ( is_same_linear_mapping( view, views ) && ... ) );
+}
+
+template < class Lambda, class ExecutionPolicy, class View, class ... Views >
+inline void apply_all_elementwise_except( Lambda&&          lambda,
+                                          ExecutionPolicy&& execution_policy,
+                                          View&&            view,
+                                          Views&& ...       views )
+{
+  // Cache the last exception to be thrown (guarded since the policy may be parallel)
+  ::std::exception_ptr eptr;
+  ::std::mutex         eptr_mutex;
+  // Attempt lambda expression on each element
+  ::std::experimental::math::detail::
+  for_each( execution_policy,
+            faux_index_iterator< ::std::size_t >( 0 ),
+            faux_index_iterator< ::std::size_t >( view.size() ),
+            [ &lambda, &view, &views ..., &eptr, &eptr_mutex ]( ::std::size_t index ) noexcept
+              {
+                try { lambda( view.accessor().access( view.data_handle(), index ), views.accessor().access( views.data_handle(), index ) ... ); }
+                catch ( ... ) { ::std::lock_guard< ::std::mutex > lock( eptr_mutex ); eptr = ::std::current_exception(); }
+              } );
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+template < class Lambda, class ExecutionPolicy, class View, class ... Views >
+constexpr void apply_all_elementwise( Lambda&&          lambda,
+                                      ExecutionPolicy&& execution_policy,
+                                      View&&            view,
+                                      Views&& ...       views )
+  noexcept( noexcept( lambda( ::std::declval<typename ::std::decay_t<View>::reference>(),
+                              ::std::declval<typename ::std::decay_t<Views>::reference>() ... ) ) )
+{
+  constexpr bool is_noexcept = noexcept( lambda( ::std::declval<typename ::std::decay_t<View>::reference>(),
+                                                 ::std::declval<typename ::std::decay_t<Views>::reference>() ... ) );
+  if ( is_linear_traversable( view, views ... ) ) LINALG_LIKELY
+  {
+    if constexpr ( is_noexcept )
+    {
+      ::std::experimental::math::detail::
+      for_each( execution_policy,
+                faux_index_iterator< ::std::size_t >( 0 ),
+                faux_index_iterator< ::std::size_t >( view.size() ),
+                [ &lambda, &view, &views ... ]( ::std::size_t index ) constexpr noexcept
+                  { lambda( view.accessor().access( view.data_handle(), index ), views.accessor().access( views.data_handle(), index ) ... ); } );
+    }
+    else
+    {
+      apply_all_elementwise_except( lambda, execution_policy, view, views ... );
+    }
+  }
+  else
+  {
+    auto index_lambda = [ &lambda, &view, &views ... ]( auto ... indices ) constexpr noexcept( is_noexcept )
+      { lambda( access( view, indices ... ), access( views, indices ... ) ... ); };
+    if constexpr ( ( ::std::decay_t<View>::rank() > 1 ) &&
+                   ::std::decay_t<View>::is_always_strided() &&
+                   ( ::std::decay_t<Views>::is_always_strided() && ... ) )
+    {
+      // If another operand is contiguous along a different dimension, then traverse in tiles
+      const ::std::size_t contiguous_dim       = contiguous_dimension( view );
+      ::std::size_t       other_contiguous_dim = contiguous_dim;
+      static_cast<void>( ( ( other_contiguous_dim = contiguous_dimension( views ), other_contiguous_dim != contiguous_dim ) || ... ) );
+      if ( other_contiguous_dim != contiguous_dim )
+      {
+        apply_all_tiled( view, index_lambda, execution_policy, other_contiguous_dim, contiguous_dim );
+        return;
+      }
+    }
+    apply_all( view, index_lambda, execution_policy );
+  }
 }
 
 //==================================================================================================
@@ -901,21 +1766,23 @@ assign_view( ToView& to_view, const FromView& from_view )
 {
   if constexpr ( extents_are_equal_v<typename FromView::extents_type,typename ToView::extents_type> )
   {
-    apply_all( from_view,
-               [ &to_view, &from_view ]( auto ... indices )
-                 constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
-                 { access( to_view, indices ... ) = access( from_view, indices ... ); },
-               LINALG_EXECUTION_UNSEQ );
+    apply_all_elementwise( []( auto&& from, auto&& to )
+                             constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
+                             { to = from; },
+                           LINALG_EXECUTION_UNSEQ,
+                           from_view,
+                           to_view );
   }
   else
   {
     if ( sufficient_extents( to_view.extents(), from_view.extents() ) ) LINALG_LIKELY
     {
-      apply_all( from_view,
-                 [ &to_view, &from_view ]( auto ... indices )
-                   constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
-                   { access( to_view, indices ... ) = access( from_view, indices ... ); },
-                 LINALG_EXECUTION_UNSEQ );
+      apply_all_elementwise( []( auto&& from, auto&& to )
+                               constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
+                               { to = from; },
+                             LINALG_EXECUTION_UNSEQ,
+                             from_view,
+                             to_view );
     }
     else LINALG_UNLIKELY
     {
@@ -945,21 +1812,23 @@ copy_view( ToView& to_view, const FromView& from_view )
 {
   if constexpr ( extents_are_equal_v<typename FromView::extents_type,typename ToView::extents_type> )
   {
-    apply_all( ::std::forward<ToView>( to_view ),
-              [ &to_view, &from_view ]( auto ... indices )
-                constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
-                { ::new ( ::std::addressof( access( to_view, indices ... ) ) ) typename ToView::element_type( access( from_view, indices ... ) ); },
-              LINALG_EXECUTION_UNSEQ );
+    apply_all_elementwise( []( auto&& from, auto&& to )
+                             constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
+                             { ::new ( ::std::addressof( to ) ) typename ToView::element_type( from ); },
+                           LINALG_EXECUTION_UNSEQ,
+                           from_view,
+                           to_view );
   }
   else
   {
     if ( sufficient_extents( to_view.extents(), from_view.extents() ) ) LINALG_LIKELY
     {
-      apply_all( forward<ToView>( to_view ),
-                [ &to_view, &from_view ]( auto ... indices )
-                  constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
-                  { ::new ( ::std::addressof( access( to_view, indices ... ) ) ) typename ToView::element_type( access( from_view, indices ... ) ); },
-                LINALG_EXECUTION_UNSEQ );
+      apply_all_elementwise( []( auto&& from, auto&& to )
+                               constexpr noexcept( is_nothrow_convertible_v<typename ::std::decay_t<FromView>::reference,typename ::std::decay_t<ToView>::reference> )
+                               { ::new ( ::std::addressof( to ) ) typename ToView::element_type( from ); },
+                             LINALG_EXECUTION_UNSEQ,
+                             from_view,
+                             to_view );
     }
     else LINALG_UNLIKELY
     {
@@ -968,6 +1837,126 @@ copy_view( ToView& to_view, const FromView& from_view )
   }
 }
 
+//==================================================================================================
+//  Copy Block copies the leading region of one layout_right or layout_left block of trivially
+//  copyable elements into another block of possibly different capacity. Contiguous runs along the
+//  fastest dimension are copied with memcpy. If the region spans the full capacity of both blocks
+//  in every dimension but the slowest, then the region is a single run.
+//==================================================================================================
+template < class Layout, class T, class Extents >
+inline void copy_block( T* to, const Extents& to_cap, const T* from, const Extents& from_cap, const Extents& region ) noexcept
+{
+  static_assert( ::std::is_trivially_copyable_v<T>, "Copy block requires trivially copyable elements." );
+  static_assert( ::std::is_same_v< Layout, ::std::experimental::layout_right > || ::std::is_same_v< Layout, ::std::experimental::layout_left >,
+                 "Copy block requires layout_right or layout_left." );
+  constexpr ::std::size_t rank = Extents::rank();
+  // Order dimensions from fastest to slowest
+  auto dim = []( ::std::size_t n ) constexpr noexcept
+    { return ::std::is_same_v< Layout, ::std::experimental::layout_right > ? rank - 1 - n : n; };
+  if constexpr ( rank == 0 )
+  {
+    ::std::memcpy( to, from, sizeof(T) );
+  }
+  else
+  {
+    // Count elements in the region, bailing out early if it is empty
+    ::std::size_t count = 1;
+    for ( ::std::size_t n = 0; n < rank; ++n )
+    {
+      count *= static_cast<::std::size_t>( region.extent( n ) );
+    }
+    if ( count == 0 )
+    {
+      return;
+    }
+    // Collapse leading dimensions which span the full capacity of both blocks into a single run
+    ::std::size_t run   = 1;
+    ::std::size_t first = 0;
+    for ( ; first < rank; ++first )
+    {
+      run *= static_cast<::std::size_t>( region.extent( dim( first ) ) );
+      if ( ( region.extent( dim( first ) ) != to_cap.extent( dim( first ) ) ) ||
+           ( region.extent( dim( first ) ) != from_cap.extent( dim( first ) ) ) )
+      {
+        ++first;
+        break;
+      }
+    }
+    // Strides of the remaining dimensions
+    ::std::array< ::std::size_t, rank > to_stride {};
+    ::std::array< ::std::size_t, rank > from_stride {};
+    ::std::size_t to_step   = 1;
+    ::std::size_t from_step = 1;
+    for ( ::std::size_t n = 0; n < rank; ++n )
+    {
+      to_stride[n]   = to_step;
+      from_stride[n] = from_step;
+      to_step       *= static_cast<::std::size_t>( to_cap.extent( dim( n ) ) );
+      from_step     *= static_cast<::std::size_t>( from_cap.extent( dim( n ) ) );
+    }
+    // Copy each run, advancing the remaining dimensions as an odometer
+    ::std::array< ::std::size_t, rank > index {};
+    for ( ::std::size_t copied = 0; copied < count; copied += run )
+    {
+      ::std::size_t to_offset   = 0;
+      ::std::size_t from_offset = 0;
+      for ( ::std::size_t n = first; n < rank; ++n )
+      {
+        to_offset   += index[n] * to_stride[n];
+        from_offset += index[n] * from_stride[n];
+      }
+      ::std::memcpy( to + to_offset, from + from_offset, run * sizeof(T) );
+      for ( ::std::size_t n = first; n < rank; ++n )
+      {
+        if ( ++index[n] < static_cast<::std::size_t>( region.extent( dim( n ) ) ) )
+        {
+          break;
+        }
+        index[n] = 0;
+      }
+    }
+  }
+}
+
+//==================================================================================================
+//  Has Reallocate is true if the allocator can resize an allocation, preserving its contents,
+//  through a member reallocate( pointer, old_size, new_size )
+//==================================================================================================
+template < class Alloc, typename = void >
+struct has_reallocate : public ::std::false_type { };
+template < class Alloc >
+struct has_reallocate< Alloc, ::std::void_t< decltype( ::std::declval<Alloc&>().reallocate( ::std::declval<typename ::std::allocator_traits<Alloc>::pointer>(),
+                                                                                            ::std::declval<typename ::std::allocator_traits<Alloc>::size_type>(),
+                                                                                            ::std::declval<typename ::std::allocator_traits<Alloc>::size_type>() ) ) > > :
+  public ::std::true_type { };
+template < class Alloc >
+inline constexpr bool has_reallocate_v = has_reallocate<Alloc>::value;
+
+//==================================================================================================
+//  Inline Capacity is the number of elements a dynamic tensor stores within itself, advertised by
+//  its allocator through a static inline_capacity member, and zero for every other allocator.
+//  Inline Buffer is that storage; it is empty when the capacity is zero.
+//==================================================================================================
+template < class Alloc, typename = void >
+struct inline_capacity : public ::std::integral_constant< ::std::size_t, 0 > { };
+template < class Alloc >
+struct inline_capacity< Alloc, ::std::void_t< decltype( Alloc::inline_capacity ) > > :
+  public ::std::integral_constant< ::std::size_t, Alloc::inline_capacity > { };
+template < class Alloc >
+inline constexpr ::std::size_t inline_capacity_v = inline_capacity<Alloc>::value;
+
+template < class T, ::std::size_t N >
+struct inline_buffer
+{
+  [[nodiscard]] T* data() noexcept { return reinterpret_cast<T*>( this->storage ); }
+  [[nodiscard]] const T* data() const noexcept { return reinterpret_cast<const T*>( this->storage ); }
+  // True while the buffer holds the elements
+  bool                   in_use = false;
+  alignas(T) ::std::byte storage[ N * sizeof(T) ];
+};
+template < class T >
+struct inline_buffer< T, 0 > { };
+
 //==================================================================================================
 //  Is Complex returns true if the type is a complex type
 //==================================================================================================
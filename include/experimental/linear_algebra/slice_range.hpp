@@ -0,0 +1,280 @@
+//==================================================================================================
+//  File:       slice_range.hpp
+//
+//  Summary:    This header defines random-access ranges over the rows or columns of a matrix and
+//              over the slices of a tensor along one dimension. Each element of a range is a
+//              vector_view, matrix_view or tensor_view, so per-slice kernels may be handed to a
+//              single standard algorithm call, including the parallel overloads.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_SLICE_RANGE_HPP
+#define LINEAR_ALGEBRA_SLICE_RANGE_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Slice Along fixes index i of dimension Axis and keeps the full extent of every other dimension
+//==================================================================================================
+template < ::std::size_t Dim, ::std::size_t Axis, class IndexType >
+[[nodiscard]] constexpr auto slice_specifier( IndexType i ) noexcept
+{
+  if constexpr ( Dim == Axis )
+  {
+    return i;
+  }
+  else
+  {
+    return ::std::experimental::full_extent;
+  }
+}
+
+template < ::std::size_t Axis, class MDS, class IndexType, ::std::size_t ... Dims >
+[[nodiscard]] constexpr auto slice_along_impl( const MDS& span, IndexType i, ::std::index_sequence< Dims ... > )
+{
+  return ::std::experimental::submdspan( span, slice_specifier< Dims, Axis >( i ) ... );
+}
+
+template < ::std::size_t Axis, class MDS, class IndexType >
+[[nodiscard]] constexpr auto slice_along( const MDS& span, IndexType i )
+{
+  return slice_along_impl< Axis >( span, i, ::std::make_index_sequence< MDS::rank() >() );
+}
+
+//==================================================================================================
+//  Indexed Iterator is a random-access iterator over a range of views addressed by position.
+//  It holds a copy of the range, which must be cheap to copy, so iterators remain valid after the
+//  range is destroyed and may be split freely by parallel algorithms.
+//==================================================================================================
+template < class Range >
+class indexed_iterator
+{
+  public:
+    using value_type        = typename Range::value_type;
+    using difference_type   = typename Range::difference_type;
+    using reference         = typename Range::reference;
+    using pointer           = void;
+    using iterator_category = ::std::random_access_iterator_tag;
+    using iterator_concept  = ::std::random_access_iterator_tag;
+
+    constexpr indexed_iterator() noexcept = default;
+    constexpr indexed_iterator( const Range& range, difference_type index ) noexcept : range_( range ), index_( index ) { }
+
+    [[nodiscard]] constexpr reference operator *  () const { return this->range_[ this->index_ ]; }
+    [[nodiscard]] constexpr reference operator [] ( difference_type n ) const { return this->range_[ this->index_ + n ]; }
+
+    constexpr indexed_iterator&              operator ++ ()                          noexcept { ++this->index_; return *this; }
+    constexpr indexed_iterator               operator ++ ( int )                     noexcept { indexed_iterator it( *this ); ++this->index_; return it; }
+    constexpr indexed_iterator&              operator -- ()                          noexcept { --this->index_; return *this; }
+    constexpr indexed_iterator               operator -- ( int )                     noexcept { indexed_iterator it( *this ); --this->index_; return it; }
+    constexpr indexed_iterator&              operator += ( difference_type n )       noexcept { this->index_ += n; return *this; }
+    constexpr indexed_iterator&              operator -= ( difference_type n )       noexcept { this->index_ -= n; return *this; }
+    [[nodiscard]] constexpr indexed_iterator operator +  ( difference_type n ) const noexcept { return indexed_iterator( this->range_, this->index_ + n ); }
+    [[nodiscard]] constexpr indexed_iterator operator -  ( difference_type n ) const noexcept { return indexed_iterator( this->range_, this->index_ - n ); }
+    [[nodiscard]] friend constexpr indexed_iterator operator + ( difference_type n, const indexed_iterator& it ) noexcept { return it + n; }
+    [[nodiscard]] friend constexpr difference_type  operator - ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ - rhs.index_; }
+
+    [[nodiscard]] friend constexpr bool operator == ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ == rhs.index_; }
+    [[nodiscard]] friend constexpr bool operator != ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ != rhs.index_; }
+    [[nodiscard]] friend constexpr bool operator <  ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ <  rhs.index_; }
+    [[nodiscard]] friend constexpr bool operator >  ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ >  rhs.index_; }
+    [[nodiscard]] friend constexpr bool operator <= ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ <= rhs.index_; }
+    [[nodiscard]] friend constexpr bool operator >= ( const indexed_iterator& lhs, const indexed_iterator& rhs ) noexcept { return lhs.index_ >= rhs.index_; }
+
+  private:
+    Range           range_ {};
+    difference_type index_ = 0;
+};
+
+//==================================================================================================
+//  View Of defines the view type which portrays an mdspan of a given rank
+//==================================================================================================
+template < class MDS, ::std::size_t Rank = MDS::rank() >
+struct view_of { using type = tensor_view<MDS>; };
+template < class MDS >
+struct view_of< MDS, 1 > { using type = vector_view<MDS>; };
+template < class MDS >
+struct view_of< MDS, 2 > { using type = matrix_view<MDS>; };
+template < class MDS >
+using view_of_t = typename view_of<MDS>::type;
+
+}       //- detail namespace
+
+/// @brief Random-access range over the slices of an N dimensional view along one dimension.
+///        Slice i is the view of all elements whose index along Axis equals i. The range holds
+///        only a copy of the mdspan, so it and its iterators are cheap to construct and copy and
+///        may be split freely by parallel algorithms. Dereferencing yields a view by value.
+/// @tparam MDS  mdspan to be sliced
+/// @tparam Axis dimension along which slices are taken
+template < class MDS, ::std::size_t Axis >
+class slice_range
+{
+  static_assert( detail::is_mdspan_v<MDS>, "Slice ranges are defined over mdspans." );
+  static_assert( ( MDS::rank() > 1 ) && ( Axis < MDS::rank() ), "Axis must be a dimension of a view of rank two or more." );
+
+  public:
+    //- Types
+
+    /// @brief Type used to view memory
+    using underlying_span_type = MDS;
+    /// @brief Type used for indexing
+    using index_type           = ::std::ptrdiff_t;
+    /// @brief Type used for size of the range
+    using size_type            = ::std::size_t;
+    /// @brief Type used to express distance between slices
+    using difference_type      = ::std::ptrdiff_t;
+    /// @brief Type of each slice
+    using value_type           = detail::view_of_t< decltype( detail::slice_along<Axis>( ::std::declval<const underlying_span_type&>(), ::std::declval<index_type>() ) ) >;
+    /// @brief Type returned by dereferencing; slices are returned by value
+    using reference            = value_type;
+
+    /// @brief Random-access iterator over slices
+    using iterator             = detail::indexed_iterator<slice_range>;
+    /// @brief Slices are views, so iteration never mutates the range
+    using const_iterator       = iterator;
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr slice_range() noexcept = default;
+    /// @brief Construct from a view
+    /// @param span view to be sliced
+    explicit constexpr slice_range( const underlying_span_type& span ) noexcept;
+
+    //- Iterators
+
+    /// @brief Returns an iterator to the first slice
+    [[nodiscard]] constexpr iterator begin() const noexcept;
+    /// @brief Returns an iterator past the last slice
+    [[nodiscard]] constexpr iterator end() const noexcept;
+
+    //- Size
+
+    /// @brief Returns the number of slices
+    [[nodiscard]] constexpr size_type size() const noexcept;
+    /// @brief Returns true if there are no slices
+    [[nodiscard]] constexpr bool empty() const noexcept;
+
+    //- Data access
+
+    /// @brief Returns slice i without bounds checking
+    /// @param i index along Axis
+    /// @return view of slice i
+    [[nodiscard]] constexpr value_type operator[]( index_type i ) const;
+    /// @brief Returns the view being sliced
+    [[nodiscard]] constexpr const underlying_span_type& underlying_span() const noexcept;
+
+  private:
+    //- Data
+
+    /// @brief View being sliced
+    underlying_span_type span_ {};
+};
+
+//----------------------------------------------
+// Implementation of slice_range<MDS,Axis>
+//----------------------------------------------
+
+template < class MDS, ::std::size_t Axis >
+constexpr slice_range<MDS,Axis>::slice_range( const underlying_span_type& span ) noexcept :
+  span_( span )
+{
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr typename slice_range<MDS,Axis>::iterator slice_range<MDS,Axis>::begin() const noexcept
+{
+  return iterator( *this, 0 );
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr typename slice_range<MDS,Axis>::iterator slice_range<MDS,Axis>::end() const noexcept
+{
+  return iterator( *this, static_cast<index_type>( this->size() ) );
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr typename slice_range<MDS,Axis>::size_type slice_range<MDS,Axis>::size() const noexcept
+{
+  return static_cast<size_type>( this->span_.extent( Axis ) );
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr bool slice_range<MDS,Axis>::empty() const noexcept
+{
+  return this->size() == 0;
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr typename slice_range<MDS,Axis>::value_type slice_range<MDS,Axis>::operator[]( index_type i ) const
+{
+  return value_type( detail::slice_along<Axis>( this->span_, i ) );
+}
+
+template < class MDS, ::std::size_t Axis >
+[[nodiscard]] constexpr const typename slice_range<MDS,Axis>::underlying_span_type& slice_range<MDS,Axis>::underlying_span() const noexcept
+{
+  return this->span_;
+}
+
+//- Free functions
+
+/// @brief Returns a range over the slices of a tensor along dimension Axis
+/// @tparam Axis dimension along which slices are taken
+/// @param  t tensor or view to be sliced; must outlive the range
+/// @return random-access range of views
+#ifdef LINALG_ENABLE_CONCEPTS
+template < ::std::size_t Axis, class T >
+  requires ( ::std::decay_t< decltype( ::std::declval<T&>().underlying_span() ) >::rank() > Axis )
+#else
+template < ::std::size_t Axis, class T,
+           typename = ::std::enable_if_t< ( ::std::decay_t< decltype( ::std::declval<T&>().underlying_span() ) >::rank() > Axis ) > >
+#endif
+[[nodiscard]] constexpr auto slices( T& t ) noexcept
+{
+  using span_type = ::std::decay_t< decltype( t.underlying_span() ) >;
+  return slice_range< span_type, Axis >( t.underlying_span() );
+}
+
+/// @brief Returns a range over the rows of a matrix
+/// @param  m matrix or matrix view; must outlive the range
+/// @return random-access range of row vector views
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires ( ::std::decay_t< decltype( ::std::declval<M&>().underlying_span() ) >::rank() == 2 )
+#else
+template < class M,
+           typename = ::std::enable_if_t< ( ::std::decay_t< decltype( ::std::declval<M&>().underlying_span() ) >::rank() == 2 ) > >
+#endif
+[[nodiscard]] constexpr auto rows( M& m ) noexcept
+{
+  return slices<0>( m );
+}
+
+/// @brief Returns a range over the columns of a matrix
+/// @param  m matrix or matrix view; must outlive the range
+/// @return random-access range of column vector views
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires ( ::std::decay_t< decltype( ::std::declval<M&>().underlying_span() ) >::rank() == 2 )
+#else
+template < class M,
+           typename = ::std::enable_if_t< ( ::std::decay_t< decltype( ::std::declval<M&>().underlying_span() ) >::rank() == 2 ) > >
+#endif
+[[nodiscard]] constexpr auto columns( M& m ) noexcept
+{
+  return slices<1>( m );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_SLICE_RANGE_HPP
@@ -0,0 +1,587 @@
+//==================================================================================================
+//  File:       thread_pool.hpp
+//
+//  Summary:    This header defines a header-only work-stealing thread pool and an execution
+//              policy which targets it. The policy may be passed anywhere the library accepts an
+//              execution policy and does not depend upon the standard library's parallel
+//              algorithms being available.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_THREAD_POOL_HPP
+#define LINEAR_ALGEBRA_THREAD_POOL_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+// Number of worker threads used by the default thread pool.
+// If zero, then the hardware concurrency is used.
+#ifndef LINALG_THREAD_POOL_SIZE
+#  define LINALG_THREAD_POOL_SIZE 0
+#endif
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Work-stealing thread pool.
+///        Each worker owns a double-ended task queue. A worker pushes and pops tasks from the back
+///        of its own queue and steals from the front of the other queues when its own is empty.
+///        A thread waiting on a parallel_for helps execute pending tasks, so nested parallel loops
+///        are deadlock free. Tasks may also be pinned to a worker, in which case they are never
+///        stolen. Pinned tasks back the static partitioning used for NUMA first-touch placement.
+class thread_pool
+{
+  public:
+    //- Types
+
+    /// @brief Type used to express the number of threads, tasks, and grain size
+    using size_type = ::std::size_t;
+    /// @brief Type used to represent a unit of work
+    using task_type = ::std::function<void()>;
+
+    //- Destructor / Constructors / Assignments
+
+    /// @brief Joins all worker threads. Tasks which have already been queued are completed.
+    ~thread_pool();
+    /// @brief Constructs a thread pool with the specified number of worker threads
+    /// @param thread_count number of worker threads; if zero, then the hardware concurrency is used
+    explicit thread_pool( size_type thread_count = 0 );
+    /// @brief Thread pools are neither copyable nor movable
+    thread_pool( const thread_pool& )              = delete;
+    /// @brief Thread pools are neither copyable nor movable
+    thread_pool( thread_pool&& )                   = delete;
+    /// @brief Thread pools are neither copyable nor movable
+    thread_pool& operator = ( const thread_pool& ) = delete;
+    /// @brief Thread pools are neither copyable nor movable
+    thread_pool& operator = ( thread_pool&& )      = delete;
+
+    //- Size
+
+    /// @brief Returns the number of worker threads
+    /// @return number of worker threads
+    [[nodiscard]] size_type thread_count() const noexcept;
+
+    //- Execution
+
+    /// @brief Applies f to each element in the range [first,last) using the worker threads.
+    ///        The calling thread participates and returns once all elements have been visited.
+    ///        If any invocation of f throws, then the first exception caught is rethrown.
+    /// @tparam RandomIt random access iterator type
+    /// @tparam UnaryFunction function type invocable with the value type of RandomIt
+    /// @param first beginning of the range
+    /// @param last end of the range
+    /// @param f function to be applied
+    /// @param grain_size maximum number of elements processed by a single task; if zero, then a
+    ///                   grain size is chosen such that each thread receives several tasks
+    template < class RandomIt, class UnaryFunction >
+    void parallel_for( RandomIt first, RandomIt last, UnaryFunction&& f, size_type grain_size = 0 );
+    /// @brief Applies f to each element in the range [first,last) using the worker threads.
+    ///        The range is split into one contiguous partition per worker and each partition is
+    ///        always processed by the same worker (see partition), so memory first touched by a
+    ///        statically partitioned loop is later revisited by the same thread.
+    ///        If any invocation of f throws, then the first exception caught is rethrown.
+    /// @tparam RandomIt random access iterator type
+    /// @tparam UnaryFunction function type invocable with the value type of RandomIt
+    /// @param first beginning of the range
+    /// @param last end of the range
+    /// @param f function to be applied
+    template < class RandomIt, class UnaryFunction >
+    void parallel_for_static( RandomIt first, RandomIt last, UnaryFunction&& f );
+    /// @brief Returns the partition of a range assigned to a worker by parallel_for_static
+    /// @param size number of elements in the range
+    /// @param index index of the worker
+    /// @param count number of workers
+    /// @return offset of the first and one past the last element of the partition
+    [[nodiscard]] static constexpr ::std::pair<size_type,size_type> partition( size_type size, size_type index, size_type count ) noexcept;
+    /// @brief Queues a task for asynchronous execution by one of the worker threads and returns
+    ///        immediately. The task must not throw.
+    /// @param task task to be executed
+    void submit( task_type task );
+
+    //- Default pool
+
+    /// @brief Returns the pool used by default constructed thread pool policies.
+    ///        The pool is created on first use with LINALG_THREAD_POOL_SIZE worker threads.
+    /// @return default thread pool
+    [[nodiscard]] static thread_pool& default_pool();
+
+  private:
+    //- Types
+
+    /// @brief Per worker double-ended task queue
+    struct task_queue
+    {
+      ::std::mutex             mutex;
+      ::std::deque<task_type>  tasks;
+      ::std::deque<task_type>  pinned;
+      ::std::atomic<size_type> pinned_count { 0 };
+    };
+
+    //- Implementation
+
+    /// @brief Main loop executed by each of the worker threads
+    /// @param index index of the worker's own task queue
+    void work( size_type index );
+    /// @brief Pushes a task onto the specified queue and wakes a sleeping worker
+    /// @param index index of the queue
+    /// @param task task to be pushed
+    void push( size_type index, task_type&& task );
+    /// @brief Pushes a task which may only be executed by the specified worker
+    /// @param index index of the worker
+    /// @param task task to be pushed
+    void push_pinned( size_type index, task_type&& task );
+    /// @brief Pops a task pinned to the calling worker, pops from the back of the specified queue,
+    ///        or steals from the front of another queue
+    /// @param index index of the queue to be popped first
+    /// @param task on success, holds the popped task
+    /// @return true if a task was found
+    [[nodiscard]] bool try_pop( size_type index, task_type& task );
+    /// @brief Waits for the remaining count to reach zero while helping execute pending tasks
+    /// @param home index of the queue to be popped first
+    /// @param remaining count of outstanding tasks
+    void help_while( size_type home, const ::std::atomic<size_type>& remaining );
+    /// @brief Returns the queue index belonging to the calling thread if it is a worker of this pool.
+    ///        Otherwise, selects a queue in round robin fashion.
+    /// @return queue index
+    [[nodiscard]] size_type home_index() noexcept;
+
+    //- Data
+
+    /// @brief worker threads
+    ::std::vector< ::std::thread >    threads_;
+    /// @brief one task queue per worker
+    ::std::unique_ptr< task_queue[] > queues_;
+    /// @brief number of stealable tasks which have been pushed but not yet popped
+    ::std::atomic<size_type>          pending_;
+    /// @brief next queue used when pushing from a thread outside of the pool
+    ::std::atomic<size_type>          next_queue_;
+    /// @brief set when the pool is being destroyed
+    ::std::atomic<bool>               stop_;
+    /// @brief guards sleeping workers
+    ::std::mutex                      sleep_mutex_;
+    /// @brief signals sleeping workers
+    ::std::condition_variable         sleep_cv_;
+    /// @brief pool the calling thread is a worker of (if any)
+    inline static thread_local thread_pool* current_pool_  = nullptr;
+    /// @brief queue index owned by the calling thread (if it is a worker)
+    inline static thread_local size_type    current_index_ = 0;
+};
+
+/// @brief Execution policy which applies work on a thread_pool.
+///        A default constructed policy targets thread_pool::default_pool().
+class thread_pool_policy
+{
+  public:
+    //- Types
+
+    /// @brief Type used to express the grain size
+    using size_type = thread_pool::size_type;
+
+    //- Constructors
+
+    /// @brief Constructs a policy targeting the default pool with automatic grain size
+    constexpr thread_pool_policy() noexcept = default;
+    /// @brief Constructs a policy targeting the specified pool
+    /// @param pool thread pool on which work is applied
+    /// @param grain_size maximum number of elements processed by a single task; zero for automatic
+    constexpr explicit thread_pool_policy( thread_pool& pool, size_type grain_size = 0 ) noexcept;
+
+    //- Properties
+
+    /// @brief Returns the pool on which work is applied
+    /// @return thread pool
+    [[nodiscard]] thread_pool& pool() const;
+    /// @brief Returns the maximum number of elements processed by a single task
+    /// @return grain size, or zero for automatic
+    [[nodiscard]] constexpr size_type grain_size() const noexcept;
+    /// @brief Returns a copy of this policy with a different grain size
+    /// @param grain_size maximum number of elements processed by a single task; zero for automatic
+    /// @return policy
+    [[nodiscard]] constexpr thread_pool_policy with_grain_size( size_type grain_size ) const noexcept;
+    /// @brief Returns a copy of this policy targeting a different pool
+    /// @param pool thread pool on which work is applied
+    /// @return policy
+    [[nodiscard]] constexpr thread_pool_policy on( thread_pool& pool ) const noexcept;
+    /// @brief Returns true if work is statically partitioned across the workers
+    /// @return true if statically partitioned
+    [[nodiscard]] constexpr bool is_static() const noexcept;
+    /// @brief Returns a copy of this policy which statically partitions work across the workers.
+    ///        Each worker then always processes the same portion of a given range, so kernels
+    ///        given such a policy tend to revisit the pages their workers first touched.
+    /// @param is_static true for static partitioning, false for work-stealing
+    /// @return policy
+    [[nodiscard]] constexpr thread_pool_policy with_static_partitioning( bool is_static = true ) const noexcept;
+
+  private:
+    //- Data
+
+    /// @brief target pool; if null, then the default pool is used
+    thread_pool* pool_       = nullptr;
+    /// @brief maximum number of elements processed by a single task
+    size_type    grain_size_ = 0;
+    /// @brief if true, then work is statically partitioned across the workers
+    bool         is_static_  = false;
+};
+
+namespace detail
+{
+
+//==================================================================================================
+//  Is Thread Pool Policy returns true if the Execution Policy targets the library thread pool
+//==================================================================================================
+template < class T >
+inline constexpr bool is_thread_pool_policy_v = ::std::is_same_v< ::std::decay_t<T>, thread_pool_policy >;
+
+}       //- detail namespace
+
+//------------------------------------------
+// Implementation of thread_pool
+//------------------------------------------
+
+//- Destructor / Constructors / Assignments
+
+inline thread_pool::~thread_pool()
+{
+  {
+    ::std::lock_guard<::std::mutex> lock( this->sleep_mutex_ );
+    this->stop_.store( true );
+  }
+  this->sleep_cv_.notify_all();
+  for ( auto& thread : this->threads_ )
+  {
+    thread.join();
+  }
+}
+
+inline thread_pool::thread_pool( size_type thread_count ) :
+  threads_(),
+  queues_(),
+  pending_( 0 ),
+  next_queue_( 0 ),
+  stop_( false ),
+  sleep_mutex_(),
+  sleep_cv_()
+{
+  if ( thread_count == 0 )
+  {
+    thread_count = ::std::max< size_type >( ::std::thread::hardware_concurrency(), 1 );
+  }
+  this->queues_ = ::std::make_unique< task_queue[] >( thread_count );
+  this->threads_.reserve( thread_count );
+  for ( size_type index = 0; index < thread_count; ++index )
+  {
+    this->threads_.emplace_back( [this,index]() { this->work( index ); } );
+  }
+}
+
+//- Size
+
+[[nodiscard]] inline thread_pool::size_type thread_pool::thread_count() const noexcept
+{
+  return this->threads_.size();
+}
+
+//- Execution
+
+template < class RandomIt, class UnaryFunction >
+void thread_pool::parallel_for( RandomIt first, RandomIt last, UnaryFunction&& f, size_type grain_size )
+{
+  const size_type size = static_cast<size_type>( last - first );
+  if ( size == 0 ) LINALG_UNLIKELY
+  {
+    return;
+  }
+  // Default grain size leaves several tasks per thread so idle threads have something to steal
+  if ( grain_size == 0 )
+  {
+    grain_size = ::std::max< size_type >( size / ( 4 * ( this->thread_count() + 1 ) ), 1 );
+  }
+  const size_type task_count = ( size + grain_size - 1 ) / grain_size;
+  // Applies f to a single chunk
+  auto apply_chunk = [first,size,grain_size,&f]( size_type chunk )
+  {
+    RandomIt begin = first;
+    begin += static_cast< typename ::std::iterator_traits<RandomIt>::difference_type >( chunk * grain_size );
+    for ( size_type count = ::std::min( grain_size, size - chunk * grain_size ); count > 0; --count, ++begin )
+    {
+      f( *begin );
+    }
+  };
+  if ( task_count == 1 )
+  {
+    apply_chunk( 0 );
+    return;
+  }
+  // Shared state between the calling thread and the tasks
+  ::std::atomic<size_type> remaining( task_count - 1 );
+  ::std::exception_ptr     eptr;
+  ::std::mutex             eptr_mutex;
+  // Queue all but the first chunk
+  const size_type home = this->home_index();
+  const bool      is_worker = ( current_pool_ == this );
+  for ( size_type chunk = 1; chunk < task_count; ++chunk )
+  {
+    this->push( is_worker ? home : ( home + chunk ) % this->thread_count(),
+                [&apply_chunk,&remaining,&eptr,&eptr_mutex,chunk]()
+                {
+                  try { apply_chunk( chunk ); }
+                  catch ( ... )
+                  {
+                    ::std::lock_guard<::std::mutex> lock( eptr_mutex );
+                    if ( !eptr ) eptr = ::std::current_exception();
+                  }
+                  static_cast<void>( remaining.fetch_sub( 1, ::std::memory_order_acq_rel ) );
+                } );
+  }
+  // Calling thread processes the first chunk
+  try { apply_chunk( 0 ); }
+  catch ( ... )
+  {
+    ::std::lock_guard<::std::mutex> lock( eptr_mutex );
+    if ( !eptr ) eptr = ::std::current_exception();
+  }
+  // Help execute pending tasks until all chunks are complete
+  this->help_while( home, remaining );
+  // If exceptions were thrown, rethrow the first
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+template < class RandomIt, class UnaryFunction >
+void thread_pool::parallel_for_static( RandomIt first, RandomIt last, UnaryFunction&& f )
+{
+  const size_type size  = static_cast<size_type>( last - first );
+  const size_type count = this->thread_count();
+  if ( size == 0 ) LINALG_UNLIKELY
+  {
+    return;
+  }
+  // Shared state between the calling thread and the tasks
+  ::std::atomic<size_type> remaining( count );
+  ::std::exception_ptr     eptr;
+  ::std::mutex             eptr_mutex;
+  // Pin one partition to each worker
+  for ( size_type index = 0; index < count; ++index )
+  {
+    this->push_pinned( index,
+                       [first,size,count,index,&f,&remaining,&eptr,&eptr_mutex]()
+                       {
+                         const auto [ begin, end ] = partition( size, index, count );
+                         RandomIt it = first;
+                         it += static_cast< typename ::std::iterator_traits<RandomIt>::difference_type >( begin );
+                         try
+                         {
+                           for ( size_type offset = begin; offset < end; ++offset, ++it )
+                           {
+                             f( *it );
+                           }
+                         }
+                         catch ( ... )
+                         {
+                           ::std::lock_guard<::std::mutex> lock( eptr_mutex );
+                           if ( !eptr ) eptr = ::std::current_exception();
+                         }
+                         static_cast<void>( remaining.fetch_sub( 1, ::std::memory_order_acq_rel ) );
+                       } );
+  }
+  // Help execute pending tasks until all partitions are complete
+  this->help_while( this->home_index(), remaining );
+  // If exceptions were thrown, rethrow the first
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+[[nodiscard]] constexpr ::std::pair<thread_pool::size_type,thread_pool::size_type>
+thread_pool::partition( size_type size, size_type index, size_type count ) noexcept
+{
+  // The first ( size % count ) partitions receive one additional element
+  const size_type base      = size / count;
+  const size_type remainder = size % count;
+  const size_type begin     = index * base + ::std::min( index, remainder );
+  return { begin, begin + base + ( ( index < remainder ) ? 1 : 0 ) };
+}
+
+inline void thread_pool::submit( task_type task )
+{
+  this->push( this->home_index(), ::std::move( task ) );
+}
+
+//- Default pool
+
+[[nodiscard]] inline thread_pool& thread_pool::default_pool()
+{
+  static thread_pool pool( LINALG_THREAD_POOL_SIZE );
+  return pool;
+}
+
+//- Implementation
+
+inline void thread_pool::work( size_type index )
+{
+  current_pool_  = this;
+  current_index_ = index;
+  while ( true )
+  {
+    task_type task;
+    if ( this->try_pop( index, task ) )
+    {
+      task();
+      continue;
+    }
+    ::std::unique_lock<::std::mutex> lock( this->sleep_mutex_ );
+    this->sleep_cv_.wait( lock, [this,index]() { return this->stop_.load() ||
+                                                        ( this->pending_.load() > 0 ) ||
+                                                        ( this->queues_[index].pinned_count.load() > 0 ); } );
+    if ( this->stop_.load() && ( this->pending_.load() == 0 ) && ( this->queues_[index].pinned_count.load() == 0 ) )
+    {
+      return;
+    }
+  }
+}
+
+inline void thread_pool::push( size_type index, task_type&& task )
+{
+  {
+    ::std::lock_guard<::std::mutex> lock( this->queues_[index].mutex );
+    this->queues_[index].tasks.push_back( ::std::move( task ) );
+  }
+  static_cast<void>( this->pending_.fetch_add( 1, ::std::memory_order_acq_rel ) );
+  // Synchronize with a worker about to sleep so the notification cannot be lost
+  { ::std::lock_guard<::std::mutex> lock( this->sleep_mutex_ ); }
+  this->sleep_cv_.notify_one();
+}
+
+inline void thread_pool::push_pinned( size_type index, task_type&& task )
+{
+  {
+    ::std::lock_guard<::std::mutex> lock( this->queues_[index].mutex );
+    this->queues_[index].pinned.push_back( ::std::move( task ) );
+  }
+  static_cast<void>( this->queues_[index].pinned_count.fetch_add( 1, ::std::memory_order_acq_rel ) );
+  // Only the owning worker may run the task, so every sleeping worker must be woken
+  { ::std::lock_guard<::std::mutex> lock( this->sleep_mutex_ ); }
+  this->sleep_cv_.notify_all();
+}
+
+[[nodiscard]] inline bool thread_pool::try_pop( size_type index, task_type& task )
+{
+  const size_type count = this->thread_count();
+  // Pop from the back of the own queue, preferring tasks pinned to the calling worker
+  {
+    ::std::lock_guard<::std::mutex> lock( this->queues_[index].mutex );
+    if ( ( current_pool_ == this ) && ( current_index_ == index ) && !this->queues_[index].pinned.empty() )
+    {
+      task = ::std::move( this->queues_[index].pinned.front() );
+      this->queues_[index].pinned.pop_front();
+      static_cast<void>( this->queues_[index].pinned_count.fetch_sub( 1, ::std::memory_order_acq_rel ) );
+      return true;
+    }
+    if ( !this->queues_[index].tasks.empty() )
+    {
+      task = ::std::move( this->queues_[index].tasks.back() );
+      this->queues_[index].tasks.pop_back();
+      static_cast<void>( this->pending_.fetch_sub( 1, ::std::memory_order_acq_rel ) );
+      return true;
+    }
+  }
+  // Steal from the front of the other queues
+  for ( size_type offset = 1; offset < count; ++offset )
+  {
+    task_queue& victim = this->queues_[ ( index + offset ) % count ];
+    ::std::lock_guard<::std::mutex> lock( victim.mutex );
+    if ( !victim.tasks.empty() )
+    {
+      task = ::std::move( victim.tasks.front() );
+      victim.tasks.pop_front();
+      static_cast<void>( this->pending_.fetch_sub( 1, ::std::memory_order_acq_rel ) );
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void thread_pool::help_while( size_type home, const ::std::atomic<size_type>& remaining )
+{
+  while ( remaining.load( ::std::memory_order_acquire ) > 0 )
+  {
+    task_type task;
+    if ( this->try_pop( home, task ) )
+    {
+      task();
+    }
+    else
+    {
+      ::std::this_thread::yield();
+    }
+  }
+}
+
+[[nodiscard]] inline thread_pool::size_type thread_pool::home_index() noexcept
+{
+  if ( current_pool_ == this )
+  {
+    return current_index_;
+  }
+  return this->next_queue_.fetch_add( 1, ::std::memory_order_relaxed ) % this->thread_count();
+}
+
+//------------------------------------------
+// Implementation of thread_pool_policy
+//------------------------------------------
+
+//- Constructors
+
+constexpr thread_pool_policy::thread_pool_policy( thread_pool& pool, size_type grain_size ) noexcept :
+  pool_( &pool ),
+  grain_size_( grain_size )
+{
+}
+
+//- Properties
+
+[[nodiscard]] inline thread_pool& thread_pool_policy::pool() const
+{
+  return this->pool_ ? *this->pool_ : thread_pool::default_pool();
+}
+
+[[nodiscard]] constexpr thread_pool_policy::size_type thread_pool_policy::grain_size() const noexcept
+{
+  return this->grain_size_;
+}
+
+[[nodiscard]] constexpr thread_pool_policy thread_pool_policy::with_grain_size( size_type grain_size ) const noexcept
+{
+  thread_pool_policy policy( *this );
+  policy.grain_size_ = grain_size;
+  return policy;
+}
+
+[[nodiscard]] constexpr thread_pool_policy thread_pool_policy::on( thread_pool& pool ) const noexcept
+{
+  thread_pool_policy policy( *this );
+  policy.pool_ = &pool;
+  return policy;
+}
+
+[[nodiscard]] constexpr bool thread_pool_policy::is_static() const noexcept
+{
+  return this->is_static_;
+}
+
+[[nodiscard]] constexpr thread_pool_policy thread_pool_policy::with_static_partitioning( bool is_static ) const noexcept
+{
+  thread_pool_policy policy( *this );
+  policy.is_static_ = is_static;
+  return policy;
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_THREAD_POOL_HPP
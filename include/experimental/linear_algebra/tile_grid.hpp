@@ -0,0 +1,267 @@
+//==================================================================================================
+//  File:       tile_grid.hpp
+//
+//  Summary:    This header defines a grid decomposition of a matrix or tensor into tiles of a
+//              fixed nominal extent. Tiles along the trailing edge of each dimension are ragged,
+//              i.e. they hold only the remaining elements. The grid is a random-access range of
+//              views and serves as the work partitioning primitive for blocked and parallel kernels.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TILE_GRID_HPP
+#define LINEAR_ALGEBRA_TILE_GRID_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+namespace detail
+{
+
+//==================================================================================================
+//  Tile Of returns the view of the tile which starts at first and has at most tile extents,
+//  clipped to the extents of the view
+//==================================================================================================
+template < class MDS, class Array, ::std::size_t ... Dims >
+[[nodiscard]] constexpr auto tile_of_impl( const MDS& span, const Array& first, const Array& tile_extents, ::std::index_sequence< Dims ... > )
+{
+  using index_type = ::std::ptrdiff_t;
+  return ::std::experimental::submdspan( span,
+    ::std::tuple<index_type,index_type>( static_cast<index_type>( first[Dims] ),
+                                         static_cast<index_type>( ::std::min<::std::size_t>( first[Dims] + tile_extents[Dims], span.extent( Dims ) ) ) ) ... );
+}
+
+template < class MDS, class Array >
+[[nodiscard]] constexpr auto tile_of( const MDS& span, const Array& first, const Array& tile_extents )
+{
+  return tile_of_impl( span, first, tile_extents, ::std::make_index_sequence< MDS::rank() >() );
+}
+
+}       //- detail namespace
+
+/// @brief Random-access range over a grid of tiles covering an N dimensional view.
+///        Tile extents are nominal; tiles on the trailing edge of a dimension are clipped to the
+///        view. Tiles are addressed either by grid position or by linear position, in which the
+///        last grid dimension varies fastest. The grid holds only a copy of the mdspan and of the
+///        extents, so it and its iterators may be split freely by parallel algorithms.
+/// @tparam MDS mdspan to be tiled
+template < class MDS >
+class tile_grid
+{
+  static_assert( detail::is_mdspan_v<MDS>, "Tile grids are defined over mdspans." );
+
+  public:
+    //- Types
+
+    /// @brief Type used to view memory
+    using underlying_span_type = MDS;
+    /// @brief Type used for indexing
+    using index_type           = ::std::ptrdiff_t;
+    /// @brief Type used for size along any dimension
+    using size_type            = ::std::size_t;
+    /// @brief Type used to express distance between tiles
+    using difference_type      = ::std::ptrdiff_t;
+    /// @brief Type used to hold an extent or a position per dimension
+    using extents_array_type   = ::std::array< size_type, MDS::rank() >;
+    /// @brief Type of each tile
+    using value_type           = detail::view_of_t< decltype( detail::tile_of( ::std::declval<const underlying_span_type&>(),
+                                                                               ::std::declval<const extents_array_type&>(),
+                                                                               ::std::declval<const extents_array_type&>() ) ) >;
+    /// @brief Type returned by dereferencing; tiles are returned by value
+    using reference            = value_type;
+    /// @brief Random-access iterator over tiles in linear order
+    using iterator             = detail::indexed_iterator<tile_grid>;
+    /// @brief Tiles are views, so iteration never mutates the grid
+    using const_iterator       = iterator;
+
+    //- Constructors
+
+    /// @brief Default constructor
+    constexpr tile_grid() noexcept = default;
+    /// @brief Construct from a view and the nominal extents of each tile
+    /// @param span         view to be tiled
+    /// @param tile_extents nominal extents of each tile
+    /// @throws length_error if a tile extent is zero
+    template < class SizeType, ::std::size_t ... Extents >
+    constexpr tile_grid( const underlying_span_type& span, const ::std::experimental::extents<SizeType,Extents...>& tile_extents );
+
+    //- Size
+
+    /// @brief Returns the rank of the grid, which is the rank of the view
+    [[nodiscard]] static constexpr size_type rank() noexcept { return MDS::rank(); }
+    /// @brief Returns the number of tiles along a dimension
+    /// @param dim dimension
+    [[nodiscard]] constexpr size_type extent( size_type dim ) const noexcept;
+    /// @brief Returns the nominal extent of a tile along a dimension
+    /// @param dim dimension
+    [[nodiscard]] constexpr size_type tile_extent( size_type dim ) const noexcept;
+    /// @brief Returns the total number of tiles
+    [[nodiscard]] constexpr size_type size() const noexcept;
+    /// @brief Returns true if there are no tiles
+    [[nodiscard]] constexpr bool empty() const noexcept;
+
+    //- Iterators
+
+    /// @brief Returns an iterator to the first tile
+    [[nodiscard]] constexpr iterator begin() const noexcept;
+    /// @brief Returns an iterator past the last tile
+    [[nodiscard]] constexpr iterator end() const noexcept;
+
+    //- Data access
+
+    /// @brief Returns the tile at linear position n without bounds checking
+    /// @param n linear position of the tile
+    /// @return view of the tile
+    [[nodiscard]] constexpr value_type operator[]( index_type n ) const;
+    /// @brief Returns the tile at a grid position without bounds checking
+    /// @param indices grid position of the tile
+    /// @return view of the tile
+    template < class ... IndexType >
+    [[nodiscard]] constexpr value_type tile( IndexType ... indices ) const
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ( sizeof...(IndexType) == MDS::rank() );
+    #else
+      ;
+    #endif
+    /// @brief Returns the view being tiled
+    [[nodiscard]] constexpr const underlying_span_type& underlying_span() const noexcept;
+
+  private:
+    //- Data
+
+    /// @brief View being tiled
+    underlying_span_type span_ {};
+    /// @brief Nominal extents of each tile
+    extents_array_type   tile_extents_ {};
+    /// @brief Number of tiles along each dimension
+    extents_array_type   grid_extents_ {};
+};
+
+//----------------------------------------------
+// Implementation of tile_grid<MDS>
+//----------------------------------------------
+
+template < class MDS >
+template < class SizeType, ::std::size_t ... Extents >
+constexpr tile_grid<MDS>::tile_grid( const underlying_span_type& span, const ::std::experimental::extents<SizeType,Extents...>& tile_extents ) :
+  span_( span )
+{
+  static_assert( sizeof...(Extents) == MDS::rank(), "Tile extents must have the rank of the view." );
+  for ( size_type dim = 0; dim < MDS::rank(); ++dim )
+  {
+    const size_type extent = static_cast<size_type>( tile_extents.extent( dim ) );
+    if ( extent == 0 ) LINALG_UNLIKELY
+    {
+      throw length_error( "Tile extents must be positive." );
+    }
+    this->tile_extents_[dim] = extent;
+    this->grid_extents_[dim] = ( static_cast<size_type>( span.extent( dim ) ) + extent - 1 ) / extent;
+  }
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::size_type tile_grid<MDS>::extent( size_type dim ) const noexcept
+{
+  return this->grid_extents_[dim];
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::size_type tile_grid<MDS>::tile_extent( size_type dim ) const noexcept
+{
+  return this->tile_extents_[dim];
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::size_type tile_grid<MDS>::size() const noexcept
+{
+  size_type count = 1;
+  for ( size_type dim = 0; dim < MDS::rank(); ++dim )
+  {
+    count *= this->grid_extents_[dim];
+  }
+  return count;
+}
+
+template < class MDS >
+[[nodiscard]] constexpr bool tile_grid<MDS>::empty() const noexcept
+{
+  return this->size() == 0;
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::iterator tile_grid<MDS>::begin() const noexcept
+{
+  return iterator( *this, 0 );
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::iterator tile_grid<MDS>::end() const noexcept
+{
+  return iterator( *this, static_cast<difference_type>( this->size() ) );
+}
+
+template < class MDS >
+[[nodiscard]] constexpr typename tile_grid<MDS>::value_type tile_grid<MDS>::operator[]( index_type n ) const
+{
+  // Decompose the linear position into the first element of the tile, last dimension fastest
+  extents_array_type first {};
+  size_type          position = static_cast<size_type>( n );
+  for ( size_type dim = MDS::rank(); dim-- > 0; )
+  {
+    first[dim] = ( position % this->grid_extents_[dim] ) * this->tile_extents_[dim];
+    position  /= this->grid_extents_[dim];
+  }
+  return value_type( detail::tile_of( this->span_, first, this->tile_extents_ ) );
+}
+
+template < class MDS >
+template < class ... IndexType >
+[[nodiscard]] constexpr typename tile_grid<MDS>::value_type tile_grid<MDS>::tile( IndexType ... indices ) const
+#ifdef LINALG_ENABLE_CONCEPTS
+  requires ( sizeof...(IndexType) == MDS::rank() )
+#endif
+{
+  #ifndef LINALG_ENABLE_CONCEPTS
+  static_assert( sizeof...(IndexType) == MDS::rank(), "A tile is addressed by one index per dimension." );
+  #endif
+  extents_array_type first { static_cast<size_type>( indices ) ... };
+  for ( size_type dim = 0; dim < MDS::rank(); ++dim )
+  {
+    first[dim] *= this->tile_extents_[dim];
+  }
+  return value_type( detail::tile_of( this->span_, first, this->tile_extents_ ) );
+}
+
+template < class MDS >
+[[nodiscard]] constexpr const typename tile_grid<MDS>::underlying_span_type& tile_grid<MDS>::underlying_span() const noexcept
+{
+  return this->span_;
+}
+
+//- Free functions
+
+/// @brief Returns a grid of tiles covering a matrix or tensor
+/// @param  t            matrix, tensor or view to be tiled; must outlive the grid
+/// @param  tile_extents nominal extents of each tile
+/// @return random-access range of matrix or tensor views
+/// @throws length_error if a tile extent is zero
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class T, class SizeType, ::std::size_t ... Extents >
+  requires ( ::std::decay_t< decltype( ::std::declval<T&>().underlying_span() ) >::rank() == sizeof...(Extents) )
+#else
+template < class T, class SizeType, ::std::size_t ... Extents,
+           typename = ::std::enable_if_t< ( ::std::decay_t< decltype( ::std::declval<T&>().underlying_span() ) >::rank() == sizeof...(Extents) ) > >
+#endif
+[[nodiscard]] constexpr auto tiles( T& t, const ::std::experimental::extents<SizeType,Extents...>& tile_extents )
+{
+  using span_type = ::std::decay_t< decltype( t.underlying_span() ) >;
+  return tile_grid<span_type>( t.underlying_span(), tile_extents );
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_TILE_GRID_HPP
@@ -0,0 +1,330 @@
+//==================================================================================================
+//  File:       tiled_layout.hpp
+//
+//  Summary:    This header defines a tiled (blocked) layout policy for matrices. Elements are
+//              stored in contiguous tiles of a fixed compile-time size, so every tile occupies a
+//              whole number of consecutive cache lines. Views into a tiled matrix (submatrices,
+//              rows and columns) remain tiled, so kernels may traverse them tile by tile.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_TILED_LAYOUT_HPP
+#define LINEAR_ALGEBRA_TILED_LAYOUT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+namespace std
+{
+namespace experimental
+{
+namespace math
+{
+
+/// @brief Layout policy storing a matrix as a grid of RowTile x ColTile tiles. Tiles are ordered
+///        row-major across the matrix and elements are ordered row-major within each tile. Tiles
+///        on the trailing edges are stored whole, so the storage of an m x n matrix holds
+///        ceil(m/RowTile) * ceil(n/ColTile) tiles.
+///        Mappings of rank two describe a matrix or a submatrix, mappings of rank one a (partial)
+///        row or column, and mappings of rank zero a single element of a tiled matrix.
+/// @tparam RowTile number of rows in a tile
+/// @tparam ColTile number of columns in a tile
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+struct layout_tiled
+{
+  static_assert( ( RowTile > 0 ) && ( ColTile > 0 ), "Tile extents must be positive." );
+
+  /// @brief Number of rows in a tile
+  static constexpr ::std::size_t row_tile  = RowTile;
+  /// @brief Number of columns in a tile
+  static constexpr ::std::size_t col_tile  = ColTile;
+  /// @brief Number of elements in a tile
+  static constexpr ::std::size_t tile_size = RowTile * ColTile;
+
+  /// @brief Maps indices of a (sub)view of a tiled matrix to offsets
+  /// @tparam Extents extents of the view
+  template < class Extents >
+  class mapping
+  {
+    static_assert( Extents::rank() <= 2, "Tiled layouts describe matrices and their subviews." );
+
+    public:
+      //- Types
+
+      /// @brief Type used to express the extents of the view
+      using extents_type = Extents;
+      /// @brief Type used for indices and offsets
+      using index_type   = typename extents_type::index_type;
+      /// @brief Type used for sizes
+      using size_type    = typename extents_type::size_type;
+      /// @brief Type used for ranks
+      using rank_type    = typename extents_type::rank_type;
+      /// @brief Layout policy of the mapping
+      using layout_type  = layout_tiled;
+
+      //- Constructors
+
+      /// @brief Default constructor
+      constexpr mapping() noexcept = default;
+      /// @brief Constructs the mapping of a whole tiled matrix of the given extents
+      /// @param extents extents of the matrix
+      constexpr mapping( const extents_type& extents ) noexcept;
+      /// @brief Constructs the mapping of a view into a tiled matrix
+      /// @param extents      extents of the view
+      /// @param tile_columns number of tiles along each row of the matrix
+      /// @param row_origin   row of the first element of the view within its tile
+      /// @param col_origin   column of the first element of the view within its tile
+      /// @param axis         dimension of the matrix along which a view of rank one runs
+      constexpr mapping( const extents_type& extents, index_type tile_columns, index_type row_origin, index_type col_origin, rank_type axis = 0 ) noexcept;
+      /// @brief Converting constructor from a mapping with compatible extents
+      template < class OtherExtents, typename = ::std::enable_if_t< ::std::is_constructible_v< extents_type, OtherExtents > > >
+      constexpr mapping( const mapping<OtherExtents>& rhs ) noexcept;
+
+      //- Observers
+
+      /// @brief Returns the extents of the view
+      [[nodiscard]] constexpr const extents_type& extents() const noexcept { return this->extents_; }
+      /// @brief Returns the number of tiles along each row of the matrix
+      [[nodiscard]] constexpr index_type tile_columns() const noexcept { return this->tile_columns_; }
+      /// @brief Returns the position of the first element of the view within its tile
+      /// @param dim dimension of the matrix (0 for rows, 1 for columns)
+      [[nodiscard]] constexpr index_type tile_origin( rank_type dim ) const noexcept { return ( dim == 0 ) ? this->row_origin_ : this->col_origin_; }
+      /// @brief Returns the dimension of the matrix along which a view of rank one runs
+      [[nodiscard]] constexpr rank_type axis() const noexcept { return this->axis_; }
+      /// @brief Returns the number of elements spanned, up to the end of the last tile touched
+      [[nodiscard]] constexpr index_type required_span_size() const noexcept;
+
+      //- Mapping
+
+      /// @brief Returns the offset of the element at the given indices
+      template < class ... Indices >
+      [[nodiscard]] constexpr index_type operator()( Indices ... indices ) const noexcept;
+
+      //- Properties
+
+      [[nodiscard]] static constexpr bool is_always_unique() noexcept     { return true; }
+      [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept { return false; }
+      [[nodiscard]] static constexpr bool is_always_strided() noexcept    { return false; }
+      [[nodiscard]] static constexpr bool is_unique() noexcept            { return true; }
+      [[nodiscard]] static constexpr bool is_exhaustive() noexcept        { return false; }
+      [[nodiscard]] static constexpr bool is_strided() noexcept           { return false; }
+
+      /// @brief Mappings are equal if they map every index to the same offset
+      [[nodiscard]] friend constexpr bool operator == ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return ( lhs.extents() == rhs.extents() ) && ( lhs.tile_columns() == rhs.tile_columns() ) &&
+               ( lhs.tile_origin( 0 ) == rhs.tile_origin( 0 ) ) && ( lhs.tile_origin( 1 ) == rhs.tile_origin( 1 ) ) &&
+               ( lhs.axis() == rhs.axis() );
+      }
+      [[nodiscard]] friend constexpr bool operator != ( const mapping& lhs, const mapping& rhs ) noexcept
+      {
+        return !( lhs == rhs );
+      }
+
+      /// @brief Returns the mapping and offset of a subview; found by submdspan through ADL
+      template < class ... Slices >
+      [[nodiscard]] friend constexpr auto submdspan_mapping( const mapping& src, Slices ... slices )
+      {
+        return src.submapping( slices ... );
+      }
+
+    private:
+      //- Implementation
+
+      /// @brief Returns the matrix position, relative to the first tile, of the element at the given indices
+      template < class ... Indices >
+      [[nodiscard]] constexpr ::std::array<index_type,2> position( Indices ... indices ) const noexcept;
+      /// @brief Returns the offset of the element at a position relative to the first tile
+      [[nodiscard]] constexpr index_type offset( index_type row, index_type col ) const noexcept;
+      /// @brief Returns the mapping and offset of a subview
+      template < class ... Slices >
+      [[nodiscard]] constexpr auto submapping( Slices ... slices ) const;
+
+      //- Data
+
+      /// @brief Extents of the view
+      extents_type extents_ {};
+      /// @brief Number of tiles along each row of the matrix
+      index_type   tile_columns_ = 0;
+      /// @brief Row of the first element of the view within its tile
+      index_type   row_origin_ = 0;
+      /// @brief Column of the first element of the view within its tile
+      index_type   col_origin_ = 0;
+      /// @brief Dimension of the matrix along which a view of rank one runs
+      rank_type    axis_ = 0;
+
+      template < class > friend class mapping;
+  };
+};
+
+namespace detail
+{
+
+//==================================================================================================
+//  Tiled Layout traits
+//==================================================================================================
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+struct is_tiled_layout< layout_tiled<RowTile,ColTile> > : public ::std::true_type { };
+
+/// @brief Returns the capacity rounded up to a whole number of tiles if the layout is tiled
+template < class Layout, class Extents >
+[[nodiscard]] constexpr Extents tile_rounded_extents( const Extents& s ) noexcept
+{
+  if constexpr ( is_tiled_layout_v<Layout> && ( Extents::rank() == 2 ) )
+  {
+    using index_type = typename Extents::index_type;
+    constexpr index_type row_tile = static_cast<index_type>( Layout::row_tile );
+    constexpr index_type col_tile = static_cast<index_type>( Layout::col_tile );
+    return Extents( ( ( s.extent(0) + row_tile - 1 ) / row_tile ) * row_tile,
+                    ( ( s.extent(1) + col_tile - 1 ) / col_tile ) * col_tile );
+  }
+  else
+  {
+    return s;
+  }
+}
+
+}       //- detail namespace
+
+//----------------------------------------------
+// Implementation of layout_tiled<RowTile,ColTile>::mapping<Extents>
+//----------------------------------------------
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+constexpr layout_tiled<RowTile,ColTile>::mapping<Extents>::mapping( const extents_type& extents ) noexcept :
+  extents_( extents ),
+  tile_columns_( ( Extents::rank() == 2 ) ? static_cast<index_type>( ( extents.extent( Extents::rank() - 1 ) + ColTile - 1 ) / ColTile ) : index_type( 1 ) ),
+  row_origin_( 0 ),
+  col_origin_( 0 ),
+  axis_( ( Extents::rank() == 1 ) ? rank_type( 1 ) : rank_type( 0 ) )
+{
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+constexpr layout_tiled<RowTile,ColTile>::mapping<Extents>::mapping( const extents_type& extents, index_type tile_columns, index_type row_origin, index_type col_origin, rank_type axis ) noexcept :
+  extents_( extents ),
+  tile_columns_( tile_columns ),
+  row_origin_( row_origin ),
+  col_origin_( col_origin ),
+  axis_( axis )
+{
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+template < class OtherExtents, typename >
+constexpr layout_tiled<RowTile,ColTile>::mapping<Extents>::mapping( const mapping<OtherExtents>& rhs ) noexcept :
+  extents_( rhs.extents_ ),
+  tile_columns_( static_cast<index_type>( rhs.tile_columns_ ) ),
+  row_origin_( static_cast<index_type>( rhs.row_origin_ ) ),
+  col_origin_( static_cast<index_type>( rhs.col_origin_ ) ),
+  axis_( rhs.axis_ )
+{
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+[[nodiscard]] constexpr typename layout_tiled<RowTile,ColTile>::template mapping<Extents>::index_type
+layout_tiled<RowTile,ColTile>::mapping<Extents>::required_span_size() const noexcept
+{
+  index_type last[ ( Extents::rank() > 0 ) ? Extents::rank() : 1 ] {};
+  for ( rank_type dim = 0; dim < Extents::rank(); ++dim )
+  {
+    if ( this->extents_.extent( dim ) == 0 )
+    {
+      return 0;
+    }
+    last[dim] = this->extents_.extent( dim ) - 1;
+  }
+  // Offset of the start of the tile holding the last element, plus one tile
+  ::std::array<index_type,2> pos {};
+  if constexpr ( Extents::rank() == 2 )
+  {
+    pos = this->position( last[0], last[1] );
+  }
+  else if constexpr ( Extents::rank() == 1 )
+  {
+    pos = this->position( last[0] );
+  }
+  else
+  {
+    pos = this->position();
+  }
+  return this->offset( ( pos[0] / RowTile ) * RowTile, ( pos[1] / ColTile ) * ColTile ) + static_cast<index_type>( tile_size );
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+template < class ... Indices >
+[[nodiscard]] constexpr typename layout_tiled<RowTile,ColTile>::template mapping<Extents>::index_type
+layout_tiled<RowTile,ColTile>::mapping<Extents>::operator()( Indices ... indices ) const noexcept
+{
+  const ::std::array<index_type,2> pos = this->position( indices ... );
+  return this->offset( pos[0], pos[1] );
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+template < class ... Indices >
+[[nodiscard]] constexpr ::std::array< typename layout_tiled<RowTile,ColTile>::template mapping<Extents>::index_type, 2 >
+layout_tiled<RowTile,ColTile>::mapping<Extents>::position( Indices ... indices ) const noexcept
+{
+  static_assert( sizeof...(Indices) == Extents::rank(), "One index is required per dimension." );
+  if constexpr ( Extents::rank() == 2 )
+  {
+    const index_type idx[2] = { static_cast<index_type>( indices ) ... };
+    return { this->row_origin_ + idx[0], this->col_origin_ + idx[1] };
+  }
+  else if constexpr ( Extents::rank() == 1 )
+  {
+    const index_type idx[1] = { static_cast<index_type>( indices ) ... };
+    return ( this->axis_ == 0 ) ? ::std::array<index_type,2>{ this->row_origin_ + idx[0], this->col_origin_ }
+                                : ::std::array<index_type,2>{ this->row_origin_, this->col_origin_ + idx[0] };
+  }
+  else
+  {
+    return { this->row_origin_, this->col_origin_ };
+  }
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+[[nodiscard]] constexpr typename layout_tiled<RowTile,ColTile>::template mapping<Extents>::index_type
+layout_tiled<RowTile,ColTile>::mapping<Extents>::offset( index_type row, index_type col ) const noexcept
+{
+  constexpr index_type row_tile = static_cast<index_type>( RowTile );
+  constexpr index_type col_tile = static_cast<index_type>( ColTile );
+  return ( ( row / row_tile ) * this->tile_columns_ + ( col / col_tile ) ) * ( row_tile * col_tile ) +
+         ( row % row_tile ) * col_tile + ( col % col_tile );
+}
+
+template < ::std::size_t RowTile, ::std::size_t ColTile >
+template < class Extents >
+template < class ... Slices >
+[[nodiscard]] constexpr auto layout_tiled<RowTile,ColTile>::mapping<Extents>::submapping( Slices ... slices ) const
+{
+  static_assert( sizeof...(Slices) == Extents::rank(), "One slice specifier is required per dimension." );
+  using sub_extents_type = decltype( ::std::experimental::submdspan_extents( this->extents_, slices ... ) );
+  using sub_mapping_type = typename layout_tiled::template mapping<sub_extents_type>;
+  // Position of the first element of the subview, and the dimension along which it runs if it is of rank one
+  const ::std::array<index_type,2> first = this->position( static_cast<index_type>( ::std::experimental::detail::first_of( slices ) ) ... );
+  constexpr bool keeps[ sizeof...(Slices) + 1 ] = { !::std::is_convertible_v< Slices, index_type > ..., false };
+  rank_type axis = this->axis_;
+  if constexpr ( Extents::rank() == 2 )
+  {
+    axis = keeps[0] ? rank_type( 0 ) : rank_type( 1 );
+  }
+  // The subview starts at the first element of the tile holding its first element
+  constexpr index_type row_tile = static_cast<index_type>( RowTile );
+  constexpr index_type col_tile = static_cast<index_type>( ColTile );
+  const index_type row_origin = first[0] % row_tile;
+  const index_type col_origin = first[1] % col_tile;
+  return ::std::experimental::mapping_offset<sub_mapping_type> {
+    sub_mapping_type( ::std::experimental::submdspan_extents( this->extents_, slices ... ), this->tile_columns_, row_origin, col_origin, axis ),
+    static_cast< ::std::size_t >( this->offset( first[0] - row_origin, first[1] - col_origin ) ) };
+}
+
+}       //- math namespace
+}       //- experimental namespace
+}       //- std namespace
+#endif  //- LINEAR_ALGEBRA_TILED_LAYOUT_HPP
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  // Number of calls to the global operator new
+  std::atomic<std::size_t> global_heap_calls { 0 };
+}
+
+void* operator new( std::size_t bytes )
+{
+  ++global_heap_calls;
+  if ( void* p = std::malloc( bytes == 0 ? 1 : bytes ) )
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new( std::size_t bytes, std::align_val_t align )
+{
+  ++global_heap_calls;
+  const auto alignment = static_cast<std::size_t>( align );
+  if ( void* p = std::aligned_alloc( alignment, ( ( bytes + alignment - 1 ) / alignment ) * alignment ) )
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete( void* p ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t ) noexcept { std::free( p ); }
+void operator delete( void* p, std::align_val_t ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t, std::align_val_t ) noexcept { std::free( p ); }
+
+namespace
+{
+  TEST( ARENA_ALLOCATOR, ALIGNMENT_AND_CHECKPOINTS )
+  {
+    alignas(64) std::byte buffer[4096];
+    std::experimental::math::workspace ws( buffer, sizeof( buffer ) );
+    EXPECT_EQ( ws.capacity(), sizeof( buffer ) );
+    // Allocations are cache line aligned
+    void* p1 = ws.allocate( 8 );
+    void* p2 = ws.allocate( 8 );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( p1 ) % 64, 0u );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( p2 ) % 64, 0u );
+    EXPECT_EQ( static_cast<std::byte*>( p2 ) - static_cast<std::byte*>( p1 ), 64 );
+    // Deallocating the most recent allocation reclaims it
+    ws.deallocate( p2, 8 );
+    EXPECT_EQ( ws.allocate( 8 ), p2 );
+    // Rolling back releases everything allocated since the checkpoint
+    auto cp   = ws.checkpoint();
+    auto used = ws.used();
+    {
+      std::experimental::math::workspace::scope scope( ws );
+      [[maybe_unused]] void* p3 = ws.allocate( 100 );
+      EXPECT_GT( ws.used(), used );
+    }
+    EXPECT_EQ( ws.used(), used );
+    // Exhausting the buffer obtains a block from the global heap, which is returned on rollback
+    void* large = ws.allocate( 8192 );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( large ) % 64, 0u );
+    EXPECT_GE( ws.capacity(), 8192u );
+    ws.rollback( cp );
+    EXPECT_EQ( ws.capacity(), sizeof( buffer ) );
+    EXPECT_EQ( ws.allocate( 8 ), static_cast<std::byte*>( p2 ) + 64 );
+    ws.reset();
+    EXPECT_EQ( ws.used(), 0u );
+    EXPECT_EQ( ws.allocate( 8 ), p1 );
+  }
+
+  TEST( ARENA_ALLOCATOR, PER_THREAD_WORKSPACE )
+  {
+    // Default constructed allocators allocate from the workspace of the calling thread
+    std::experimental::math::arena_allocator<double> alloc;
+    EXPECT_EQ( &alloc.get_workspace(), &std::experimental::math::thread_workspace() );
+    std::experimental::math::workspace* other = nullptr;
+    std::thread( [&other]() { other = &std::experimental::math::arena_allocator<double>().get_workspace(); } ).join();
+    EXPECT_NE( other, &alloc.get_workspace() );
+    EXPECT_FALSE( std::experimental::math::arena_allocator<double>( *other ) == alloc );
+  }
+
+  TEST( ARENA_ALLOCATOR, RESIZE_IN_PLACE )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,std::experimental::math::arena_allocator<double>>;
+    alignas(64) static std::byte buffer[1 << 14];
+    std::experimental::math::workspace ws( buffer, sizeof( buffer ) );
+    matrix_type matrix{ std::experimental::extents<size_t,2,4>(), []( auto i, auto j ) { return double( 4 * i + j ); }, std::experimental::math::arena_allocator<double>( ws ) };
+    const double* data = &std::experimental::math::detail::access( matrix, 0, 0 );
+    // Growing the most recent allocation along rows extends it in place
+    matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 20, 4 ) );
+    EXPECT_EQ( &std::experimental::math::detail::access( matrix, 0, 0 ), data );
+    EXPECT_EQ( std::experimental::math::detail::access( matrix, 1, 3 ), 7.0 );
+    // Growing columns changes every offset, so elements are copied
+    matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 20, 6 ) );
+    EXPECT_NE( &std::experimental::math::detail::access( matrix, 0, 0 ), data );
+    EXPECT_EQ( std::experimental::math::detail::access( matrix, 1, 3 ), 7.0 );
+  }
+
+  TEST( ARENA_ALLOCATOR, EXPRESSION_WITHOUT_GLOBAL_HEAP_CALLS )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,std::experimental::math::arena_allocator<double>>;
+    using vector_type = std::experimental::math::dr_vector<double,std::experimental::math::arena_allocator<double>>;
+    alignas(64) static std::byte buffer[1 << 16];
+    std::experimental::math::workspace ws( buffer, sizeof( buffer ) );
+    std::experimental::math::arena_allocator<double> alloc( ws );
+
+    const std::size_t calls = global_heap_calls;
+    {
+      std::experimental::math::workspace::scope scope( ws );
+      matrix_type a{ std::experimental::extents<size_t,8,8>(), []( auto i, auto j ) { return double( i + j ); }, alloc };
+      matrix_type b{ std::experimental::extents<size_t,8,8>(), []( auto i, auto j ) { return double( i == j ); }, alloc };
+      vector_type x{ std::experimental::extents<size_t,8>(), []( auto i ) { return double( i ); }, alloc };
+      // Evaluate a full expression; every temporary and the result come from the workspace
+      auto y = ( ( a + b ) * ( 2.0 * b - a ) ) * x - x / 2.0;
+      EXPECT_EQ( &y.get_allocator().get_workspace(), &ws );
+      EXPECT_EQ( ( std::experimental::math::detail::access( y, 1 ) ), -9574.5 );
+      EXPECT_GT( ws.used(), 0u );
+    }
+    EXPECT_EQ( global_heap_calls, calls );
+    EXPECT_EQ( ws.used(), 0u );
+  }
+}
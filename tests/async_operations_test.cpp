@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+  TEST( ASYNC_OPERATIONS, SCHEDULE_THEN_AND_SYNC_WAIT )
+  {
+    std::experimental::math::thread_pool pool( 2 );
+    std::experimental::math::async_operations::thread_pool_scheduler scheduler( pool );
+    EXPECT_EQ( &scheduler.pool(), &pool );
+    EXPECT_TRUE( scheduler == std::experimental::math::async_operations::thread_pool_scheduler( pool ) );
+    // Work is executed on a worker thread of the pool
+    auto caller = std::this_thread::get_id();
+    auto sender = std::experimental::math::async_operations::then( std::experimental::math::async_operations::schedule( scheduler ),
+                                                                   [caller]() { return std::this_thread::get_id() != caller; } );
+    auto result = std::experimental::math::async_operations::sync_wait( std::move( sender ) );
+    ASSERT_TRUE( result.has_value() );
+    EXPECT_TRUE( std::get<0>( *result ) );
+    // Continuations may be piped
+    auto piped = std::experimental::math::async_operations::just( 2, 3 ) |
+                 std::experimental::math::async_operations::then( []( int a, int b ) { return a * b; } ) |
+                 std::experimental::math::async_operations::then( []( int c ) { return c + 1; } );
+    EXPECT_EQ( std::get<0>( *std::experimental::math::async_operations::sync_wait( std::move( piped ) ) ), 7 );
+  }
+
+  TEST( ASYNC_OPERATIONS, WHEN_ALL )
+  {
+    std::experimental::math::async_operations::thread_pool_scheduler scheduler;
+    // Values of all senders are sent together in order
+    auto sender = std::experimental::math::async_operations::when_all(
+      std::experimental::math::async_operations::then( scheduler.schedule(), []() { return 1; } ),
+      std::experimental::math::async_operations::then( scheduler.schedule(), []() { } ),
+      std::experimental::math::async_operations::just( 2.0, 3 ) );
+    auto result = std::experimental::math::async_operations::sync_wait( std::move( sender ) );
+    ASSERT_TRUE( result.has_value() );
+    EXPECT_EQ( std::get<0>( *result ), 1 );
+    EXPECT_EQ( std::get<1>( *result ), 2.0 );
+    EXPECT_EQ( std::get<2>( *result ), 3 );
+  }
+
+  TEST( ASYNC_OPERATIONS, ERROR_PROPAGATION )
+  {
+    std::experimental::math::async_operations::thread_pool_scheduler scheduler;
+    // Exceptions thrown by a continuation are rethrown by sync_wait
+    auto failing = std::experimental::math::async_operations::then( scheduler.schedule(), []() -> int { throw std::runtime_error( "Expected failure." ); } );
+    EXPECT_THROW( static_cast<void>( std::experimental::math::async_operations::sync_wait( std::move( failing ) ) ), std::runtime_error );
+    // An error from any sender of when_all is sent once all have completed
+    std::atomic<bool> completed( false );
+    auto all = std::experimental::math::async_operations::when_all(
+      std::experimental::math::async_operations::then( scheduler.schedule(), []() { throw std::runtime_error( "Expected failure." ); } ),
+      std::experimental::math::async_operations::then( scheduler.schedule(), [&completed]() { completed.store( true ); } ) );
+    EXPECT_THROW( static_cast<void>( std::experimental::math::async_operations::sync_wait( std::move( all ) ) ), std::runtime_error );
+    EXPECT_TRUE( completed.load() );
+    // Incompatable sizes are sent as errors
+    std::experimental::math::dr_matrix<double> m1{ std::experimental::extents<size_t,2,3>() };
+    std::experimental::math::dr_matrix<double> m2{ std::experimental::extents<size_t,2,3>() };
+    std::experimental::math::dr_matrix<double> result{ std::experimental::extents<size_t,2,3>() };
+    EXPECT_THROW( static_cast<void>( std::experimental::math::async_operations::sync_wait(
+                    std::experimental::math::async_operations::prod( scheduler, m1, m2, result ) ) ),
+                  std::length_error );
+  }
+
+  TEST( ASYNC_OPERATIONS, ELEMENTWISE_OPERATIONS )
+  {
+    std::experimental::math::async_operations::thread_pool_scheduler scheduler;
+    using tensor_type = std::experimental::math::dr_tensor<double,3>;
+    tensor_type t1( std::experimental::extents<size_t,3,4,5>(), []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } );
+    tensor_type t2( std::experimental::extents<size_t,3,4,5>(), []( auto i, auto j, auto k ) { return double( i + j + k ); } );
+    tensor_type sum{ std::experimental::extents<size_t,3,4,5>() };
+    tensor_type difference{ std::experimental::extents<size_t,3,4,5>() };
+    tensor_type negation{ std::experimental::extents<size_t,3,4,5>() };
+    tensor_type scaled{ std::experimental::extents<size_t,3,4,5>() };
+    tensor_type divided{ std::experimental::extents<size_t,3,4,5>() };
+    // Launch independent operations together, then scale the sum once it is available
+    auto sender = std::experimental::math::async_operations::when_all(
+      std::experimental::math::async_operations::add( scheduler, t1, t2, sum ) |
+        std::experimental::math::async_operations::then( [&scaled]( tensor_type& s ) { scaled = 2.0 * s; } ),
+      std::experimental::math::async_operations::subtract( scheduler, t1, t2, difference ),
+      std::experimental::math::async_operations::negate( scheduler, t1, negation ),
+      std::experimental::math::async_operations::divide( scheduler, t1, 2.0, divided ) );
+    auto result = std::experimental::math::async_operations::sync_wait( std::move( sender ) );
+    ASSERT_TRUE( result.has_value() );
+    EXPECT_EQ( &std::get<0>( *result ), &difference );
+    EXPECT_EQ( &std::get<2>( *result ), &divided );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+      for ( std::size_t j = 0; j < 4; ++j )
+      {
+        for ( std::size_t k = 0; k < 5; ++k )
+        {
+          const double a = double( 100 * i + 10 * j + k );
+          const double b = double( i + j + k );
+          EXPECT_EQ( ( std::experimental::math::detail::access( sum, i, j, k ) ), a + b );
+          EXPECT_EQ( ( std::experimental::math::detail::access( difference, i, j, k ) ), a - b );
+          EXPECT_EQ( ( std::experimental::math::detail::access( negation, i, j, k ) ), -a );
+          EXPECT_EQ( ( std::experimental::math::detail::access( scaled, i, j, k ) ), 2.0 * ( a + b ) );
+          EXPECT_EQ( ( std::experimental::math::detail::access( divided, i, j, k ) ), a / 2.0 );
+        }
+      }
+    }
+  }
+
+  TEST( ASYNC_OPERATIONS, PRODUCTS )
+  {
+    std::experimental::math::thread_pool pool( 3 );
+    std::experimental::math::async_operations::thread_pool_scheduler scheduler( pool );
+    std::experimental::math::dr_matrix<double> a( std::experimental::extents<size_t,4,3>(), []( auto i, auto j ) { return double( i + 2 * j ); } );
+    std::experimental::math::dr_matrix<double> b( std::experimental::extents<size_t,3,5>(), []( auto i, auto j ) { return double( 3 * i - j ); } );
+    std::experimental::math::dr_matrix<double> c( std::experimental::extents<size_t,5,2>(), []( auto i, auto j ) { return double( i * j + 1 ); } );
+    std::experimental::math::dr_vector<double> v( std::experimental::extents<size_t,3>(), []( auto i ) { return double( i + 1 ); } );
+    std::experimental::math::dr_vector<double> w( std::experimental::extents<size_t,4>(), []( auto i ) { return double( 2 * i ); } );
+    std::experimental::math::dr_matrix<double> ab{ std::experimental::extents<size_t,4,5>() };
+    std::experimental::math::dr_matrix<double> abc{ std::experimental::extents<size_t,4,2>() };
+    std::experimental::math::dr_vector<double> av{ std::experimental::extents<size_t,4>() };
+    std::experimental::math::dr_vector<double> wa{ std::experimental::extents<size_t,3>() };
+    // Independent products overlap; the dependent product is chained after the first
+    auto sender = std::experimental::math::async_operations::when_all(
+      std::experimental::math::async_operations::prod( scheduler, a, b, ab ),
+      std::experimental::math::async_operations::prod( scheduler, a, v, av ),
+      std::experimental::math::async_operations::prod( scheduler, w, a, wa ) );
+    ASSERT_TRUE( std::experimental::math::async_operations::sync_wait( std::move( sender ) ).has_value() );
+    ASSERT_TRUE( std::experimental::math::async_operations::sync_wait( std::experimental::math::async_operations::prod( scheduler, ab, c, abc ) ).has_value() );
+    // Compare against the synchronous operations
+    auto expected_ab  = a * b;
+    auto expected_abc = expected_ab * c;
+    auto expected_av  = a * v;
+    auto expected_wa  = w * a;
+    for ( std::size_t i = 0; i < 4; ++i )
+    {
+      for ( std::size_t j = 0; j < 5; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( ab, i, j ) ), ( std::experimental::math::detail::access( expected_ab, i, j ) ) );
+      }
+      for ( std::size_t j = 0; j < 2; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( abc, i, j ) ), ( std::experimental::math::detail::access( expected_abc, i, j ) ) );
+      }
+      EXPECT_EQ( std::experimental::math::detail::access( av, i ), std::experimental::math::detail::access( expected_av, i ) );
+    }
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+      EXPECT_EQ( std::experimental::math::detail::access( wa, i ), std::experimental::math::detail::access( expected_wa, i ) );
+    }
+    // Recursive layouts are multiplied by recursive subdivision, overwriting the result
+    using morton_matrix = std::experimental::math::dr_matrix<double, std::allocator<double>, std::experimental::math::layout_morton>;
+    morton_matrix large_a( std::experimental::extents<size_t,40,33>(), []( auto i, auto j ) { return double( ( i + 2 * j ) % 7 ); } );
+    morton_matrix large_b( std::experimental::extents<size_t,33,20>(), []( auto i, auto j ) { return double( ( 3 * i + j ) % 5 ); } );
+    morton_matrix large_ab( std::experimental::extents<size_t,40,20>(), []( auto, auto ) { return 7.0; } );
+    ASSERT_TRUE( std::experimental::math::async_operations::sync_wait( std::experimental::math::async_operations::prod( scheduler, large_a, large_b, large_ab ) ).has_value() );
+    auto expected_large_ab = large_a * large_b;
+    for ( std::size_t i = 0; i < 40; ++i )
+    {
+      for ( std::size_t j = 0; j < 20; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( large_ab, i, j ) ), ( std::experimental::math::detail::access( expected_large_ab, i, j ) ) );
+      }
+    }
+  }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  // Number of calls to the global operator new
+  std::atomic<std::size_t> global_heap_calls { 0 };
+}
+
+void* operator new( std::size_t bytes )
+{
+  ++global_heap_calls;
+  if ( void* p = std::malloc( bytes == 0 ? 1 : bytes ) )
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new( std::size_t bytes, std::align_val_t align )
+{
+  ++global_heap_calls;
+  const auto alignment = static_cast<std::size_t>( align );
+  if ( void* p = std::aligned_alloc( alignment, ( ( bytes + alignment - 1 ) / alignment ) * alignment ) )
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete( void* p ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t ) noexcept { std::free( p ); }
+void operator delete( void* p, std::align_val_t ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t, std::align_val_t ) noexcept { std::free( p ); }
+
+namespace
+{
+  TEST( CACHING_ALLOCATOR, RECYCLES_BUFFERS_BY_SIZE_CLASS )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,std::experimental::math::caching_allocator<double>>;
+    std::experimental::math::buffer_cache& cache = std::experimental::math::thread_buffer_cache();
+    cache.release();
+    cache.reset_stats();
+    // Warm up: the first temporaries of each size come from the global heap
+    matrix_type a{ std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 10, 10 ), []( auto i, auto j ) { return double( i + j ); } };
+    matrix_type b{ std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 10, 10 ), []( auto i, auto j ) { return double( i == j ); } };
+    {
+      auto c = a * b + a;
+    }
+    EXPECT_GT( cache.stats().misses, 0u );
+    EXPECT_GT( cache.stats().bytes_cached, 0u );
+    // Steady state: every temporary is recycled without touching the global heap
+    const std::size_t calls = global_heap_calls;
+    const std::size_t hits  = cache.stats().hits;
+    for ( int iteration = 0; iteration < 10; ++iteration )
+    {
+      auto c = a * b + a;
+      EXPECT_EQ( ( std::experimental::math::detail::access( c, 2, 3 ) ), 10.0 );
+    }
+    EXPECT_EQ( global_heap_calls, calls );
+    EXPECT_GT( cache.stats().hits, hits );
+    // Sizes within the same class are resized in place
+    const double* data = &std::experimental::math::detail::access( a, 0, 0 );
+    a.reserve( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 12, 10 ) );
+    a.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 12, 10 ) );
+    EXPECT_EQ( &std::experimental::math::detail::access( a, 0, 0 ), data );
+    EXPECT_EQ( ( std::experimental::math::detail::access( a, 9, 9 ) ), 18.0 );
+  }
+
+  TEST( CACHING_ALLOCATOR, BYPASSES_ALLOCATIONS_ABOVE_THRESHOLD )
+  {
+    std::experimental::math::buffer_cache cache;
+    constexpr std::size_t threshold = std::experimental::math::buffer_cache::threshold;
+    // Allocations at the threshold are cached and recycled
+    void* p = cache.allocate( threshold );
+    cache.deallocate( p, threshold );
+    EXPECT_EQ( cache.stats().bytes_cached, threshold );
+    EXPECT_EQ( cache.allocate( threshold ), p );
+    EXPECT_EQ( cache.stats().hits, 1u );
+    cache.deallocate( p, threshold );
+    // Allocations above the threshold always come from and return to the global heap
+    for ( int iteration = 0; iteration < 2; ++iteration )
+    {
+      const std::size_t calls = global_heap_calls;
+      void* q = cache.allocate( threshold + 1 );
+      EXPECT_EQ( global_heap_calls, calls + 1 );
+      cache.deallocate( q, threshold + 1 );
+    }
+    EXPECT_EQ( cache.stats().bypasses, 2u );
+    EXPECT_EQ( cache.stats().hits, 1u );
+    EXPECT_EQ( cache.stats().bytes_cached, threshold );
+    // Tensors above the threshold bypass the cache of the calling thread
+    std::experimental::math::buffer_cache& thread_cache = std::experimental::math::thread_buffer_cache();
+    const std::size_t bypasses = thread_cache.stats().bypasses;
+    {
+      std::experimental::math::dr_vector<double,std::experimental::math::caching_allocator<double>> large{ std::experimental::extents<size_t,dynamic_extent>( threshold ) };
+      EXPECT_EQ( thread_cache.stats().bypasses, bypasses + 1 );
+    }
+  }
+
+  TEST( CACHING_ALLOCATOR, SET_CAPACITY_EVICTS_LARGEST_CLASSES_FIRST )
+  {
+    constexpr std::size_t min_block = std::experimental::math::buffer_cache::min_block;
+    std::experimental::math::buffer_cache cache( 16 * min_block );
+    // Cache one buffer each of 1, 2, 4 and 8 blocks
+    void* buffers[4];
+    for ( std::size_t index = 0; index < 4; ++index )
+    {
+      buffers[index] = cache.allocate( min_block << index );
+    }
+    for ( std::size_t index = 0; index < 4; ++index )
+    {
+      cache.deallocate( buffers[index], min_block << index );
+    }
+    EXPECT_EQ( cache.stats().bytes_cached, 15 * min_block );
+    // Buffers which would exceed the capacity are returned to the global heap
+    void* extra = cache.allocate( 2 * min_block );
+    EXPECT_EQ( extra, buffers[1] );
+    void* other = cache.allocate( 2 * min_block );
+    cache.deallocate( extra, 2 * min_block );
+    cache.deallocate( other, 2 * min_block );
+    EXPECT_EQ( cache.stats().bytes_cached, 15 * min_block );
+    // Lowering the capacity evicts the largest size classes until the cache fits
+    cache.set_capacity( 4 * min_block );
+    EXPECT_EQ( cache.capacity(), 4 * min_block );
+    EXPECT_EQ( cache.stats().bytes_cached, 3 * min_block );
+    const std::size_t hits = cache.stats().hits;
+    EXPECT_EQ( cache.allocate( min_block ), buffers[0] );
+    EXPECT_EQ( cache.allocate( 2 * min_block ), buffers[1] );
+    EXPECT_EQ( cache.stats().hits, hits + 2 );
+    void* evicted = cache.allocate( 8 * min_block );
+    EXPECT_EQ( cache.stats().hits, hits + 2 );
+    cache.deallocate( evicted, 8 * min_block );
+    cache.deallocate( buffers[1], 2 * min_block );
+    cache.deallocate( buffers[0], min_block );
+    // A capacity of zero releases every buffer and keeps none
+    cache.set_capacity( 0 );
+    EXPECT_EQ( cache.stats().bytes_cached, 0u );
+    cache.deallocate( cache.allocate( min_block ), min_block );
+    EXPECT_EQ( cache.stats().bytes_cached, 0u );
+  }
+}
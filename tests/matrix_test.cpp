@@ -1,6 +1,17 @@
 #include <gtest/gtest.h>
 #include <experimental/linear_algebra.hpp>
 
+namespace std::experimental::math
+{
+  // Rows grow by half with at least four rows of slack, columns grow only as required
+  template <>
+  struct growth_traits< dr_tensor<float,2> >
+  {
+    static constexpr std::array<double,2>      factor = { 1.5, 1.0 };
+    static constexpr std::array<std::size_t,2> slack  = { 4, 0 };
+  };
+}
+
 namespace
 {
   TEST( DR_MATRIX, DEFAULT_CONSTRUCTOR_AND_DESTRUCTOR )
@@ -310,6 +321,61 @@ namespace
     EXPECT_EQ( val4, 4.0 );
   }
 
+  TEST( DR_MATRIX, GROWTH_TRAITS )
+  {
+    // Default growth doubles every dimension which must grow
+    EXPECT_EQ( ( std::experimental::math::growth_traits< std::experimental::math::dr_tensor<double,2> >::factor[1] ), 2.0 );
+    EXPECT_EQ( ( std::experimental::math::growth_traits< std::experimental::math::dr_tensor<double,2> >::slack[0] ), 0u );
+    // Specialized growth applies per dimension
+    std::experimental::math::dr_matrix<float> dyn_matrix{ std::experimental::extents<size_t,10,10>() };
+    dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 11, 11 ) );
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,15,11>() ) );
+    dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 30, 12 ) );
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,34,12>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( dyn_matrix, 29, 11 ) ), 0.0f );
+  }
+
+  TEST( DR_MATRIX, GEOMETRIC_GROWTH_AND_SHRINK_TO_FIT )
+  {
+    std::experimental::math::dr_matrix<double> dyn_matrix{ std::experimental::extents<size_t,1,3>(), []( auto i, auto j ) { return double( 3 * i + j ); } };
+    // Append one row at a time; capacity grows geometrically so reallocations are logarithmic
+    size_t reallocations = 0;
+    for ( size_t rows = 2; rows <= 100; ++rows )
+    {
+      auto cap = dyn_matrix.capacity();
+      dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( rows, 3 ) );
+      for ( size_t j = 0; j < 3; ++j )
+      {
+        std::experimental::math::detail::access( dyn_matrix, rows - 1, j ) = double( 3 * ( rows - 1 ) + j );
+      }
+      reallocations += ( cap != dyn_matrix.capacity() ) ? 1 : 0;
+    }
+    EXPECT_EQ( reallocations, 7u );
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,128,3>() ) );
+    // Elements survive growth
+    for ( size_t i = 0; i < 100; ++i )
+    {
+      for ( size_t j = 0; j < 3; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( dyn_matrix, i, j ) ), double( 3 * i + j ) );
+      }
+    }
+    // Shrinking releases the slack
+    dyn_matrix.shrink_to_fit();
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,100,3>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( dyn_matrix, 99, 2 ) ), 299.0 );
+    // Reserve expands capacity without changing the size
+    dyn_matrix.reserve( std::experimental::extents<size_t,200,4>() );
+    EXPECT_EQ( dyn_matrix.size(), ( std::experimental::extents<size_t,100,3>() ) );
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,200,4>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( dyn_matrix, 50, 1 ) ), 151.0 );
+    // Assignment reuses sufficient capacity
+    std::experimental::math::dr_matrix<double> small{ std::experimental::extents<size_t,2,2>() };
+    dyn_matrix = small;
+    EXPECT_EQ( dyn_matrix.size(), ( std::experimental::extents<size_t,2,2>() ) );
+    EXPECT_EQ( dyn_matrix.capacity(), ( std::experimental::extents<size_t,200,4>() ) );
+  }
+
   TEST( DR_MATRIX, CONST_SUBMATRIX )
   {
     // Construct
@@ -610,6 +676,50 @@ namespace
     EXPECT_EQ( val4, 8.0 );
   }
 
+  TEST( DR_MATRIX, ADD_ASSIGN_MIXED_LAYOUT )
+  {
+    using matrix_type      = std::experimental::math::dr_matrix<double>;
+    using left_matrix_type = std::experimental::math::dr_matrix<double,std::allocator<double>,std::experimental::layout_left>;
+    // Construct with extents which are not a multiple of the tile size
+    matrix_type      matrix{ std::experimental::extents<size_t,70,45>(), std::experimental::extents<size_t,70,45>(),
+                             []( auto i, auto j ) { return double( 100 * i + j ); } };
+    left_matrix_type left_matrix{ std::experimental::extents<size_t,70,45>(), std::experimental::extents<size_t,70,45>(),
+                                  []( auto i, auto j ) { return double( 100 * i + j ); } };
+    // Operands are contiguous along different dimensions
+    EXPECT_EQ( std::experimental::math::detail::contiguous_dimension( matrix.underlying_span() ), 1 );
+    EXPECT_EQ( std::experimental::math::detail::contiguous_dimension( left_matrix.underlying_span() ), 0 );
+    // Add the two matrices together
+    static_cast<void>( matrix += left_matrix );
+    // Check each element was visited exactly once
+    for ( std::size_t i = 0; i < 70; ++i )
+    {
+      for ( std::size_t j = 0; j < 45; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( matrix, i, j ) ), double( 2 * ( 100 * i + j ) ) );
+      }
+    }
+  }
+
+  TEST( DR_MATRIX, TILED_TRAVERSAL )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<int>;
+    // Construct
+    matrix_type matrix{ std::experimental::extents<size_t,37,5>(), std::experimental::extents<size_t,40,8>(),
+                        []( auto, auto ) { return 0; } };
+    // Visit each element in 4x4 tiles
+    std::experimental::math::detail::apply_all_tiled( matrix.underlying_span(),
+                                                      [&matrix]( auto i, auto j ) { ++std::experimental::math::detail::access( matrix, i, j ); },
+                                                      LINALG_EXECUTION_PAR,
+                                                      1, 0, 4 );
+    for ( std::size_t i = 0; i < 37; ++i )
+    {
+      for ( std::size_t j = 0; j < 5; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( matrix, i, j ) ), 1 );
+      }
+    }
+  }
+
   TEST( DR_MATRIX, SUBTRACT )
   {
     using matrix_type = std::experimental::math::dr_matrix<double>;
@@ -893,6 +1003,287 @@ namespace
     EXPECT_EQ( val2, 32.0 );
   }
 
+  TEST( DR_MATRIX, POLYMORPHIC_ALLOCATOR_PROPAGATION )
+  {
+    using matrix_type     = std::experimental::math::pmr::dr_matrix<double>;
+    using std_matrix_type = std::experimental::math::dr_matrix<double>;
+    using vector_type     = std::experimental::math::pmr::dr_vector<double>;
+    std::pmr::monotonic_buffer_resource arena;
+    matrix_type::allocator_type alloc{ &arena };
+    // Construct matrices and vector from the arena
+    matrix_type matrix1{ std::experimental::extents<size_t,2,2>(), [&]( auto i, auto j ) { return double( i + j ); }, alloc };
+    matrix_type matrix2{ std::experimental::extents<size_t,2,2>(), [&]( auto i, auto j ) { return double( i * j ); }, alloc };
+    vector_type vector{ std::experimental::extents<size_t,2>(), [&]( auto i ) { return double( i ); }, alloc };
+    std_matrix_type std_matrix{ std::experimental::extents<size_t,2,2>(), [&]( auto i, auto j ) { return double( i - j ); } };
+    // Results of operations allocate from the memory resource of their operands
+    auto sum        = matrix1 + matrix2;
+    auto difference = matrix1 - matrix2;
+    auto negation   = -matrix1;
+    auto scaled     = 2.0 * matrix1;
+    auto product    = matrix1 * matrix2;
+    auto transpose  = trans( matrix1 );
+    auto vector_pre = vector * matrix1;
+    auto vector_pos = matrix1 * vector;
+    EXPECT_EQ( sum.get_allocator().resource(), &arena );
+    EXPECT_EQ( difference.get_allocator().resource(), &arena );
+    EXPECT_EQ( negation.get_allocator().resource(), &arena );
+    EXPECT_EQ( scaled.get_allocator().resource(), &arena );
+    EXPECT_EQ( product.get_allocator().resource(), &arena );
+    EXPECT_EQ( transpose.get_allocator().resource(), &arena );
+    EXPECT_EQ( vector_pre.get_allocator().resource(), &arena );
+    EXPECT_EQ( vector_pos.get_allocator().resource(), &arena );
+    // Mixing a std allocator operand with a polymorphic allocator operand propagates the memory resource
+    auto mixed_sum     = std_matrix + matrix1;
+    auto mixed_product = std_matrix * matrix1;
+    EXPECT_EQ( mixed_sum.get_allocator().resource(), &arena );
+    EXPECT_EQ( mixed_product.get_allocator().resource(), &arena );
+    EXPECT_EQ( ( std::experimental::math::detail::access( mixed_sum, 1, 0 ) ), 2.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( product, 1, 1 ) ), 2.0 );
+  }
+
+  TEST( DR_MATRIX, ALIGNED_ALLOCATOR_PADDING )
+  {
+    using matrix_type = std::experimental::math::dr_matrix<double,std::experimental::math::aligned_allocator<double>>;
+    // Leading dimension is padded to a whole cache line without changing the size
+    matrix_type matrix{ std::experimental::extents<size_t,3,5>(), []( auto i, auto j ) { return double( 10 * i + j ); } };
+    EXPECT_EQ( matrix.size(), ( std::experimental::extents<size_t,3,5>() ) );
+    EXPECT_EQ( matrix.capacity(), ( std::experimental::extents<size_t,3,8>() ) );
+    for ( auto i : { 0, 1, 2 } )
+    {
+      EXPECT_EQ( reinterpret_cast<std::uintptr_t>( &std::experimental::math::detail::access( matrix, i, 0 ) ) % 64, 0u );
+    }
+    EXPECT_EQ( ( std::experimental::math::detail::access( matrix, 2, 4 ) ), 24.0 );
+    // Leading dimensions which are a multiple of the aliasing stride receive an extra cache line
+    matrix_type aliased{ std::experimental::extents<size_t,4,64>() };
+    EXPECT_EQ( aliased.capacity(), ( std::experimental::extents<size_t,4,72>() ) );
+    // Growth keeps the padding and the elements
+    matrix.resize( std::experimental::extents<size_t,4,10>() );
+    EXPECT_EQ( matrix.capacity(), ( std::experimental::extents<size_t,6,16>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( matrix, 2, 4 ) ), 24.0 );
+    // Reserving keeps rows aligned
+    matrix.reserve( std::experimental::extents<size_t,6,20>() );
+    EXPECT_EQ( matrix.capacity(), ( std::experimental::extents<size_t,6,24>() ) );
+    for ( auto i : { 0, 1, 2, 3 } )
+    {
+      EXPECT_EQ( reinterpret_cast<std::uintptr_t>( &std::experimental::math::detail::access( matrix, i, 0 ) ) % 64, 0u );
+    }
+    EXPECT_EQ( ( std::experimental::math::detail::access( matrix, 2, 4 ) ), 24.0 );
+    // So does an explicitly requested capacity
+    matrix_type reserved{ std::experimental::extents<size_t,3,5>(), std::experimental::extents<size_t,4,6>() };
+    EXPECT_EQ( reserved.capacity(), ( std::experimental::extents<size_t,4,8>() ) );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( &std::experimental::math::detail::access( reserved, 1, 0 ) ) % 64, 0u );
+    // Results of operations are padded as their operands are
+    auto sum = matrix + matrix;
+    EXPECT_EQ( sum.capacity(), matrix.capacity() );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( &std::experimental::math::detail::access( sum, 1, 0 ) ) % 64, 0u );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sum, 2, 4 ) ), 48.0 );
+    // Vectors and std::allocator tensors are not padded
+    std::experimental::math::dr_matrix<double> unpadded{ std::experimental::extents<size_t,3,5>() };
+    EXPECT_EQ( unpadded.capacity(), ( std::experimental::extents<size_t,3,5>() ) );
+    std::experimental::math::dr_vector<double,std::experimental::math::aligned_allocator<double>> vector{ std::experimental::extents<size_t,5>() };
+    EXPECT_EQ( vector.capacity(), ( std::experimental::extents<size_t,5>() ) );
+  }
+
+  TEST( DR_MATRIX, ROW_AND_COLUMN_RANGES )
+  {
+    std::experimental::math::dr_matrix<double> matrix{ std::experimental::extents<size_t,5,3>(), std::experimental::extents<size_t,6,4>() };
+    // Rows are random-access and may be processed by a parallel algorithm
+    auto rows = std::experimental::math::rows( matrix );
+    EXPECT_EQ( rows.size(), 5u );
+    EXPECT_EQ( rows.end() - rows.begin(), 5 );
+    std::experimental::math::detail::for_each( LINALG_EXECUTION_PAR, rows.begin(), rows.end(), []( auto row )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        std::experimental::math::detail::access( row, j ) = double( j );
+      }
+    } );
+    // Each row is a view of the matrix
+    auto row = rows[2];
+    std::experimental::math::detail::access( row, 1 ) = 10.0;
+    EXPECT_EQ( ( std::experimental::math::detail::access( matrix, 2, 1 ) ), 10.0 );
+    // Columns of a const matrix are const views
+    const std::experimental::math::dr_matrix<double>& const_matrix( matrix );
+    auto columns = std::experimental::math::columns( const_matrix );
+    EXPECT_EQ( columns.size(), 3u );
+    std::vector<double> sums( columns.size() );
+    std::transform( columns.begin(), columns.end(), sums.begin(), []( auto column )
+    {
+      double sum = 0.0;
+      for ( std::size_t i = 0; i < 5; ++i )
+      {
+        sum += std::experimental::math::detail::access( column, i );
+      }
+      return sum;
+    } );
+    EXPECT_EQ( sums, ( std::vector<double>{ 0.0, 14.0, 10.0 } ) );
+    // Fixed-size matrices provide the same ranges
+    std::experimental::math::fs_matrix<double,2,4> fs_matrix( []( auto i, auto j ) { return double( 4 * i + j ); } );
+    auto fs_columns = std::experimental::math::columns( fs_matrix );
+    EXPECT_EQ( fs_columns.size(), 4u );
+    EXPECT_EQ( ( std::experimental::math::detail::access( *( fs_columns.begin() + 3 ), 1 ) ), 7.0 );
+  }
+
+  TEST( DR_MATRIX, TILE_GRID )
+  {
+    std::experimental::math::dr_matrix<double> matrix{ std::experimental::extents<size_t,5,7>(), []( auto, auto ) { return 0.0; } };
+    // Tiles of 2x3 cover the matrix with ragged tiles along the bottom and right edges
+    auto grid = std::experimental::math::tiles( matrix, std::experimental::extents<size_t,2,3>() );
+    EXPECT_EQ( grid.extent( 0 ), 3u );
+    EXPECT_EQ( grid.extent( 1 ), 3u );
+    EXPECT_EQ( grid.size(), 9u );
+    EXPECT_EQ( grid.tile( 0, 0 ).size(), ( std::experimental::extents<size_t,2,3>() ) );
+    EXPECT_EQ( grid.tile( 0, 2 ).size(), ( std::experimental::extents<size_t,2,1>() ) );
+    EXPECT_EQ( grid.tile( 2, 1 ).size(), ( std::experimental::extents<size_t,1,3>() ) );
+    EXPECT_EQ( grid.tile( 2, 2 ).size(), ( std::experimental::extents<size_t,1,1>() ) );
+    // Every element belongs to exactly one tile when tiles are processed in parallel
+    std::experimental::math::detail::for_each( LINALG_EXECUTION_PAR, grid.begin(), grid.end(), []( auto tile )
+    {
+      for ( std::size_t i = 0; i < tile.rows(); ++i )
+      {
+        for ( std::size_t j = 0; j < tile.columns(); ++j )
+        {
+          std::experimental::math::detail::access( tile, i, j ) += 1.0;
+        }
+      }
+    } );
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+      for ( std::size_t j = 0; j < 7; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( matrix, i, j ) ), 1.0 );
+      }
+    }
+    // Linear order visits the last grid dimension fastest
+    std::experimental::math::detail::access( grid[5], 0, 0 ) = 42.0;
+    EXPECT_EQ( ( std::experimental::math::detail::access( matrix, 2, 6 ) ), 42.0 );
+    // Tile extents must be positive
+    EXPECT_THROW( static_cast<void>( std::experimental::math::tiles( matrix, std::experimental::extents<size_t,0,3>() ) ), std::length_error );
+  }
+
+  TEST( DR_MATRIX, TILED_LAYOUT )
+  {
+    using tiled_matrix = std::experimental::math::dr_matrix<double, std::allocator<double>, std::experimental::math::layout_tiled<2,3>>;
+    using plain_matrix = std::experimental::math::dr_matrix<double>;
+    // Compares every element of two matrices of possibly different layouts
+    auto expect_equal = []( const auto& lhs, const auto& rhs )
+    {
+      ASSERT_EQ( lhs.size(), rhs.size() );
+      for ( std::size_t i = 0; i < lhs.rows(); ++i )
+      {
+        for ( std::size_t j = 0; j < lhs.columns(); ++j )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( lhs, i, j ) ), ( std::experimental::math::detail::access( rhs, i, j ) ) );
+        }
+      }
+    };
+    auto init = []( auto i, auto j ) { return double( 10 * i + j ); };
+    tiled_matrix tiled{ std::experimental::extents<size_t,5,7>(), init };
+    plain_matrix plain{ std::experimental::extents<size_t,5,7>(), init };
+    // Capacity holds whole tiles, and each tile is contiguous in storage
+    EXPECT_EQ( tiled.capacity(), ( std::experimental::extents<size_t,6,9>() ) );
+    EXPECT_EQ( &std::experimental::math::detail::access( tiled, 1, 2 ) - &std::experimental::math::detail::access( tiled, 0, 0 ), 5 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tiled, 0, 3 ) - &std::experimental::math::detail::access( tiled, 0, 0 ), 6 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tiled, 2, 0 ) - &std::experimental::math::detail::access( tiled, 0, 0 ), 18 );
+    expect_equal( tiled, plain );
+    // Views of a tiled matrix remain tiled, including those starting inside a tile
+    auto sub = tiled.submatrix( std::tuple( 1, 4 ), std::tuple( 2, 6 ) );
+    auto row = tiled.row( 3 );
+    auto col = tiled.column( 4 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sub, 0, 0 ) ), 12.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sub, 2, 3 ) ), 35.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( row, 6 ) ), 36.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( col, 4 ) ), 44.0 );
+    auto sub_sub = sub.submatrix( std::tuple( 1, 3 ), std::tuple( 1, 4 ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sub_sub, 1, 2 ) ), 35.0 );
+    // Element-wise and product kernels agree with the row-major layout
+    expect_equal( tiled + tiled, plain + plain );
+    expect_equal( -tiled, -plain );
+    expect_equal( trans( tiled ), trans( plain ) );
+    expect_equal( tiled * trans( tiled ), plain * trans( plain ) );
+    // Products accumulate blocks of k into each tile, including partial tiles and blocks
+    using large_tiled_matrix = std::experimental::math::dr_matrix<double, std::allocator<double>, std::experimental::math::layout_tiled<8,16>>;
+    auto large_init = []( auto i, auto j ) { return double( ( 3 * i + 5 * j ) % 11 ); };
+    const large_tiled_matrix large_tiled{ std::experimental::extents<size_t,37,70>(), large_init };
+    const plain_matrix       large_plain{ std::experimental::extents<size_t,37,70>(), large_init };
+    const plain_matrix       right{ std::experimental::extents<size_t,70,29>(), []( auto i, auto j ) { return double( ( i + 2 * j ) % 7 ); } };
+    expect_equal( large_tiled * right, large_plain * right );
+    tiled += plain;
+    expect_equal( tiled, 2.0 * plain );
+    // Resize and reserve grow whole tiles and preserve elements
+    tiled.resize( std::experimental::extents<size_t,7,8>() );
+    EXPECT_EQ( tiled.capacity().extent( 0 ) % 2, 0u );
+    EXPECT_EQ( tiled.capacity().extent( 1 ) % 3, 0u );
+    tiled.reserve( std::experimental::extents<size_t,11,10>() );
+    EXPECT_EQ( tiled.capacity().extent( 0 ) % 2, 0u );
+    EXPECT_EQ( tiled.capacity().extent( 1 ) % 3, 0u );
+    for ( std::size_t i = 0; i < 5; ++i )
+    {
+      for ( std::size_t j = 0; j < 7; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( tiled, i, j ) ), 2.0 * init( i, j ) );
+      }
+    }
+    tiled.shrink_to_fit();
+    EXPECT_EQ( tiled.capacity(), ( std::experimental::extents<size_t,8,9>() ) );
+  }
+
+  TEST( DR_MATRIX, MORTON_LAYOUT )
+  {
+    using morton_matrix = std::experimental::math::dr_matrix<double, std::allocator<double>, std::experimental::math::layout_morton>;
+    using plain_matrix  = std::experimental::math::dr_matrix<double>;
+    // Compares every element of two matrices of possibly different layouts
+    auto expect_equal = []( const auto& lhs, const auto& rhs )
+    {
+      ASSERT_EQ( lhs.size(), rhs.size() );
+      for ( std::size_t i = 0; i < lhs.rows(); ++i )
+      {
+        for ( std::size_t j = 0; j < lhs.columns(); ++j )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( lhs, i, j ) ), ( std::experimental::math::detail::access( rhs, i, j ) ) );
+        }
+      }
+    };
+    auto init = []( auto i, auto j ) { return double( 100 * i + j ); };
+    morton_matrix morton{ std::experimental::extents<size_t,70,45>(), init };
+    plain_matrix  plain{ std::experimental::extents<size_t,70,45>(), init };
+    // Offsets interleave the bits of the row and column, the column in the least significant bit
+    const double* origin = &std::experimental::math::detail::access( morton, 0, 0 );
+    EXPECT_EQ( &std::experimental::math::detail::access( morton, 0, 1 ) - origin, 1 );
+    EXPECT_EQ( &std::experimental::math::detail::access( morton, 1, 0 ) - origin, 2 );
+    EXPECT_EQ( &std::experimental::math::detail::access( morton, 2, 2 ) - origin, 12 );
+    EXPECT_EQ( &std::experimental::math::detail::access( morton, 5, 3 ) - origin, 39 );
+    expect_equal( morton, plain );
+    // Views of a Morton matrix remain Morton ordered
+    auto sub = morton.submatrix( std::tuple( 3, 9 ), std::tuple( 10, 20 ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sub, 2, 3 ) ), 513.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( sub.submatrix( std::tuple( 1, 3 ), std::tuple( 2, 5 ) ), 1, 2 ) ), 514.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( morton.row( 5 ), 7 ) ), 507.0 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( morton.column( 44 ), 69 ) ), 6944.0 );
+    // Blocked transpose and recursive product agree with the row-major layout
+    expect_equal( trans( morton ), trans( plain ) );
+    expect_equal( morton * trans( morton ), plain * trans( plain ) );
+    expect_equal( morton + morton, plain + plain );
+    // Resizing preserves elements
+    morton.resize( std::experimental::extents<size_t,100,90>() );
+    for ( std::size_t i = 0; i < 70; ++i )
+    {
+      for ( std::size_t j = 0; j < 45; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( morton, i, j ) ), init( i, j ) );
+      }
+    }
+    // Capacities whose Morton span far exceeds their element count are rejected
+    EXPECT_THROW( ( morton_matrix{ std::experimental::extents<size_t,1000,2>() } ), std::length_error );
+    EXPECT_THROW( morton.resize( std::experimental::extents<size_t,1000,90>() ), std::length_error );
+    EXPECT_EQ( morton.size(), ( std::experimental::extents<size_t,100,90>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( morton, 69, 44 ) ), init( 69, 44 ) );
+    // Fixed size matrices whose extents are the same power of two are stored contiguously
+    std::experimental::math::fs_matrix<double,8,8,std::experimental::math::layout_morton> fixed{ init };
+    EXPECT_EQ( &std::experimental::math::detail::access( fixed, 7, 7 ) - &std::experimental::math::detail::access( fixed, 0, 0 ), 63 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( fixed, 6, 5 ) ), 605.0 );
+  }
+
   TEST( FS_MATRIX, DEFAULT_CONSTRUCTOR_AND_DESTRUCTOR )
   {
     // Default construction
@@ -1746,6 +2137,33 @@ namespace
     EXPECT_EQ( val2, 32.0 );
   }
 
+  TEST( FS_MATRIX, TILED_LAYOUT )
+  {
+    using tiled_matrix = std::experimental::math::fs_matrix<double,5,7,std::experimental::math::layout_tiled<2,3>>;
+    using plain_matrix = std::experimental::math::fs_matrix<double,5,7>;
+    // Compares every element of two matrices of possibly different layouts
+    auto expect_equal = []( const auto& lhs, const auto& rhs )
+    {
+      ASSERT_EQ( lhs.size(), rhs.size() );
+      for ( std::size_t i = 0; i < lhs.rows(); ++i )
+      {
+        for ( std::size_t j = 0; j < lhs.columns(); ++j )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( lhs, i, j ) ), ( std::experimental::math::detail::access( rhs, i, j ) ) );
+        }
+      }
+    };
+    auto init = []( auto i, auto j ) { return double( 10 * i + j ); };
+    tiled_matrix tiled{ init };
+    plain_matrix plain{ init };
+    // Storage holds whole tiles, and each tile is contiguous
+    EXPECT_EQ( ( &std::experimental::math::detail::access( tiled, 4, 6 ) - &std::experimental::math::detail::access( tiled, 0, 0 ) ), 48 );
+    expect_equal( tiled, plain );
+    EXPECT_EQ( ( std::experimental::math::detail::access( tiled.row( 3 ), 5 ) ), 35.0 );
+    expect_equal( tiled + tiled, plain + plain );
+    expect_equal( tiled * trans( tiled ), plain * trans( plain ) );
+  }
+
   TEST( MATRIX_VIEW, SIZE_AND_CAPACITY )
   {
     using fs_matrix_type = std::experimental::math::fs_matrix<double,5,5>;
@@ -2339,4 +2757,540 @@ namespace
     EXPECT_EQ( ( std::experimental::math::detail::access( vector_prod, 1 ) ), 8.0 );
   }
 
+  TEST( CSR_MATRIX, CONSTRUCTION_AND_ACCESS )
+  {
+    using csr_type = std::experimental::math::csr_matrix<double,int>;
+    static_assert( std::experimental::math::concepts::matrix_data_v<csr_type> );
+    // Compress a dense matrix
+    std::experimental::math::dr_matrix<double> dense{ std::experimental::extents<size_t,3,4>(),
+                                                      []( auto i, auto j ) { return ( ( i + j ) % 3 == 0 ) ? double( 10 * i + j + 1 ) : 0.0; } };
+    csr_type sparse{ dense };
+    EXPECT_EQ( sparse.rows(), 3 );
+    EXPECT_EQ( sparse.columns(), 4 );
+    EXPECT_EQ( sparse.nonzeros(), 4 );
+    EXPECT_EQ( sparse.row_offsets(), ( csr_type::offsets_container_type{ 0, 2, 3, 4 } ) );
+    EXPECT_EQ( sparse.column_indices(), ( csr_type::indices_container_type{ 0, 3, 2, 1 } ) );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+      for ( std::size_t j = 0; j < 4; ++j )
+      {
+        EXPECT_EQ( ( std::experimental::math::detail::access( sparse, i, j ) ), ( std::experimental::math::detail::access( dense, i, j ) ) );
+      }
+    }
+    EXPECT_EQ( sparse.at( 2, 1 ), 22.0 );
+    EXPECT_EQ( sparse.at( 2, 2 ), 0.0 );
+    EXPECT_THROW( static_cast<void>( sparse.at( 3, 0 ) ), std::out_of_range );
+    EXPECT_THROW( static_cast<void>( sparse.at( 0, -1 ) ), std::out_of_range );
+    // Adopt existing compressed storage
+    csr_type adopted{ std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>( 2, 3 ), { 0, 1, 3 }, { 2, 0, 1 }, { 5.0, 6.0, 7.0 } };
+    EXPECT_EQ( adopted.at( 0, 2 ), 5.0 );
+    EXPECT_EQ( adopted.at( 1, 1 ), 7.0 );
+    EXPECT_THROW( ( csr_type{ std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>( 2, 3 ), { 0, 2, 3 }, { 1, 0, 1 }, { 5.0, 6.0, 7.0 } } ), std::invalid_argument );
+    EXPECT_THROW( ( csr_type{ std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>( 2, 3 ), { 0, 1, 3 }, { 2, 0, 3 }, { 5.0, 6.0, 7.0 } } ), std::invalid_argument );
+    EXPECT_THROW( ( csr_type{ std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>( 2, 3 ), { 0, 1 }, { 2 }, { 5.0 } } ), std::invalid_argument );
+  }
+
+  TEST( CSR_MATRIX, SPARSE_PRODUCTS )
+  {
+    // Rows hold very different numbers of nonzeros, so partitions by nonzeros differ from partitions by rows
+    constexpr std::size_t n = 3000;
+    std::vector<std::size_t>    offsets{ 0 };
+    std::vector<std::ptrdiff_t> columns;
+    std::vector<double>         values;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      const std::size_t stride = ( i % 100 == 0 ) ? 1 : 97;
+      for ( std::size_t j = i % stride; j < n; j += stride )
+      {
+        columns.push_back( static_cast<std::ptrdiff_t>( j ) );
+        values.push_back( double( ( i + 3 * j ) % 7 ) + 1.0 );
+      }
+      offsets.push_back( values.size() );
+    }
+    const std::experimental::math::csr_matrix<double> sparse{ std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>( n, n ),
+                                                              { offsets.begin(), offsets.end() }, { columns.begin(), columns.end() }, { values.begin(), values.end() } };
+    ASSERT_GT( sparse.nonzeros(), 4 * LINALG_SPARSE_TASK_NONZEROS );
+    // Reference products computed densely
+    const std::experimental::math::dr_vector<double> x{ std::experimental::extents<size_t,n>(), []( auto j ) { return double( j % 11 ) - 5.0; } };
+    const std::experimental::math::dr_matrix<double> b{ std::experimental::extents<size_t,n,3>(), []( auto j, auto l ) { return double( ( j + l ) % 5 ); } };
+    std::vector<double> y_expected( n, 0.0 );
+    std::vector<double> c_expected( 3 * n, 0.0 );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t k = offsets[i]; k < offsets[i+1]; ++k )
+      {
+        const std::size_t j = static_cast<std::size_t>( columns[k] );
+        y_expected[i] += values[k] * std::experimental::math::detail::access( x, j );
+        for ( std::size_t l = 0; l < 3; ++l )
+        {
+          c_expected[3*i+l] += values[k] * std::experimental::math::detail::access( b, j, l );
+        }
+      }
+    }
+    // Products with a contiguous vector, a strided view, and a dense matrix
+    auto y = sparse * x;
+    auto z = sparse * b.column( 1 );
+    auto c = sparse * b;
+    ASSERT_EQ( y.size().extent(0), n );
+    ASSERT_EQ( c.rows(), n );
+    ASSERT_EQ( c.columns(), 3 );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_DOUBLE_EQ( ( std::experimental::math::detail::access( y, i ) ), y_expected[i] );
+      EXPECT_DOUBLE_EQ( ( std::experimental::math::detail::access( z, i ) ), c_expected[3*i+1] );
+      for ( std::size_t l = 0; l < 3; ++l )
+      {
+        EXPECT_DOUBLE_EQ( ( std::experimental::math::detail::access( c, i, l ) ), c_expected[3*i+l] );
+      }
+    }
+    // Products into existing storage
+    std::experimental::math::dr_vector<double> w{ std::experimental::extents<size_t,n>() };
+    spmv( sparse, x, w );
+    EXPECT_DOUBLE_EQ( ( std::experimental::math::detail::access( w, n - 1 ) ), y_expected[n-1] );
+    EXPECT_THROW( static_cast<void>( sparse * std::experimental::math::dr_vector<double>{ std::experimental::extents<size_t,5>() } ), std::length_error );
+  }
+
+  TEST( COO_BUILDER, CONCURRENT_ASSEMBLY )
+  {
+    constexpr std::size_t rows    = 300;
+    constexpr std::size_t columns = 700;
+    using builder_type = std::experimental::math::coo_builder<double,int>;
+    using extents_type = builder_type::extents_type;
+    // A small chunk size forces contributions to be assembled in many streamed chunks
+    builder_type builder{ extents_type( rows, columns ), 1000, std::allocator<double>() };
+    std::vector<double> expected( rows * columns, 0.0 );
+    // Each task contributes through its own inserter; positions repeat across tasks
+    constexpr std::size_t tasks = 64;
+    constexpr std::size_t per_task = 5000;
+    auto position = []( std::size_t task, std::size_t k ) { return std::pair<std::size_t,std::size_t>( ( 7 * k + task ) % rows, ( 13 * k + 3 * task ) % columns ); };
+    std::experimental::math::detail::for_each( LINALG_EXECUTION_PAR,
+                                               std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                                               std::experimental::math::detail::faux_index_iterator<std::size_t>( tasks ),
+                                               [&builder,&position]( std::size_t task )
+                                               {
+                                                 auto inserter = builder.make_inserter();
+                                                 for ( std::size_t k = 0; k < per_task; ++k )
+                                                 {
+                                                   const auto [ i, j ] = position( task, k );
+                                                   inserter.insert( static_cast<int>( i ), static_cast<int>( j ), double( k % 3 + 1 ) );
+                                                 }
+                                               } );
+    for ( std::size_t task = 0; task < tasks; ++task )
+    {
+      for ( std::size_t k = 0; k < per_task; ++k )
+      {
+        const auto [ i, j ] = position( task, k );
+        expected[ i * columns + j ] += double( k % 3 + 1 );
+      }
+    }
+    // Direct insertion and a dense block
+    builder.insert( 299, 699, 4.0 );
+    expected[ 299 * columns + 699 ] += 4.0;
+    const std::experimental::math::dr_matrix<double> block{ std::experimental::extents<size_t,3,4>(), []( auto i, auto j ) { return ( i == j ) ? 0.0 : double( i + j ); } };
+    builder.insert( 10, 20, block );
+    for ( std::size_t i = 0; i < 3; ++i )
+    {
+      for ( std::size_t j = 0; j < 4; ++j )
+      {
+        expected[ ( 10 + i ) * columns + 20 + j ] += ( i == j ) ? 0.0 : double( i + j );
+      }
+    }
+    EXPECT_THROW( builder.insert( 300, 0, 1.0 ), std::out_of_range );
+    EXPECT_THROW( builder.insert( 0, -1, 1.0 ), std::out_of_range );
+    EXPECT_THROW( builder.insert( 298, 0, block ), std::out_of_range );
+    // Either index needing all 64 bits of a key is rejected
+    EXPECT_THROW( builder_type( extents_type( 1, ( std::size_t( 1 ) << 63 ) + 1 ) ), std::length_error );
+    EXPECT_THROW( builder_type( extents_type( ( std::size_t( 1 ) << 63 ) + 1, 1 ) ), std::length_error );
+    // Compressed row and column storage hold the sums of all contributions
+    const auto csr = builder.finalize_csr();
+    const auto csc = builder.finalize_csc();
+    ASSERT_EQ( csr.rows(), rows );
+    ASSERT_EQ( csr.columns(), columns );
+    ASSERT_EQ( csc.rows(), columns );
+    ASSERT_EQ( csc.columns(), rows );
+    const auto nonzeros = static_cast<std::size_t>( std::count_if( expected.begin(), expected.end(), []( double v ) { return v != 0.0; } ) );
+    EXPECT_EQ( csr.nonzeros(), nonzeros );
+    EXPECT_EQ( csc.nonzeros(), nonzeros );
+    for ( std::size_t i = 0; i < rows; ++i )
+    {
+      for ( std::size_t j = 0; j < columns; ++j )
+      {
+        EXPECT_EQ( csr.at( static_cast<int>( i ), static_cast<int>( j ) ), expected[ i * columns + j ] );
+        EXPECT_EQ( csc.at( static_cast<int>( j ), static_cast<int>( i ) ), expected[ i * columns + j ] );
+      }
+    }
+    // Contributions are kept until cleared
+    builder.insert( 0, 0, 1.0 );
+    EXPECT_EQ( builder.finalize_csr().at( 0, 0 ), expected[0] + 1.0 );
+    builder.clear();
+    EXPECT_EQ( builder.finalize_csr().nonzeros(), 0 );
+  }
+
+  TEST( PACKED_MATRIX, LAYOUT_MAPPING )
+  {
+    using extents_type = std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent>;
+    constexpr std::size_t n = 5;
+    const extents_type s( n, n );
+    const std::experimental::math::layout_blas_packed<std::experimental::math::upper_triangle_t,std::experimental::math::row_major_t>::mapping<extents_type>       upper_rows( s );
+    const std::experimental::math::layout_blas_packed<std::experimental::math::upper_triangle_t,std::experimental::math::column_major_t>::mapping<extents_type>    upper_columns( s );
+    const std::experimental::math::layout_blas_packed<std::experimental::math::lower_triangle_t,std::experimental::math::row_major_t>::mapping<extents_type>       lower_rows( s );
+    const std::experimental::math::layout_blas_packed<std::experimental::math::lower_triangle_t,std::experimental::math::column_major_t>::mapping<extents_type>    lower_columns( s );
+    EXPECT_EQ( upper_rows.required_span_size(), 15 );
+    EXPECT_FALSE( upper_rows.is_unique() );
+    // Stored elements, visited in storage order, map to consecutive offsets
+    std::size_t ur = 0, uc = 0, lr = 0, lc = 0;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = i; j < n; ++j ) { EXPECT_EQ( static_cast<std::size_t>( upper_rows( i, j ) ), ur++ ); }
+      for ( std::size_t j = 0; j <= i; ++j ) { EXPECT_EQ( static_cast<std::size_t>( upper_columns( j, i ) ), uc++ ); }
+      for ( std::size_t j = 0; j <= i; ++j ) { EXPECT_EQ( static_cast<std::size_t>( lower_rows( i, j ) ), lr++ ); }
+      for ( std::size_t j = i; j < n; ++j ) { EXPECT_EQ( static_cast<std::size_t>( lower_columns( j, i ) ), lc++ ); }
+    }
+    // Other indices map to their mirror
+    EXPECT_EQ( upper_rows( 3, 1 ), upper_rows( 1, 3 ) );
+    EXPECT_EQ( lower_columns( 0, 4 ), lower_columns( 4, 0 ) );
+  }
+
+  TEST( PACKED_MATRIX, PRODUCTS )
+  {
+    using std::experimental::math::dr_matrix;
+    using std::experimental::math::dr_vector;
+    using complex_type = std::complex<double>;
+    constexpr std::size_t n = 6;
+    using extents_type = std::experimental::math::sym_matrix<double>::extents_type;
+    const extents_type s( n, n );
+    // Dense matrices hold both triangles; packing reads only the stored one
+    const dr_matrix<double> dense_sym{ std::experimental::extents<size_t,n,n>(), []( auto i, auto j ) { return double( i + j + 1 ) + double( i * j ); } };
+    const dr_matrix<complex_type> dense_herm{ std::experimental::extents<size_t,n,n>(), []( auto i, auto j )
+                                              { return complex_type( double( i + j + 1 ), double( j ) - double( i ) ); } };
+    const dr_matrix<double> dense_tri{ std::experimental::extents<size_t,n,n>(), []( auto i, auto j ) { return ( i >= j ) ? double( i - j + 1 ) : 0.0; } };
+    const std::experimental::math::sym_matrix<double,std::experimental::math::lower_triangle_t> sym( dense_sym );
+    const std::experimental::math::herm_matrix<complex_type> herm( dense_herm );
+    const std::experimental::math::tri_matrix<double,std::experimental::math::lower_triangle_t> tri( dense_tri );
+    EXPECT_EQ( sym.underlying_span().mapping().required_span_size(), 21 );
+    EXPECT_EQ( sym.size(), s );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        EXPECT_EQ( sym.at( i, j ), dense_sym( i, j ) );
+        EXPECT_EQ( herm.at( i, j ), dense_herm( i, j ) );
+        EXPECT_EQ( tri.at( i, j ), dense_tri( i, j ) );
+      }
+    }
+    EXPECT_THROW( (void) sym.at( n, 0 ), std::out_of_range );
+    EXPECT_THROW( std::experimental::math::sym_matrix<double>( extents_type( n, n + 1 ) ), std::length_error );
+    // Matrix vector products
+    const dr_vector<double> x{ std::experimental::extents<size_t,n>(), []( auto i ) { return double( i ) - 2.0; } };
+    const dr_vector<complex_type> xc{ std::experimental::extents<size_t,n>(), []( auto i ) { return complex_type( double( i ), 1.0 ); } };
+    const auto ys = sym * x;
+    const auto yh = herm * xc;
+    const auto yt = tri * x;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      double       es = 0.0, et = 0.0;
+      complex_type eh = 0.0;
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        es += dense_sym( i, j ) * x( j );
+        eh += dense_herm( i, j ) * xc( j );
+        et += dense_tri( i, j ) * x( j );
+      }
+      EXPECT_DOUBLE_EQ( ys( i ), es );
+      EXPECT_DOUBLE_EQ( yh( i ).real(), eh.real() );
+      EXPECT_DOUBLE_EQ( yh( i ).imag(), eh.imag() );
+      EXPECT_DOUBLE_EQ( yt( i ), et );
+    }
+    EXPECT_THROW( (void)( sym * dr_vector<double>( std::experimental::extents<size_t,n+1>() ) ), std::length_error );
+    // Products with dense matrices on either side
+    const dr_matrix<double> b{ std::experimental::extents<size_t,n,3>(), []( auto i, auto j ) { return double( i * 3 + j ) - 4.0; } };
+    const dr_matrix<double> a{ std::experimental::extents<size_t,2,n>(), []( auto i, auto j ) { return double( i + 2 * j ) - 1.0; } };
+    const auto sb = sym * b;
+    const auto tb = tri * b;
+    const auto as = a * sym;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        double es = 0.0, et = 0.0;
+        for ( std::size_t k = 0; k < n; ++k )
+        {
+          es += dense_sym( i, k ) * b( k, j );
+          et += dense_tri( i, k ) * b( k, j );
+        }
+        EXPECT_DOUBLE_EQ( sb( i, j ), es );
+        EXPECT_DOUBLE_EQ( tb( i, j ), et );
+      }
+    }
+    for ( std::size_t i = 0; i < 2; ++i )
+    {
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        double e = 0.0;
+        for ( std::size_t k = 0; k < n; ++k )
+        {
+          e += a( i, k ) * dense_sym( k, j );
+        }
+        EXPECT_DOUBLE_EQ( as( i, j ), e );
+      }
+    }
+  }
+
+  TEST( PACKED_MATRIX, SOLVES )
+  {
+    using std::experimental::math::dr_matrix;
+    using std::experimental::math::dr_vector;
+    using complex_type = std::complex<double>;
+    constexpr std::size_t n = 7;
+    using extents_type = std::experimental::math::sym_matrix<double>::extents_type;
+    const extents_type s( n, n );
+    // Diagonally dominant matrices are positive definite
+    const std::experimental::math::sym_matrix<double> sym( s, []( auto i, auto j ) { return ( i == j ) ? 20.0 + double( i ) : 1.0 / double( 1 + i + j ); } );
+    const std::experimental::math::herm_matrix<complex_type,std::experimental::math::lower_triangle_t> herm( s, []( auto i, auto j )
+      { return ( i == j ) ? complex_type( 20.0 + double( i ), 0.0 ) : complex_type( 1.0, double( i - j ) / 4.0 ); } );
+    const std::experimental::math::tri_matrix<double> upper( s, []( auto i, auto j ) { return double( 2 + i ) + double( j - i ) / 3.0; } );
+    const std::experimental::math::tri_matrix<double,std::experimental::math::lower_triangle_t> lower( s, []( auto i, auto j ) { return double( 1 + i + j ); } );
+    const dr_vector<double> b{ std::experimental::extents<size_t,n>(), []( auto i ) { return double( i ) - 3.0; } };
+    const dr_vector<complex_type> bc{ std::experimental::extents<size_t,n>(), []( auto i ) { return complex_type( 1.0, double( i ) ); } };
+    const auto check = []( const auto& m, const auto& rhs, const auto& solution )
+    {
+      const auto product = m * solution;
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+        EXPECT_NEAR( std::abs( product( i ) - rhs( i ) ), 0.0, 1e-12 );
+      }
+    };
+    check( sym, b, solve( sym, b ) );
+    check( herm, bc, solve( herm, bc ) );
+    check( upper, b, solve( upper, b ) );
+    check( lower, b, solve( lower, b ) );
+    // The Cholesky factor reproduces the matrix
+    const auto l = cholesky( herm );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        complex_type e = 0.0;
+        for ( std::size_t k = 0; k < n; ++k )
+        {
+          e += l( i, k ) * std::conj( l( j, k ) );
+        }
+        EXPECT_NEAR( std::abs( e - herm( i, j ) ), 0.0, 1e-12 );
+      }
+    }
+    // Multiple right hand sides
+    const dr_matrix<double> rhs{ std::experimental::extents<size_t,n,2>(), []( auto i, auto j ) { return double( i + 1 ) * double( j + 1 ); } };
+    const auto x = solve( sym, rhs );
+    const auto product = sym * x;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = 0; j < 2; ++j )
+      {
+        EXPECT_NEAR( product( i, j ), rhs( i, j ), 1e-12 );
+      }
+    }
+    // Singular and indefinite matrices
+    const std::experimental::math::tri_matrix<double> singular( s, []( auto i, auto j ) { return ( i == 3 && j == 3 ) ? 0.0 : 1.0; } );
+    const std::experimental::math::sym_matrix<double> indefinite( s, []( auto i, auto j ) { return ( i == j ) ? -1.0 : 0.0; } );
+    EXPECT_THROW( (void) solve( singular, b ), std::domain_error );
+    EXPECT_THROW( (void) solve( indefinite, b ), std::domain_error );
+  }
+
+  TEST( BAND_MATRIX, CONSTRUCTION_AND_PRODUCT )
+  {
+    using std::experimental::math::dr_matrix;
+    using std::experimental::math::dr_vector;
+    using band_type    = std::experimental::math::band_matrix<double>;
+    using extents_type = band_type::extents_type;
+    constexpr std::size_t rows    = 9;
+    constexpr std::size_t columns = 7;
+    // Dense matrix holding values outside the band, which must not be read
+    const dr_matrix<double> dense{ std::experimental::extents<size_t,rows,columns>(), []( auto i, auto j ) { return double( 10 * i + j + 1 ); } };
+    const band_type band( dense, 2, 1 );
+    EXPECT_EQ( band.lower_bandwidth(), 2 );
+    EXPECT_EQ( band.upper_bandwidth(), 1 );
+    EXPECT_EQ( band.underlying_span().mapping().required_span_size(), 4 * columns );
+    EXPECT_EQ( band.underlying_span().stride( 1 ), 3 );
+    for ( std::size_t i = 0; i < rows; ++i )
+    {
+      for ( std::size_t j = 0; j < columns; ++j )
+      {
+        const bool in_band = ( i <= j + 2 ) && ( j <= i + 1 );
+        EXPECT_EQ( band.at( i, j ), in_band ? dense( i, j ) : 0.0 );
+      }
+    }
+    EXPECT_THROW( (void) band.at( rows, 0 ), std::out_of_range );
+    // Banded matrix vector product against the dense product over the band
+    const dr_vector<double> x{ std::experimental::extents<size_t,columns>(), []( auto j ) { return double( j ) - 3.0; } };
+    const auto y = band * x;
+    ASSERT_EQ( y.size().extent(0), rows );
+    for ( std::size_t i = 0; i < rows; ++i )
+    {
+      double e = 0.0;
+      for ( std::size_t j = 0; j < columns; ++j )
+      {
+        e += band( i, j ) * x( j );
+      }
+      EXPECT_DOUBLE_EQ( y( i ), e );
+    }
+    EXPECT_THROW( (void)( band * dr_vector<double>( std::experimental::extents<size_t,rows>() ) ), std::length_error );
+    // Large bands are processed in parallel tasks
+    constexpr std::size_t n = 100000;
+    const band_type tridiagonal( extents_type( n, n ), 1, 1, []( auto i, auto j ) { return ( i == j ) ? 2.0 : -1.0; } );
+    const auto ones = tridiagonal * dr_vector<double>{ std::experimental::extents<size_t,n>(), []( auto ) { return 1.0; } };
+    EXPECT_EQ( ones( 0 ), 1.0 );
+    EXPECT_EQ( ones( n / 2 ), 0.0 );
+    EXPECT_EQ( ones( n - 1 ), 1.0 );
+  }
+
+  TEST( BAND_MATRIX, SOLVES )
+  {
+    using std::experimental::math::dr_matrix;
+    using std::experimental::math::dr_vector;
+    using band_type    = std::experimental::math::band_matrix<double>;
+    using extents_type = band_type::extents_type;
+    constexpr std::size_t n = 12;
+    // Pentadiagonal matrix with a zero diagonal, which requires row interchanges
+    const band_type penta( extents_type( n, n ), 2, 2, []( auto i, auto j ) { return ( i == j ) ? 0.0 : double( ( i * 7 + j * 3 ) % 5 + 1 ); } );
+    const dr_vector<double> b{ std::experimental::extents<size_t,n>(), []( auto i ) { return double( i ) - 4.0; } };
+    const auto x = solve( penta, b );
+    const auto product = penta * x;
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_NEAR( product( i ), b( i ), 1e-10 );
+    }
+    // Multiple right hand sides with an asymmetric band
+    const band_type skew( extents_type( n, n ), 1, 3, []( auto i, auto j ) { return ( i == j ) ? 1.0 : double( i + 2 * j ) / 10.0; } );
+    const dr_matrix<double> rhs{ std::experimental::extents<size_t,n,3>(), []( auto i, auto j ) { return double( i * j ) + 1.0; } };
+    const auto xs = solve( skew, rhs );
+    for ( std::size_t l = 0; l < 3; ++l )
+    {
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+        double e = 0.0;
+        for ( std::size_t j = 0; j < n; ++j )
+        {
+          e += skew( i, j ) * xs( j, l );
+        }
+        EXPECT_NEAR( e, rhs( i, l ), 1e-10 );
+      }
+    }
+    const band_type singular( extents_type( n, n ), 1, 1, []( auto i, auto ) { return ( i == 5 ) ? 0.0 : 1.0; } );
+    EXPECT_THROW( (void) solve( singular, b ), std::domain_error );
+    EXPECT_THROW( (void) solve( band_type( extents_type( n, n + 1 ), 1, 1 ), b ), std::length_error );
+  }
+
+  TEST( BAND_MATRIX, CYCLIC_REDUCTION )
+  {
+    using std::experimental::math::dr_vector;
+    using band_type    = std::experimental::math::band_matrix<double>;
+    using extents_type = band_type::extents_type;
+    // Small systems are solved directly and large ones are split across tasks
+    for ( const std::size_t n : { std::size_t( 1 ), std::size_t( 17 ), std::size_t( 1 << 16 ) } )
+    {
+      const band_type m( extents_type( n, n ), 1, 1, []( auto i, auto j ) { return ( i == j ) ? 4.0 + double( i % 3 ) : ( i < j ? -1.0 : -1.5 ); } );
+      const dr_vector<double> b{ std::experimental::extents<size_t,std::experimental::dynamic_extent>( n ), []( auto i ) { return double( i % 11 ) - 5.0; } };
+      const auto x         = cyclic_reduction_solve( m, b );
+      const auto reference = solve( m, b );
+      const auto product   = m * x;
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+        EXPECT_NEAR( product( i ), b( i ), 1e-10 );
+        EXPECT_NEAR( x( i ), reference( i ), 1e-10 );
+      }
+    }
+    EXPECT_THROW( (void) cyclic_reduction_solve( band_type( extents_type( 4, 4 ), 2, 1 ), dr_vector<double>{ std::experimental::extents<size_t,4>() } ),
+                  std::invalid_argument );
+  }
+
+  TEST( DIAGONAL_MATRIX, PRODUCTS_SUMS_AND_SOLVES )
+  {
+    using std::experimental::math::dr_matrix;
+    using std::experimental::math::dr_vector;
+    using diagonal_type = std::experimental::math::diagonal_matrix<double>;
+    using identity_type = std::experimental::math::identity_matrix<double>;
+    using scaled_type   = std::experimental::math::scaled_identity_matrix<double>;
+    using extents_type  = diagonal_type::extents_type;
+    constexpr std::size_t n = 5;
+    const extents_type s( n, n );
+    const diagonal_type d( s, []( auto i ) { return double( i ) + 1.0; } );
+    const identity_type e( s );
+    const scaled_type   a( s, 3.0 );
+    // Element access and the stored values
+    EXPECT_EQ( d.diagonal_span().extent(0), n );
+    EXPECT_EQ( a.diagonal_span().extent(0), 1 );
+    EXPECT_EQ( e.diagonal_span().extent(0), 0 );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        EXPECT_EQ( d.at( i, j ), ( i == j ) ? double( i ) + 1.0 : 0.0 );
+        EXPECT_EQ( e.at( i, j ), ( i == j ) ? 1.0 : 0.0 );
+        EXPECT_EQ( a.at( i, j ), ( i == j ) ? 3.0 : 0.0 );
+      }
+    }
+    EXPECT_THROW( (void) d.at( n, 0 ), std::out_of_range );
+    EXPECT_THROW( diagonal_type( extents_type( n, n + 1 ) ), std::length_error );
+    const dr_vector<double> v{ std::experimental::extents<size_t,n>(), []( auto i ) { return 2.0 * double( i ); } };
+    EXPECT_EQ( diagonal_type( v ).at( 3, 3 ), 6.0 );
+    // Products and sums between diagonal matrices keep the narrowest structure
+    const auto ee = e * e;
+    const auto ae = a * e;
+    const auto da = d * a;
+    const auto ea = e + a;
+    const auto dm = d - e;
+    const auto ns = -e;
+    const auto sd = 2.0 * d;
+    static_assert( std::is_same_v< std::decay_t<decltype( ee )>, identity_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( ae )>, scaled_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( da )>, diagonal_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( ea )>, scaled_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( dm )>, diagonal_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( ns )>, scaled_type > );
+    static_assert( std::is_same_v< std::decay_t<decltype( sd )>, diagonal_type > );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_EQ( ae.diagonal( i ), 3.0 );
+      EXPECT_EQ( da.diagonal( i ), 3.0 * ( double( i ) + 1.0 ) );
+      EXPECT_EQ( ea.diagonal( i ), 4.0 );
+      EXPECT_EQ( dm.diagonal( i ), double( i ) );
+      EXPECT_EQ( ns.diagonal( i ), -1.0 );
+      EXPECT_EQ( sd.diagonal( i ), 2.0 * ( double( i ) + 1.0 ) );
+      EXPECT_EQ( ( a / 2.0 ).diagonal( i ), 1.5 );
+    }
+    EXPECT_THROW( (void)( d * identity_type( extents_type( n + 1, n + 1 ) ) ), std::length_error );
+    // Products, sums and solves with vectors and dense matrices
+    const dr_matrix<double> b{ std::experimental::extents<size_t,n,n>(), []( auto i, auto j ) { return double( 10 * i + j ); } };
+    const auto dv = d * v;
+    const auto db = d * b;
+    const auto bd = b * d;
+    const auto eb = e * b;
+    const auto dpb = d + b;
+    const auto bma = b - a;
+    const auto amb = a - b;
+    const auto xv = solve( d, v );
+    const auto xb = solve( a, b );
+    for ( std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_EQ( dv( i ), ( double( i ) + 1.0 ) * v( i ) );
+      EXPECT_DOUBLE_EQ( xv( i ), v( i ) / ( double( i ) + 1.0 ) );
+      for ( std::size_t j = 0; j < n; ++j )
+      {
+        EXPECT_EQ( db( i, j ), ( double( i ) + 1.0 ) * b( i, j ) );
+        EXPECT_EQ( bd( i, j ), b( i, j ) * ( double( j ) + 1.0 ) );
+        EXPECT_EQ( eb( i, j ), b( i, j ) );
+        EXPECT_EQ( dpb( i, j ), b( i, j ) + d( i, j ) );
+        EXPECT_EQ( bma( i, j ), b( i, j ) - a( i, j ) );
+        EXPECT_EQ( amb( i, j ), a( i, j ) - b( i, j ) );
+        EXPECT_DOUBLE_EQ( xb( i, j ), b( i, j ) / 3.0 );
+      }
+    }
+    EXPECT_THROW( (void) solve( dm, v ), std::domain_error );
+    EXPECT_THROW( (void)( d * dr_vector<double>( std::experimental::extents<size_t,n+1>() ) ), std::length_error );
+    // Conjugation touches only the stored values
+    const std::experimental::math::diagonal_matrix<std::complex<double>> c( s, []( auto i ) { return std::complex<double>( 1.0, double( i ) ); } );
+    EXPECT_EQ( conj( c ).diagonal( 2 ), std::complex<double>( 1.0, -2.0 ) );
+    EXPECT_EQ( trans( a ).diagonal( 4 ), 3.0 );
+  }
+
 }
\ No newline at end of file
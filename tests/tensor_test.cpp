@@ -1046,6 +1046,370 @@ namespace
     EXPECT_EQ( val8, 4.0 );
   }
 
+  TEST( DR_TENSOR, ELEMENTWISE_TRAVERSAL )
+  {
+    using tensor_type = std::experimental::math::dr_tensor<double,3>;
+    // Construct an exhaustive tensor, a tensor with additional capacity, and a fixed size tensor
+    tensor_type exhaustive_tensor{ std::experimental::extents<size_t,2,3,4>(), std::experimental::extents<size_t,2,3,4>(),
+                                   []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    tensor_type padded_tensor{ std::experimental::extents<size_t,2,3,4>(), std::experimental::extents<size_t,3,3,5>(),
+                               []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    std::experimental::math::fs_tensor<double,std::experimental::layout_right,std::experimental::default_accessor<double>,2,3,4> fixed_tensor{
+                               []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    // Views which share a layout may be traversed linearly
+    EXPECT_TRUE( std::experimental::math::detail::is_linear_traversable( exhaustive_tensor.underlying_span(), fixed_tensor.underlying_span() ) );
+    EXPECT_FALSE( std::experimental::math::detail::is_linear_traversable( exhaustive_tensor.underlying_span(), padded_tensor.underlying_span() ) );
+    EXPECT_FALSE( std::experimental::math::detail::is_linear_traversable( padded_tensor.underlying_span() ) );
+    // Linear traversal
+    std::experimental::math::detail::apply_all_elementwise( []( auto&& lhs, auto&& rhs ) { lhs += rhs; },
+                                                            LINALG_EXECUTION_UNSEQ,
+                                                            exhaustive_tensor.underlying_span(),
+                                                            fixed_tensor.underlying_span() );
+    // Multi-index traversal
+    std::experimental::math::detail::apply_all_elementwise( []( auto&& lhs, auto&& rhs ) { lhs += rhs; },
+                                                            LINALG_EXECUTION_UNSEQ,
+                                                            padded_tensor.underlying_span(),
+                                                            exhaustive_tensor.underlying_span() );
+    // Check both traversals visited each corresponding element
+    for ( std::size_t i = 0; i < 2; ++i )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        for ( std::size_t k = 0; k < 4; ++k )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( exhaustive_tensor, i, j, k ) ), double( 2 * ( 100 * i + 10 * j + k ) ) );
+          EXPECT_EQ( ( std::experimental::math::detail::access( padded_tensor, i, j, k ) ), double( 3 * ( 100 * i + 10 * j + k ) ) );
+        }
+      }
+    }
+  }
+
+  TEST( DR_TENSOR, RUNTIME_STRIDED_TRAVERSAL )
+  {
+    using extents_type = std::experimental::extents<size_t,std::experimental::dynamic_extent,std::experimental::dynamic_extent,std::experimental::dynamic_extent>;
+    using mapping_type = std::experimental::layout_stride::mapping<extents_type>;
+    using span_type    = std::experimental::mdspan<double,extents_type,std::experimental::layout_stride>;
+    // Column major 2x3x4 view padded along the first dimension
+    std::array<double,3*3*4> elems {};
+    span_type view { elems.data(), mapping_type( extents_type( 2, 3, 4 ), std::array<size_t,3>{ 1, 3, 9 } ) };
+    // Stride order is determined at run time
+    std::experimental::math::detail::runtime_stride_order<mapping_type> order( view.mapping() );
+    EXPECT_EQ( order.get_nth_largest_stride_index( 0 ), 2 );
+    EXPECT_EQ( order.get_nth_largest_stride_index( 1 ), 1 );
+    EXPECT_EQ( order.get_nth_largest_stride_index( 2 ), 0 );
+    // Each element is visited once and memory is visited in increasing order
+    std::vector<std::size_t> offsets;
+    std::experimental::math::detail::apply_all( view,
+                                                [&view,&offsets]( auto i, auto j, auto k )
+                                                  { offsets.push_back( view.mapping()( i, j, k ) );
+                                                    std::experimental::math::detail::access( view, i, j, k ) += 1.0; },
+                                                LINALG_EXECUTION_SEQ );
+    ASSERT_EQ( offsets.size(), 24 );
+    EXPECT_TRUE( std::is_sorted( offsets.begin(), offsets.end() ) );
+    for ( std::size_t i = 0; i < 2; ++i )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        for ( std::size_t k = 0; k < 4; ++k )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( view, i, j, k ) ), 1.0 );
+        }
+      }
+    }
+    // Padding is never touched
+    EXPECT_EQ( elems[2], 0.0 );
+  }
+
+  TEST( DR_TENSOR, FIRST_TOUCH_CONSTRUCTOR )
+  {
+    std::experimental::math::thread_pool pool( 3 );
+    std::experimental::math::thread_pool_policy policy( pool );
+    // Value initialize in parallel
+    std::experimental::math::dr_tensor<double,3> zero_tensor( std::experimental::extents<size_t,4,5,6>(), std::experimental::extents<size_t,4,5,6>(), policy, std::allocator<double>() );
+    // Construct from lambda expression in parallel
+    std::experimental::math::dr_tensor<double,3> dyn_tensor( std::experimental::extents<size_t,4,5,6>(),
+                                                             std::experimental::extents<size_t,5,5,6>(),
+                                                             []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); },
+                                                             policy,
+                                                             std::allocator<double>() );
+    std::experimental::math::dr_matrix<double> dyn_matrix( std::experimental::extents<size_t,7,3>(),
+                                                           std::experimental::extents<size_t,7,3>(),
+                                                           []( auto i, auto j ) { return double( 10 * i + j ); },
+                                                           policy,
+                                                           std::allocator<double>() );
+    std::experimental::math::dr_vector<double> dyn_vector( std::experimental::extents<size_t,9>(),
+                                                           std::experimental::extents<size_t,9>(),
+                                                           []( auto i ) { return double( i ); },
+                                                           policy,
+                                                           std::allocator<double>() );
+    for ( std::size_t i = 0; i < 4; ++i )
+    {
+      for ( std::size_t j = 0; j < 5; ++j )
+      {
+        for ( std::size_t k = 0; k < 6; ++k )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( zero_tensor, i, j, k ) ), 0.0 );
+          EXPECT_EQ( ( std::experimental::math::detail::access( dyn_tensor, i, j, k ) ), double( 100 * i + 10 * j + k ) );
+        }
+      }
+    }
+    for ( std::size_t i = 0; i < 7; ++i )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, i, j ), double( 10 * i + j ) );
+      }
+    }
+    for ( std::size_t i = 0; i < 9; ++i )
+    {
+      EXPECT_EQ( std::experimental::math::detail::access( dyn_vector, i ), double( i ) );
+    }
+    // Capacity spanning many pages, most of which lie beyond the elements
+    std::experimental::math::dr_matrix<double> wide_matrix( std::experimental::extents<size_t,300,20>(),
+                                                            std::experimental::extents<size_t,400,64>(),
+                                                            []( auto i, auto j ) { return double( 100 * i + j ); },
+                                                            policy,
+                                                            std::allocator<double>() );
+    for ( std::size_t i = 0; i < 300; ++i )
+    {
+      for ( std::size_t j = 0; j < 20; ++j )
+      {
+        EXPECT_EQ( std::experimental::math::detail::access( wide_matrix, i, j ), double( 100 * i + j ) );
+      }
+    }
+  }
+
+  TEST( DR_TENSOR, NUMA_INTERLEAVE_ALLOCATOR )
+  {
+    using allocator_type = std::experimental::math::numa_interleave_allocator<double>;
+    EXPECT_GE( allocator_type::node_count(), 1 );
+    EXPECT_TRUE( allocator_type() == std::experimental::math::numa_interleave_allocator<float>() );
+    // Tensors may allocate from the interleave allocator
+    std::experimental::math::dr_matrix<double,allocator_type> dyn_matrix( std::experimental::extents<size_t,64,32>(),
+                                                                          std::experimental::extents<size_t,64,32>(),
+                                                                          []( auto i, auto j ) { return double( 100 * i + j ); },
+                                                                          std::experimental::math::thread_pool_policy(),
+                                                                          allocator_type() );
+    auto dyn_matrix_copy = dyn_matrix;
+    for ( std::size_t i = 0; i < 64; ++i )
+    {
+      for ( std::size_t j = 0; j < 32; ++j )
+      {
+        EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix_copy, i, j ), double( 100 * i + j ) );
+      }
+    }
+    // Growth along the slowest dimension remaps the pages and keeps the elements
+    dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 1000, 32 ) );
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, 63, 31 ), 6331.0 );
+  }
+
+  TEST( DR_TENSOR, HUGE_PAGE_ALLOCATOR )
+  {
+    using allocator_type = std::experimental::math::huge_page_allocator<double>;
+    EXPECT_TRUE( allocator_type() == std::experimental::math::huge_page_allocator<float>() );
+    // Small allocations use normal pages
+    std::experimental::math::dr_matrix<double,allocator_type> small_matrix{ std::experimental::extents<size_t,4,4>(),
+                                                                            []( auto i, auto j ) { return double( 4 * i + j ); } };
+    EXPECT_EQ( std::experimental::math::detail::access( small_matrix, 3, 2 ), 14.0 );
+    // Large allocations are aligned to a huge page
+    std::experimental::math::dr_matrix<double,allocator_type> dyn_matrix{ std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 1024, 512 ),
+                                                                          []( auto i, auto j ) { return double( 1000 * i + j ); } };
+    #if LINALG_HUGE_PAGES
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( &std::experimental::math::detail::access( dyn_matrix, 0, 0 ) ) % allocator_type::page_size, 0u );
+    #endif
+    // Growth along the slowest dimension extends the mapping and keeps the elements
+    dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 3000, 512 ) );
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, 1023, 511 ), 1023511.0 );
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, 17, 3 ), 17003.0 );
+    // Shrinking below the threshold moves the elements back to normal pages
+    dyn_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 8, 8 ) );
+    dyn_matrix.shrink_to_fit();
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, 7, 7 ), 7007.0 );
+  }
+
+  TEST( DR_TENSOR, BULK_RELOCATION )
+  {
+    using tensor_type = std::experimental::math::dr_tensor<double,3>;
+    auto value = []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); };
+    tensor_type dyn_tensor{ std::experimental::extents<size_t,3,4,5>(), value };
+    // Grow and shrink different dimensions at once; remaining elements are copied in runs
+    dyn_tensor.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent,dynamic_extent>( 5, 2, 7 ) );
+    for ( size_t i = 0; i < 3; ++i )
+    {
+      for ( size_t j = 0; j < 2; ++j )
+      {
+        for ( size_t k = 0; k < 5; ++k )
+        {
+          EXPECT_EQ( std::experimental::math::detail::access( dyn_tensor, i, j, k ), value( i, j, k ) );
+        }
+      }
+    }
+    // Copies of tensors with slack in their capacity copy only the elements in size
+    tensor_type dyn_tensor_copy{ dyn_tensor };
+    EXPECT_EQ( dyn_tensor_copy.capacity(), dyn_tensor.capacity() );
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_tensor_copy, 2, 1, 4 ), value( 2, 1, 4 ) );
+    // Layout left tensors grow in the same way
+    using left_matrix_type = std::experimental::math::dr_matrix<double,std::allocator<double>,std::experimental::layout_left>;
+    left_matrix_type left_matrix{ std::experimental::extents<size_t,3,2>(), []( auto i, auto j ) { return double( 10 * i + j ); } };
+    left_matrix.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 4, 5 ) );
+    EXPECT_EQ( std::experimental::math::detail::access( left_matrix, 2, 1 ), 21.0 );
+    EXPECT_EQ( std::experimental::math::detail::access( left_matrix, 0, 1 ), 1.0 );
+    // Elements which are not trivially default constructible are value initialized when growing
+    std::experimental::math::dr_vector<std::complex<double>> complex_vector{ std::experimental::extents<size_t,2>(), []( auto i ) { return std::complex<double>( double( i ), 1.0 ); } };
+    complex_vector.resize( 4 );
+    EXPECT_EQ( std::experimental::math::detail::access( complex_vector, 1 ), std::complex<double>( 1.0, 1.0 ) );
+    EXPECT_EQ( std::experimental::math::detail::access( complex_vector, 3 ), std::complex<double>() );
+  }
+
+  // Element counting its live instances, whose default constructor throws once a limit is reached
+  struct counted_element
+  {
+    static inline int live            = 0;
+    static inline int remaining_ctors = -1;
+    counted_element()
+    {
+      if ( remaining_ctors == 0 ) { throw std::runtime_error( "Construction failed." ); }
+      if ( remaining_ctors > 0 ) { --remaining_ctors; }
+      ++live;
+    }
+    counted_element( const counted_element& rhs ) : value( rhs.value ) { ++live; }
+    counted_element& operator = ( const counted_element& ) = default;
+    ~counted_element() { --live; }
+    operator double() const noexcept { return this->value; }
+    double value = 1.0;
+  };
+
+  TEST( DR_TENSOR, REALLOCATION_EXCEPTION_SAFETY )
+  {
+    using tensor_type = std::experimental::math::dr_tensor<counted_element,2>;
+    {
+      tensor_type dyn_tensor{ std::experimental::extents<size_t,3,4>(), std::experimental::extents<size_t,3,4>() };
+      EXPECT_EQ( counted_element::live, 12 );
+      // Fail part way through default constructing the new elements
+      counted_element::remaining_ctors = 5;
+      EXPECT_THROW( dyn_tensor.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 6, 8 ) ), std::runtime_error );
+      counted_element::remaining_ctors = -1;
+      // The elements built before the exception were destroyed and the current elements are intact
+      EXPECT_EQ( counted_element::live, 12 );
+      EXPECT_EQ( dyn_tensor.size(), ( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 3, 4 ) ) );
+      for ( size_t i = 0; i < 3; ++i )
+      {
+        for ( size_t j = 0; j < 4; ++j )
+        {
+          EXPECT_EQ( std::experimental::math::detail::access( dyn_tensor, i, j ).value, 1.0 );
+        }
+      }
+      // A later reallocation succeeds
+      dyn_tensor.resize( std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 6, 8 ) );
+      EXPECT_EQ( counted_element::live, 48 );
+      EXPECT_EQ( std::experimental::math::detail::access( dyn_tensor, 2, 3 ).value, 1.0 );
+    }
+    EXPECT_EQ( counted_element::live, 0 );
+  }
+
+  TEST( DR_TENSOR, UNINITIALIZED_CONSTRUCTION )
+  {
+    // Fill the memory the tensor will occupy with a pattern, which must survive construction
+    alignas(64) static std::byte buffer[4096];
+    std::memset( buffer, 0x5A, sizeof( buffer ) );
+    std::experimental::math::workspace ws( buffer, sizeof( buffer ) );
+    using matrix_type = std::experimental::math::dr_matrix<double,std::experimental::math::arena_allocator<double>>;
+    matrix_type dyn_matrix{ std::experimental::extents<size_t,dynamic_extent,dynamic_extent>( 4, 8 ),
+                            std::experimental::math::uninitialized,
+                            std::experimental::math::arena_allocator<double>( ws ) };
+    EXPECT_EQ( static_cast<const void*>( &std::experimental::math::detail::access( dyn_matrix, 0, 0 ) ), static_cast<const void*>( buffer ) );
+    for ( std::size_t n = 0; n < 4 * 8 * sizeof(double); ++n )
+    {
+      EXPECT_EQ( buffer[n], std::byte{ 0x5A } );
+    }
+    // Every element may then be written
+    for ( std::size_t i = 0; i < 4; ++i )
+    {
+      for ( std::size_t j = 0; j < 8; ++j )
+      {
+        std::experimental::math::detail::access( dyn_matrix, i, j ) = double( 8 * i + j );
+      }
+    }
+    EXPECT_EQ( std::experimental::math::detail::access( dyn_matrix, 3, 7 ), 31.0 );
+    std::experimental::math::dr_vector<double> dyn_vector{ std::experimental::extents<size_t,dynamic_extent>( 5 ), std::experimental::math::uninitialized };
+    EXPECT_EQ( dyn_vector.size().extent(0), 5u );
+    // Fixed size tensors leave their elements untouched as well
+    using fs_matrix_type = std::experimental::math::fs_matrix<double,2,3>;
+    alignas( fs_matrix_type ) std::byte storage[ sizeof( fs_matrix_type ) ];
+    std::memset( storage, 0x5A, sizeof( storage ) );
+    auto* fs_matrix = ::new ( storage ) fs_matrix_type( std::experimental::math::uninitialized );
+    for ( std::size_t n = 0; n < sizeof( storage ); ++n )
+    {
+      EXPECT_EQ( storage[n], std::byte{ 0x5A } );
+    }
+    std::experimental::math::detail::access( *fs_matrix, 1, 2 ) = 5.0;
+    EXPECT_EQ( std::experimental::math::detail::access( *fs_matrix, 1, 2 ), 5.0 );
+    fs_matrix->~fs_matrix_type();
+    // Only trivially default constructible elements may be left uninitialized
+    EXPECT_TRUE( ( std::is_constructible_v< std::experimental::math::fs_tensor<double,std::experimental::layout_right,std::experimental::default_accessor<double>,2,2>, std::experimental::math::uninitialized_t > ) );
+    EXPECT_FALSE( ( std::is_constructible_v< std::experimental::math::fs_tensor<counted_element,std::experimental::layout_right,std::experimental::default_accessor<counted_element>,2,2>, std::experimental::math::uninitialized_t > ) );
+    EXPECT_FALSE( ( std::is_constructible_v< std::experimental::math::fs_matrix<counted_element,2,2>, std::experimental::math::uninitialized_t > ) );
+    EXPECT_FALSE( ( std::is_constructible_v< std::experimental::math::fs_vector<counted_element,2>, std::experimental::math::uninitialized_t > ) );
+  }
+
+  TEST( DR_TENSOR, SLICE_RANGES )
+  {
+    std::experimental::math::dr_tensor<double,3> tensor{ std::experimental::extents<size_t,2,3,4>(), []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    // Slices along the last dimension are matrix views
+    auto slices = std::experimental::math::slices<2>( tensor );
+    EXPECT_EQ( slices.size(), 4u );
+    std::experimental::math::detail::for_each( LINALG_EXECUTION_PAR, slices.begin(), slices.end(), []( auto slice )
+    {
+      EXPECT_EQ( slice.rows(), 2u );
+      EXPECT_EQ( slice.columns(), 3u );
+      std::experimental::math::detail::access( slice, 1, 2 ) += 1000.0;
+    } );
+    for ( std::size_t k = 0; k < 4; ++k )
+    {
+      EXPECT_EQ( ( std::experimental::math::detail::access( tensor, 1, 2, k ) ), double( 1120 + k ) );
+      EXPECT_EQ( ( std::experimental::math::detail::access( tensor, 0, 2, k ) ), double( 20 + k ) );
+    }
+    // Slices of a rank four tensor are tensor views
+    std::experimental::math::dr_tensor<double,4> tensor4{ std::experimental::extents<size_t,2,2,2,2>() };
+    auto slices4 = std::experimental::math::slices<1>( tensor4 );
+    EXPECT_EQ( slices4.size(), 2u );
+    EXPECT_EQ( ( *slices4.begin() ).size(), ( std::experimental::extents<size_t,2,2,2>() ) );
+  }
+
+  TEST( DR_TENSOR, TILE_GRID )
+  {
+    std::experimental::math::dr_tensor<double,3> tensor{ std::experimental::extents<size_t,3,4,5>(), []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    auto grid = std::experimental::math::tiles( tensor, std::experimental::extents<size_t,2,2,2>() );
+    EXPECT_EQ( grid.size(), 2u * 2u * 3u );
+    // Ragged tiles hold the remaining elements
+    auto tile = grid.tile( 1, 1, 2 );
+    EXPECT_EQ( tile.size(), ( std::experimental::extents<size_t,1,2,1>() ) );
+    EXPECT_EQ( ( std::experimental::math::detail::access( tile, 0, 1, 0 ) ), 234.0 );
+    // Tile element counts add up to the tensor
+    std::size_t count = 0;
+    for ( auto t : grid )
+    {
+      count += t.size().extent( 0 ) * t.size().extent( 1 ) * t.size().extent( 2 );
+    }
+    EXPECT_EQ( count, 60u );
+  }
+
+  TEST( DR_TENSOR, MORTON_LAYOUT )
+  {
+    using tensor_type = std::experimental::math::dr_tensor<double,3,std::allocator<double>,std::experimental::math::layout_morton>;
+    tensor_type tensor{ std::experimental::extents<size_t,4,5,6>(), []( auto i, auto j, auto k ) { return double( 100 * i + 10 * j + k ); } };
+    // Offsets interleave the bits of all three indices, the last index in the least significant bit
+    const double* origin = &std::experimental::math::detail::access( tensor, 0, 0, 0 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tensor, 0, 0, 1 ) - origin, 1 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tensor, 0, 1, 0 ) - origin, 2 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tensor, 1, 0, 0 ) - origin, 4 );
+    EXPECT_EQ( &std::experimental::math::detail::access( tensor, 1, 1, 1 ) - origin, 7 );
+    EXPECT_EQ( ( std::experimental::math::detail::access( tensor, 3, 4, 5 ) ), 345.0 );
+    // Slices remain Morton ordered
+    auto slice = std::experimental::math::slices<1>( tensor )[3];
+    EXPECT_EQ( ( std::experimental::math::detail::access( slice, 2, 4 ) ), 234.0 );
+  }
+
   TEST( FS_TENSOR, DEFAULT_CONSTRUCTOR_AND_DESTRUCTOR )
   {
     // Default construction
@@ -1279,7 +1643,62 @@ namespace
     EXPECT_EQ( val7, 7.0 );
     EXPECT_EQ( val8, 8.0 );
   }
-  
+
+  // Element which records whether it was default constructed or assigned
+  struct counted
+  {
+    counted() noexcept : value( 0 ), defaults( 1 ), assignments( 0 ) { }
+    counted( int v ) noexcept : value( v ), defaults( 0 ), assignments( 0 ) { }
+    counted( const counted& ) = default;
+    counted& operator = ( const counted& rhs ) noexcept { value = rhs.value; ++assignments; return *this; }
+    friend counted operator - ( const counted& c ) noexcept { return counted( -c.value ); }
+    friend counted operator + ( const counted& lhs, const counted& rhs ) noexcept { return counted( lhs.value + rhs.value ); }
+    friend counted operator - ( const counted& lhs, const counted& rhs ) noexcept { return counted( lhs.value - rhs.value ); }
+    friend counted operator * ( const counted& lhs, const counted& rhs ) noexcept { return counted( lhs.value * rhs.value ); }
+    friend counted operator / ( const counted& lhs, const counted& rhs ) noexcept { return counted( lhs.value / rhs.value ); }
+    int value;
+    int defaults;
+    int assignments;
+  };
+
+  TEST( FS_TENSOR, DIRECT_ELEMENT_INITIALIZATION )
+  {
+    using left_tensor_type  = std::experimental::math::fs_tensor<counted,std::experimental::layout_left,std::experimental::default_accessor<counted>,2,3,2>;
+    using right_tensor_type = std::experimental::math::fs_tensor<counted,std::experimental::layout_right,std::experimental::default_accessor<counted>,2,3,2>;
+    // Construct from lambda, recording the order of evaluation
+    int calls = 0;
+    left_tensor_type left_tensor( [&calls]( auto i, auto j, auto k ) { ++calls; return static_cast<int>( 100 * i + 10 * j + k ); } );
+    EXPECT_EQ( calls, 12 );
+    // Elements were written once, in storage order
+    const counted* data = &std::experimental::math::detail::access( left_tensor, 0, 0, 0 );
+    EXPECT_EQ( data[1].value, 100 );
+    EXPECT_EQ( data[2].value, 10 );
+    EXPECT_EQ( data[6].value, 1 );
+    for ( std::size_t n = 0; n < 12; ++n )
+    {
+      EXPECT_EQ( data[n].defaults, 0 );
+      EXPECT_EQ( data[n].assignments, 0 );
+    }
+    // Construct from another tensor and from a view of a different layout
+    right_tensor_type right_tensor( left_tensor );
+    right_tensor_type right_view_tensor( left_tensor.span() );
+    for ( std::size_t i = 0; i < 2; ++i )
+    {
+      for ( std::size_t j = 0; j < 3; ++j )
+      {
+        for ( std::size_t k = 0; k < 2; ++k )
+        {
+          const counted& elem      = std::experimental::math::detail::access( right_tensor, i, j, k );
+          const counted& view_elem = std::experimental::math::detail::access( right_view_tensor, i, j, k );
+          EXPECT_EQ( elem.value, static_cast<int>( 100 * i + 10 * j + k ) );
+          EXPECT_EQ( view_elem.value, elem.value );
+          EXPECT_EQ( elem.defaults + elem.assignments, 0 );
+          EXPECT_EQ( view_elem.defaults + view_elem.assignments, 0 );
+        }
+      }
+    }
+  }
+
   TEST( FS_TENSOR, ASSIGNMENT_OPERATOR )
   {
     using fs_tensor_type = std::experimental::math::fs_tensor<double,std::experimental::layout_right,std::experimental::default_accessor<double>,2,2,2>;
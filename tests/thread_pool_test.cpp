@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+  TEST( THREAD_POOL, CONSTRUCTOR_AND_DESTRUCTOR )
+  {
+    // Construct with an explicit number of threads
+    std::experimental::math::thread_pool pool( 3 );
+    EXPECT_EQ( pool.thread_count(), 3 );
+    // Construct with hardware concurrency
+    std::experimental::math::thread_pool default_pool;
+    EXPECT_GE( default_pool.thread_count(), 1 );
+    // Destructor will join the worker threads when the unit test ends
+  }
+
+  TEST( THREAD_POOL, PARALLEL_FOR )
+  {
+    std::experimental::math::thread_pool pool( 4 );
+    std::vector< std::atomic<int> > visits( 10000 );
+    // Each index must be visited exactly once for a variety of grain sizes
+    for ( std::size_t grain_size : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(100000) } )
+    {
+      for ( auto& visit : visits ) { visit.store( 0 ); }
+      pool.parallel_for( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                         std::experimental::math::detail::faux_index_iterator<std::size_t>( visits.size() ),
+                         [&visits]( std::size_t index ) { static_cast<void>( visits[index].fetch_add( 1 ) ); },
+                         grain_size );
+      for ( auto& visit : visits ) { EXPECT_EQ( visit.load(), 1 ); }
+    }
+  }
+
+  TEST( THREAD_POOL, NESTED_PARALLEL_FOR )
+  {
+    std::experimental::math::thread_pool pool( 2 );
+    std::atomic<std::size_t> sum( 0 );
+    // Nested loops on the same pool must not deadlock
+    pool.parallel_for( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                       std::experimental::math::detail::faux_index_iterator<std::size_t>( 16 ),
+                       [&pool,&sum]( std::size_t i )
+                       {
+                         pool.parallel_for( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                                            std::experimental::math::detail::faux_index_iterator<std::size_t>( 16 ),
+                                            [&sum,i]( std::size_t j ) { static_cast<void>( sum.fetch_add( i * 16 + j ) ); },
+                                            1 );
+                       },
+                       1 );
+    EXPECT_EQ( sum.load(), std::size_t( 255 * 256 / 2 ) );
+  }
+
+  TEST( THREAD_POOL, PARALLEL_FOR_EXCEPTION )
+  {
+    std::experimental::math::thread_pool pool( 2 );
+    std::atomic<std::size_t> count( 0 );
+    // Exceptions thrown by any task are rethrown after all tasks complete
+    EXPECT_THROW( pool.parallel_for( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                                     std::experimental::math::detail::faux_index_iterator<std::size_t>( 100 ),
+                                     [&count]( std::size_t index )
+                                     {
+                                       static_cast<void>( count.fetch_add( 1 ) );
+                                       if ( index == 50 ) throw std::runtime_error( "Expected failure." );
+                                     },
+                                     10 ),
+                  std::runtime_error );
+    // The pool remains usable
+    pool.parallel_for( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                       std::experimental::math::detail::faux_index_iterator<std::size_t>( 100 ),
+                       [&count]( std::size_t ) { static_cast<void>( count.fetch_add( 1 ) ); } );
+    EXPECT_GE( count.load(), 100 );
+  }
+
+  TEST( THREAD_POOL, PARALLEL_FOR_STATIC )
+  {
+    // Partitions are contiguous, balanced and cover the range
+    for ( std::size_t size : { std::size_t(0), std::size_t(5), std::size_t(17), std::size_t(100) } )
+    {
+      std::size_t next = 0;
+      for ( std::size_t index = 0; index < 4; ++index )
+      {
+        auto [ first, last ] = std::experimental::math::thread_pool::partition( size, index, 4 );
+        EXPECT_EQ( first, next );
+        EXPECT_LE( last - first, size / 4 + 1 );
+        EXPECT_GE( last - first, size / 4 );
+        next = last;
+      }
+      EXPECT_EQ( next, size );
+    }
+    // Each index is always visited by the same thread
+    std::experimental::math::thread_pool pool( 3 );
+    std::vector< std::thread::id > owners( 1000 );
+    pool.parallel_for_static( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                              std::experimental::math::detail::faux_index_iterator<std::size_t>( owners.size() ),
+                              [&owners]( std::size_t index ) { owners[index] = std::this_thread::get_id(); } );
+    for ( std::size_t repeat = 0; repeat < 5; ++repeat )
+    {
+      std::atomic<int> mismatches( 0 );
+      pool.parallel_for_static( std::experimental::math::detail::faux_index_iterator<std::size_t>( 0 ),
+                                std::experimental::math::detail::faux_index_iterator<std::size_t>( owners.size() ),
+                                [&owners,&mismatches]( std::size_t index )
+                                  { if ( owners[index] != std::this_thread::get_id() ) { static_cast<void>( mismatches.fetch_add( 1 ) ); } } );
+      EXPECT_EQ( mismatches.load(), 0 );
+    }
+  }
+
+  TEST( THREAD_POOL_POLICY, PROPERTIES )
+  {
+    std::experimental::math::thread_pool pool( 2 );
+    // Default policy targets the default pool
+    std::experimental::math::thread_pool_policy policy;
+    EXPECT_EQ( &policy.pool(), &std::experimental::math::thread_pool::default_pool() );
+    EXPECT_EQ( policy.grain_size(), 0 );
+    // Policy may be retargeted and given a grain size
+    auto custom_policy = policy.on( pool ).with_grain_size( 8 );
+    EXPECT_EQ( &custom_policy.pool(), &pool );
+    EXPECT_EQ( custom_policy.grain_size(), 8 );
+    EXPECT_EQ( &std::experimental::math::thread_pool_policy( pool, 4 ).pool(), &pool );
+    EXPECT_EQ( std::experimental::math::thread_pool_policy( pool, 4 ).grain_size(), 4 );
+    // Policy may request static partitioning
+    EXPECT_FALSE( custom_policy.is_static() );
+    EXPECT_TRUE( custom_policy.with_static_partitioning().is_static() );
+  }
+
+  TEST( THREAD_POOL_POLICY, APPLY_ALL )
+  {
+    std::experimental::math::thread_pool pool( 4 );
+    std::experimental::math::dr_tensor<double,3> dyn_tensor{ std::experimental::extents<size_t,8,9,10>(), std::experimental::extents<size_t,9,9,10>() };
+    // Populate using the thread pool
+    std::experimental::math::detail::apply_all( dyn_tensor.underlying_span(),
+                                                [&dyn_tensor]( auto i, auto j, auto k )
+                                                  { std::experimental::math::detail::access( dyn_tensor, i, j, k ) = double( 100 * i + 10 * j + k ); },
+                                                std::experimental::math::thread_pool_policy( pool, 2 ) );
+    for ( std::size_t i = 0; i < 8; ++i )
+    {
+      for ( std::size_t j = 0; j < 9; ++j )
+      {
+        for ( std::size_t k = 0; k < 10; ++k )
+        {
+          EXPECT_EQ( ( std::experimental::math::detail::access( dyn_tensor, i, j, k ) ), double( 100 * i + 10 * j + k ) );
+        }
+      }
+    }
+  }
+
+  TEST( THREAD_POOL_POLICY, APPLY_ALL_EXCEPTION )
+  {
+    std::experimental::math::dr_matrix<double> dyn_matrix{ std::experimental::extents<size_t,20,20>(), std::experimental::extents<size_t,20,20>() };
+    // Exceptions thrown by the lambda expression are propagated to the caller
+    EXPECT_THROW( std::experimental::math::detail::apply_all( dyn_matrix.underlying_span(),
+                                                              []( auto i, auto j ) { if ( i == 10 && j == 10 ) throw std::runtime_error( "Expected failure." ); },
+                                                              LINALG_EXECUTION_PAR ),
+                  std::runtime_error );
+  }
+}
@@ -777,6 +777,51 @@ namespace
     EXPECT_EQ( val3, 15.0 );
   }
 
+  TEST( DR_VECTOR, INLINE_STORAGE )
+  {
+    using vector_type = std::experimental::math::dr_vector<double,std::experimental::math::inline_allocator<double,16>>;
+    auto is_inline = []( const vector_type& v ) { return v.is_inline(); };
+    // Small vectors keep their elements within the object
+    vector_type small{ std::experimental::extents<size_t,dynamic_extent>( 5 ), []( auto i ) { return double( i ); } };
+    EXPECT_TRUE( is_inline( small ) );
+    // Moving inline elements copies them into the inline storage of the new vector
+    vector_type moved{ std::move( small ) };
+    EXPECT_TRUE( is_inline( moved ) );
+    EXPECT_EQ( std::experimental::math::detail::access( moved, 4 ), 4.0 );
+    // Growing beyond the inline capacity spills to the heap
+    moved.resize( 40 );
+    EXPECT_FALSE( is_inline( moved ) );
+    EXPECT_EQ( std::experimental::math::detail::access( moved, 3 ), 3.0 );
+    // Moving heap elements takes the pointer
+    const double* heap = &std::experimental::math::detail::access( moved, 0 );
+    vector_type large{ std::move( moved ) };
+    EXPECT_EQ( &std::experimental::math::detail::access( large, 0 ), heap );
+    // Shrinking to fit returns to inline storage
+    large.resize( 3 );
+    large.shrink_to_fit();
+    EXPECT_TRUE( is_inline( large ) );
+    EXPECT_EQ( std::experimental::math::detail::access( large, 2 ), 2.0 );
+    // Move assignment of inline elements over heap elements
+    vector_type target{ std::experimental::extents<size_t,dynamic_extent>( 32 ), []( auto i ) { return double( -i ); } };
+    target = std::move( large );
+    EXPECT_TRUE( is_inline( target ) );
+    EXPECT_EQ( target.size().extent(0), 3u );
+    EXPECT_EQ( std::experimental::math::detail::access( target, 1 ), 1.0 );
+    // Resizing within the inline capacity keeps the elements inline
+    target.resize( 10 );
+    EXPECT_TRUE( is_inline( target ) );
+    EXPECT_EQ( std::experimental::math::detail::access( target, 2 ), 2.0 );
+    // The buffer belongs to the vector, so copies of the allocator are interchangeable
+    const auto alloc = target.get_allocator();
+    EXPECT_TRUE( alloc == target.get_allocator() );
+    vector_type copy{ target };
+    EXPECT_TRUE( is_inline( copy ) );
+    EXPECT_TRUE( copy.get_allocator() == alloc );
+    auto copied_alloc = alloc;
+    double* heap_elems = copied_alloc.allocate( 64 );
+    vector_type::allocator_type( alloc ).deallocate( heap_elems, 64 );
+  }
+
   TEST( FS_VECTOR, DEFAULT_CONSTRUCTOR_AND_DESTRUCTOR )
   {
     // Default construction